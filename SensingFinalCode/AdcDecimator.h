@@ -0,0 +1,110 @@
+// Smart Plant Buddy - background ADC decimation
+//
+// The ADC runs continuously (DMA on the device) and every conversion frame
+// is pushed here per channel. Once a channel has collected `factor` samples
+// it publishes their mean and starts over, so a 1 kHz input with factor
+// 1000 gives one heavily averaged value per second at O(1) cost per sample.
+// Integer-only, no allocation; the host build drives it from
+// WaveformSource instead of the ADC.
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+template <uint8_t CHANNELS>
+class AdcDecimator {
+ public:
+  explicit AdcDecimator(uint32_t factor) : factor_(factor ? factor : 1) {
+    for (uint8_t c = 0; c < CHANNELS; c++) {
+      sum_[c] = 0;
+      count_[c] = 0;
+      out_[c] = 0;
+      fresh_[c] = false;
+    }
+    samples_ = 0;
+  }
+
+  // Returns true when this sample completed a window for ch
+  bool push(uint8_t ch, uint16_t sample) {
+    if (ch >= CHANNELS) return false;
+    samples_++;
+    sum_[ch] += sample;
+    if (++count_[ch] < factor_) return false;
+    out_[ch] = (uint16_t)((sum_[ch] + factor_ / 2) / factor_);
+    sum_[ch] = 0;
+    count_[ch] = 0;
+    fresh_[ch] = true;
+    return true;
+  }
+
+  // True once every channel has a value not yet taken
+  bool ready() const {
+    for (uint8_t c = 0; c < CHANNELS; c++) {
+      if (!fresh_[c]) return false;
+    }
+    return true;
+  }
+
+  // Latest decimated value; clears the channel's fresh flag
+  uint16_t take(uint8_t ch) {
+    fresh_[ch] = false;
+    return out_[ch];
+  }
+
+  uint16_t last(uint8_t ch) const { return out_[ch]; }
+  uint32_t factor() const { return factor_; }
+  uint32_t samples() const { return samples_; }
+
+ private:
+  uint32_t factor_;
+  uint32_t sum_[CHANNELS];
+  uint32_t count_[CHANNELS];
+  uint16_t out_[CHANNELS];
+  bool fresh_[CHANNELS];
+  uint32_t samples_;
+};
+
+// Synthetic ADC input for host builds: offset + sine + uniform noise,
+// clamped to 12 bits. Deterministic for a given seed.
+class WaveformSource {
+ public:
+  WaveformSource(float offset, float amplitude, float periodSamples, uint16_t noise, uint32_t seed)
+    : offset_(offset), amplitude_(amplitude), noise_(noise), state_(seed ? seed : 1), n_(0) {
+    // Rotate a unit vector instead of calling sin() per sample
+    float w = 6.2831853f / (periodSamples > 1 ? periodSamples : 1);
+    cosW_ = cosf(w);
+    sinW_ = sinf(w);
+    x_ = 1;
+    y_ = 0;
+  }
+
+  uint16_t next() {
+    float v = offset_ + amplitude_ * y_;
+    float x = x_ * cosW_ - y_ * sinW_;
+    y_ = x_ * sinW_ + y_ * cosW_;
+    x_ = x;
+    if ((++n_ & 1023) == 0) {
+      // Renormalise so rounding doesn't grow or shrink the amplitude
+      float m = x_ * x_ + y_ * y_;
+      float inv = 1.5f - 0.5f * m;
+      x_ *= inv;
+      y_ *= inv;
+    }
+    if (noise_) {
+      state_ = state_ * 1664525u + 1013904223u;
+      v += (float)((int32_t)(state_ >> 16) % (2 * noise_ + 1) - noise_);
+    }
+    if (v < 0) v = 0;
+    if (v > 4095) v = 4095;
+    return (uint16_t)v;
+  }
+
+ private:
+  float offset_;
+  float amplitude_;
+  uint16_t noise_;
+  uint32_t state_;
+  uint32_t n_;
+  float cosW_, sinW_, x_, y_;
+};
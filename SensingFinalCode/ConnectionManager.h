@@ -0,0 +1,155 @@
+// Smart Plant Buddy - non-blocking WiFi + NTP connection state machine
+//
+//   IDLE -> CONNECTING -> CONNECTED -> TIME_SYNCED
+//               |  ^          |            |
+//       timeout v  | retry    v link lost  v link lost
+//              BACKOFF <------+------------+
+//
+// poll() never waits: it checks the link, advances the state and returns,
+// so the main loop keeps sampling, drawing and serving WebSocket clients
+// while the radio associates. Failed attempts back off exponentially with
+// random jitter so a fleet of devices doesn't retry a flaky AP in lockstep.
+// The radio and clock are reached through hooks, so the same machine can be
+// driven on the host by a simulated flapping link (LinuxHal, checked by
+// plant_bench --check conn/).
+
+#pragma once
+
+#include <stdint.h>
+
+enum ConnState {
+  CONN_IDLE,
+  CONN_CONNECTING,
+  CONN_CONNECTED,     // associated, waiting for NTP
+  CONN_TIME_SYNCED,
+  CONN_BACKOFF
+};
+
+struct ConnectionHooks {
+  bool (*linkUp)();           // e.g. WiFi.status() == WL_CONNECTED
+  void (*startConnect)();     // kick off association, must not block
+  void (*startTimeSync)();    // kick off SNTP, must not block
+  bool (*timeValid)();        // wall clock has been set
+  uint32_t (*random)();       // jitter source
+  void (*onChange)(ConnState from, ConnState to);  // optional
+};
+
+struct ConnectionConfig {
+  unsigned long connectTimeoutMs;   // give up on one association attempt
+  unsigned long ntpRetryMs;         // re-kick SNTP if still unsynced
+  unsigned long backoffBaseMs;      // first retry delay
+  unsigned long backoffMaxMs;       // cap for the exponential delay
+};
+
+class ConnectionManager {
+ public:
+  ConnectionManager(const ConnectionHooks& hooks, const ConnectionConfig& cfg)
+    : hooks_(hooks), cfg_(cfg), state_(CONN_IDLE), since_(0), deadline_(0),
+      failures_(0), attempts_(0), drops_(0), lastDelay_(0) {}
+
+  // Call as often as you like; does O(1) work and never blocks
+  ConnState poll(unsigned long nowMs) {
+    switch (state_) {
+      case CONN_IDLE:
+        connect(nowMs);
+        break;
+
+      case CONN_CONNECTING:
+        if (hooks_.linkUp()) {
+          failures_ = 0;
+          set(CONN_CONNECTED, nowMs);
+          hooks_.startTimeSync();
+          deadline_ = nowMs + cfg_.ntpRetryMs;
+          if (hooks_.timeValid()) set(CONN_TIME_SYNCED, nowMs);
+        } else if ((long)(nowMs - deadline_) >= 0) {
+          backoff(nowMs);
+        }
+        break;
+
+      case CONN_CONNECTED:
+        if (!hooks_.linkUp()) {
+          linkLost(nowMs);
+        } else if (hooks_.timeValid()) {
+          set(CONN_TIME_SYNCED, nowMs);
+        } else if ((long)(nowMs - deadline_) >= 0) {
+          hooks_.startTimeSync();
+          deadline_ = nowMs + cfg_.ntpRetryMs;
+        }
+        break;
+
+      case CONN_TIME_SYNCED:
+        if (!hooks_.linkUp()) linkLost(nowMs);
+        break;
+
+      case CONN_BACKOFF:
+        if ((long)(nowMs - deadline_) >= 0) connect(nowMs);
+        break;
+    }
+    return state_;
+  }
+
+  ConnState state() const { return state_; }
+  bool online() const { return state_ == CONN_CONNECTED || state_ == CONN_TIME_SYNCED; }
+  unsigned long stateSinceMs() const { return since_; }
+  unsigned long attempts() const { return attempts_; }
+  unsigned long drops() const { return drops_; }
+  unsigned long lastBackoffMs() const { return lastDelay_; }
+
+  static const char* stateName(ConnState s) {
+    switch (s) {
+      case CONN_IDLE: return "idle";
+      case CONN_CONNECTING: return "connecting";
+      case CONN_CONNECTED: return "connected";
+      case CONN_TIME_SYNCED: return "time-synced";
+      case CONN_BACKOFF: return "backoff";
+    }
+    return "?";
+  }
+
+ private:
+  void set(ConnState s, unsigned long nowMs) {
+    if (s == state_) return;
+    ConnState from = state_;
+    state_ = s;
+    since_ = nowMs;
+    if (hooks_.onChange) hooks_.onChange(from, s);
+  }
+
+  void connect(unsigned long nowMs) {
+    attempts_++;
+    hooks_.startConnect();
+    deadline_ = nowMs + cfg_.connectTimeoutMs;
+    set(CONN_CONNECTING, nowMs);
+  }
+
+  // A drop after a good connection retries quickly; the backoff grows
+  // only while attempts keep failing
+  void linkLost(unsigned long nowMs) {
+    drops_++;
+    failures_ = 0;
+    backoff(nowMs);
+  }
+
+  // delay = min(base * 2^failures, max), then +/- up to 25% jitter
+  void backoff(unsigned long nowMs) {
+    unsigned long d = cfg_.backoffBaseMs;
+    for (uint8_t i = 0; i < failures_ && d < cfg_.backoffMaxMs; i++) d *= 2;
+    if (d > cfg_.backoffMaxMs) d = cfg_.backoffMaxMs;
+    unsigned long spread = d / 2;
+    if (spread > 0) d = d - spread / 2 + hooks_.random() % (spread + 1);
+    if (failures_ < 31) failures_++;
+    lastDelay_ = d;
+    deadline_ = nowMs + d;
+    set(CONN_BACKOFF, nowMs);
+  }
+
+  ConnectionHooks hooks_;
+  ConnectionConfig cfg_;
+  ConnState state_;
+  unsigned long since_;
+  unsigned long deadline_;
+  uint8_t failures_;
+  unsigned long attempts_;
+  unsigned long drops_;
+  unsigned long lastDelay_;
+};
@@ -0,0 +1,569 @@
+// Generated by embed_dashboard.py from Dashboard.html - do not edit.
+// 34352 bytes of HTML, 8802 bytes gzipped.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define DASHBOARD_ETAG "\"fc61807731a861fd\""
+
+const size_t DASHBOARD_HTML_GZ_LEN = 8802;
+
+const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xdb, 0x6e, 0x23, 0xc9,
+  0x75, 0xef, 0xf3, 0x15, 0x35, 0x3d, 0xb3, 0x16, 0xb9, 0x4b, 0x52, 0xa4, 0x6e, 0xa3, 0xd1, 0xcd,
+  0xd1, 0x48, 0x1a, 0x8f, 0x60, 0xcd, 0xcc, 0x62, 0xa4, 0xdd, 0x85, 0x2d, 0x0f, 0x56, 0x4d, 0x76,
+  0x51, 0xec, 0x55, 0xb3, 0xbb, 0xb7, 0xbb, 0x29, 0x4a, 0x91, 0x19, 0x2c, 0xf2, 0x60, 0x04, 0x86,
+  0x81, 0x18, 0xb6, 0x1f, 0x1c, 0xbf, 0x6c, 0x02, 0xc4, 0x76, 0x1e, 0xfd, 0x96, 0x20, 0x2f, 0x01,
+  0xfc, 0x29, 0xfb, 0x03, 0xf1, 0x27, 0xe4, 0x9c, 0xba, 0x75, 0x55, 0xf5, 0x85, 0xd4, 0xac, 0xd7,
+  0xb1, 0x81, 0xf5, 0x78, 0x67, 0xc8, 0xaa, 0x3a, 0xa7, 0xaa, 0x4e, 0x9d, 0x7b, 0x5d, 0xb8, 0xf3,
+  0xb0, 0xdd, 0xde, 0x3f, 0x26, 0x53, 0x37, 0x25, 0x93, 0x94, 0x7a, 0x64, 0x18, 0x25, 0xc4, 0xa3,
+  0xfd, 0xc9, 0xe5, 0xa5, 0x1f, 0x5e, 0x12, 0x37, 0xe4, 0x25, 0x2e, 0x4d, 0xb3, 0x11, 0xcd, 0xfc,
+  0x41, 0xda, 0x6e, 0xef, 0x3d, 0xd8, 0x79, 0x78, 0xf8, 0xfa, 0xe0, 0xec, 0x07, 0x1f, 0x1e, 0x91,
+  0x51, 0x36, 0x0e, 0xe0, 0xbb, 0xfc, 0x87, 0xba, 0xde, 0xde, 0x03, 0x42, 0x76, 0xc6, 0x34, 0x73,
+  0xc9, 0x60, 0xe4, 0x26, 0x29, 0xcd, 0x76, 0x9d, 0x49, 0x36, 0x6c, 0x6f, 0x3a, 0x64, 0x99, 0x55,
+  0x65, 0x7e, 0x16, 0xd0, 0xbd, 0xd3, 0xb1, 0x9b, 0x64, 0xe4, 0xc3, 0xc0, 0x0d, 0x33, 0xf2, 0x6c,
+  0xe2, 0x79, 0xb7, 0x3b, 0xcb, 0xbc, 0x42, 0x41, 0x87, 0xee, 0x98, 0xee, 0x3a, 0xd7, 0x3e, 0x9d,
+  0xc6, 0x51, 0x92, 0x39, 0x64, 0x10, 0x85, 0x19, 0x0d, 0x01, 0xdb, 0xd4, 0xf7, 0xb2, 0xd1, 0xae,
+  0x47, 0xaf, 0xfd, 0x01, 0x6d, 0xb3, 0x2f, 0x2d, 0xe2, 0x87, 0x7e, 0xe6, 0xbb, 0x41, 0x3b, 0x1d,
+  0xb8, 0x01, 0xdd, 0xed, 0xc9, 0xbe, 0xd2, 0xec, 0x96, 0xa3, 0x24, 0xa4, 0x1f, 0x79, 0xb7, 0xe4,
+  0x8e, 0xb0, 0xcf, 0x04, 0xa6, 0x14, 0x66, 0xed, 0xa1, 0x3b, 0xf6, 0x83, 0xdb, 0x2d, 0x92, 0xde,
+  0xa6, 0x19, 0x1d, 0xb7, 0x27, 0x7e, 0x8b, 0xb4, 0xdd, 0x38, 0x0e, 0x68, 0x9b, 0x97, 0xb4, 0xc8,
+  0xb3, 0xc0, 0x0f, 0xaf, 0x5e, 0xba, 0x83, 0x53, 0xf6, 0xfd, 0x39, 0x00, 0xb5, 0x48, 0xea, 0x86,
+  0x69, 0x3b, 0xa5, 0x89, 0x3f, 0xdc, 0x96, 0xd8, 0xc6, 0xee, 0x0d, 0x1f, 0xc8, 0x16, 0x79, 0xb2,
+  0xd2, 0x8d, 0x6f, 0xb4, 0x8a, 0x04, 0xa8, 0xb8, 0x45, 0x56, 0x12, 0x3a, 0x26, 0xee, 0x24, 0x8b,
+  0x54, 0x4d, 0xec, 0x7a, 0x1e, 0xd0, 0x77, 0x8b, 0x74, 0x49, 0x0f, 0x2a, 0xb7, 0x59, 0xf1, 0x8c,
+  0xfd, 0xdd, 0x19, 0xb8, 0x89, 0x97, 0x0f, 0xb5, 0x1f, 0x25, 0x1e, 0x4d, 0xb6, 0x48, 0x2f, 0xbe,
+  0x21, 0x69, 0x14, 0xf8, 0x1e, 0x79, 0xe4, 0x79, 0xde, 0xb6, 0x59, 0xdd, 0x4e, 0x5c, 0xcf, 0x9f,
+  0xa4, 0xd0, 0x6a, 0x45, 0xeb, 0x5e, 0x75, 0xd2, 0xdb, 0x28, 0x19, 0x14, 0x36, 0x25, 0x5d, 0x0d,
+  0xd1, 0x4d, 0x3b, 0x1d, 0xb9, 0x5e, 0x34, 0xc5, 0x41, 0x61, 0xdd, 0x1a, 0xfc, 0x97, 0x5c, 0xf6,
+  0xdd, 0x46, 0xb7, 0xc5, 0xfe, 0x74, 0xba, 0x6b, 0x4d, 0x63, 0xa0, 0x7d, 0xff, 0xd2, 0x22, 0x69,
+  0xea, 0xff, 0x3d, 0xdd, 0x22, 0x6b, 0x9b, 0x85, 0xee, 0xda, 0xfd, 0x28, 0xcb, 0xa2, 0xf1, 0x16,
+  0xc1, 0x2a, 0x1d, 0x47, 0x12, 0x4d, 0x73, 0x1c, 0x9e, 0x9f, 0xc6, 0x81, 0x0b, 0x4b, 0x32, 0x0c,
+  0x68, 0x8e, 0xe1, 0xd2, 0x8d, 0xad, 0x89, 0x61, 0x75, 0x7b, 0x9a, 0x60, 0x39, 0xfe, 0x5d, 0x98,
+  0xda, 0x26, 0x9b, 0x99, 0xde, 0x4d, 0xec, 0x07, 0x41, 0xde, 0x8f, 0x22, 0x0c, 0xd0, 0x85, 0xf4,
+  0xf4, 0x15, 0xb3, 0xc8, 0xf9, 0xf4, 0xe9, 0x53, 0xbd, 0xd2, 0x1d, 0x5c, 0x5d, 0x26, 0xd1, 0x24,
+  0xf4, 0xb6, 0x1e, 0x0d, 0x57, 0xf1, 0xcf, 0x76, 0xc9, 0xec, 0x7b, 0x6b, 0xe6, 0x14, 0x03, 0xb7,
+  0x4f, 0x83, 0x52, 0x3a, 0xe5, 0x2d, 0xed, 0xa9, 0xeb, 0xf3, 0xf4, 0xfc, 0x84, 0x0e, 0x32, 0x3f,
+  0x82, 0x79, 0x0d, 0xa2, 0x60, 0x32, 0x0e, 0xb7, 0x75, 0xba, 0x68, 0x28, 0x2c, 0x4a, 0x33, 0x8a,
+  0x69, 0xe3, 0x48, 0x69, 0x00, 0x78, 0xc8, 0x5d, 0x19, 0x0d, 0x36, 0x73, 0x2c, 0x16, 0x05, 0x36,
+  0xec, 0x1a, 0x83, 0x13, 0x07, 0x83, 0xc1, 0xf6, 0x7c, 0x0a, 0x3c, 0x72, 0x3d, 0x14, 0x56, 0xd5,
+  0xb5, 0x18, 0x68, 0x16, 0xc5, 0xfa, 0x28, 0x17, 0x42, 0x31, 0x09, 0xec, 0x09, 0xb4, 0x03, 0x3a,
+  0xcc, 0x40, 0xc4, 0xba, 0x36, 0x21, 0xf8, 0xcc, 0xba, 0x26, 0x23, 0x48, 0x3c, 0x81, 0x6f, 0x8f,
+  0x46, 0x92, 0xcd, 0xa6, 0xda, 0xd8, 0x65, 0x9c, 0x03, 0xa4, 0x8f, 0x60, 0xee, 0x8f, 0x36, 0x36,
+  0x36, 0xb6, 0x45, 0xd5, 0x68, 0x0d, 0xca, 0x8d, 0xb9, 0x30, 0x31, 0xb3, 0xf0, 0xe1, 0x44, 0x04,
+  0x00, 0xfb, 0x6b, 0xf9, 0x7d, 0x72, 0xe0, 0x02, 0x13, 0xc1, 0x72, 0x10, 0xa6, 0x9f, 0x52, 0xf2,
+  0xfe, 0xb2, 0x12, 0x7c, 0x56, 0xde, 0x46, 0x5d, 0xe7, 0xfa, 0x21, 0x4d, 0xf2, 0xc9, 0x46, 0xa9,
+  0xcf, 0x79, 0x20, 0xa1, 0x81, 0x9b, 0xf9, 0xd7, 0xd4, 0x9e, 0x6c, 0x6f, 0x23, 0x67, 0x7a, 0x83,
+  0x55, 0xc9, 0xa3, 0xa1, 0x8b, 0x7f, 0xb6, 0x0b, 0x5a, 0x61, 0xa5, 0x72, 0xd5, 0x6d, 0x29, 0x55,
+  0x23, 0x4b, 0x61, 0xd9, 0xf3, 0x85, 0x54, 0x4c, 0x1b, 0x46, 0xa1, 0x1a, 0x50, 0x14, 0xbb, 0x03,
+  0x3f, 0x83, 0x42, 0x35, 0x98, 0x2c, 0x01, 0x9d, 0x29, 0x86, 0x2f, 0x6a, 0x49, 0xb7, 0xb3, 0x9a,
+  0x12, 0xea, 0xa6, 0xb4, 0x0d, 0xb4, 0x8a, 0x26, 0x59, 0x4d, 0x77, 0x1d, 0x77, 0x80, 0x13, 0x2e,
+  0xf6, 0xda, 0x0f, 0xa2, 0xc1, 0x55, 0xa1, 0xdb, 0x9e, 0x2c, 0x71, 0x43, 0x7f, 0xec, 0xf2, 0x5e,
+  0x87, 0xae, 0x47, 0x8f, 0xc3, 0xda, 0x4e, 0xff, 0xee, 0x8a, 0xde, 0x0e, 0x13, 0x30, 0x3a, 0xa9,
+  0x6c, 0x2d, 0xfb, 0x1b, 0x26, 0xd1, 0x18, 0x56, 0x5a, 0x9b, 0x17, 0x9f, 0x11, 0xd8, 0x45, 0x58,
+  0x5f, 0xf6, 0x11, 0x96, 0x84, 0xfe, 0xa0, 0xb1, 0x1e, 0xdf, 0x34, 0xe5, 0x5a, 0xc3, 0xac, 0x23,
+  0x1d, 0xa8, 0x57, 0x05, 0xd4, 0x55, 0x20, 0xf6, 0xe4, 0x43, 0xf7, 0xba, 0x38, 0x67, 0x5d, 0x3d,
+  0x7c, 0x36, 0x49, 0x33, 0x7f, 0x78, 0xdb, 0x16, 0xa6, 0x11, 0x2c, 0x19, 0xf4, 0x46, 0xdb, 0x7d,
+  0x9a, 0x4d, 0x29, 0x55, 0x6a, 0xc2, 0x0d, 0xfc, 0xcb, 0xb0, 0xed, 0x83, 0x01, 0x83, 0x85, 0x1d,
+  0x40, 0x3b, 0x9a, 0x6c, 0x97, 0x9b, 0x02, 0x5d, 0xaf, 0x54, 0x72, 0x40, 0x3f, 0x0b, 0x8b, 0x3a,
+  0x04, 0x15, 0x6e, 0x6f, 0x61, 0x55, 0x51, 0xa3, 0x62, 0x34, 0xb6, 0x9d, 0x8e, 0x60, 0xcc, 0xb2,
+  0x62, 0x30, 0x49, 0x52, 0x94, 0xbf, 0x38, 0xf2, 0xf5, 0x09, 0x54, 0x28, 0x53, 0x9d, 0xe1, 0x50,
+  0x7c, 0xbb, 0x9d, 0x95, 0xb4, 0x72, 0x36, 0x5b, 0xa3, 0xe8, 0x1a, 0xc6, 0x1a, 0x46, 0x59, 0x63,
+  0x0b, 0xc8, 0xec, 0xf6, 0x03, 0xea, 0x35, 0xd5, 0x14, 0x4d, 0x41, 0xe2, 0x4a, 0xdf, 0x9c, 0x86,
+  0xd4, 0x0c, 0x60, 0x2b, 0xaa, 0xfb, 0x90, 0x88, 0x15, 0xde, 0x9c, 0x9b, 0x3a, 0xeb, 0xf6, 0x24,
+  0x61, 0x28, 0x6d, 0x18, 0x76, 0x34, 0xa5, 0x5e, 0x39, 0x46, 0x3f, 0xf4, 0xfc, 0x81, 0x9b, 0x45,
+  0x49, 0x5a, 0xcf, 0x20, 0xe6, 0x4a, 0x96, 0x30, 0x8c, 0xc9, 0x0e, 0x08, 0xaa, 0xe4, 0xa7, 0xb2,
+  0x4f, 0xd5, 0xa5, 0x70, 0x79, 0x34, 0xfc, 0x23, 0xea, 0x5f, 0x8e, 0xb2, 0xad, 0x1a, 0x73, 0xb2,
+  0xde, 0x7d, 0xaf, 0x54, 0x45, 0xa1, 0x4b, 0x53, 0xbf, 0xd4, 0x8b, 0xaf, 0xa9, 0x1a, 0xa9, 0xad,
+  0x38, 0x8c, 0x1e, 0xd7, 0x0e, 0xf6, 0x9f, 0xaf, 0x2b, 0x9e, 0x17, 0x73, 0x59, 0x59, 0xab, 0x1c,
+  0xf9, 0x5a, 0x95, 0x40, 0x30, 0xbf, 0x35, 0x57, 0x16, 0x1a, 0x47, 0x6e, 0x5a, 0xa6, 0x6d, 0x2a,
+  0xc8, 0xb3, 0xd1, 0xed, 0xce, 0xb5, 0xd9, 0x30, 0x61, 0x7a, 0x83, 0x6c, 0x00, 0xc2, 0x6b, 0xaf,
+  0x93, 0xe4, 0xb8, 0xd5, 0xd5, 0xd5, 0xed, 0x12, 0x49, 0x2c, 0x23, 0x30, 0x38, 0xb2, 0xd4, 0x4d,
+  0xda, 0x97, 0x38, 0x1b, 0xc0, 0xd5, 0x00, 0xe5, 0x94, 0xe0, 0x60, 0x5a, 0xc0, 0xd4, 0x9b, 0xc3,
+  0xa7, 0x43, 0x17, 0x3f, 0x0c, 0x87, 0xea, 0x6b, 0x73, 0x9e, 0xac, 0x9a, 0x16, 0xed, 0x85, 0x9f,
+  0x02, 0xbd, 0x6f, 0xa1, 0x9b, 0x34, 0xb3, 0xad, 0xda, 0x88, 0xd7, 0xb5, 0x31, 0x38, 0xd0, 0x2c,
+  0xda, 0x37, 0xa9, 0xd1, 0x8a, 0xde, 0x66, 0x25, 0x5b, 0xc1, 0x12, 0x26, 0x6d, 0xee, 0x1a, 0xe9,
+  0x66, 0x6c, 0x56, 0x36, 0x76, 0xae, 0x29, 0xca, 0x44, 0xf8, 0x49, 0x29, 0x54, 0x16, 0x5d, 0x5e,
+  0x56, 0xb0, 0x86, 0xb6, 0xce, 0xba, 0x67, 0x31, 0x5f, 0xe9, 0xa8, 0x85, 0x5e, 0xab, 0x75, 0xdb,
+  0xd6, 0x8a, 0xba, 0x58, 0xb7, 0xd1, 0xa5, 0xc4, 0x28, 0x1d, 0xbd, 0x35, 0x67, 0x63, 0x64, 0xb4,
+  0x8b, 0x7f, 0x4a, 0x81, 0x91, 0x11, 0x4a, 0xdc, 0x18, 0x8c, 0x94, 0xa4, 0x92, 0x58, 0xe9, 0x6a,
+  0x2e, 0x1b, 0x76, 0x32, 0x04, 0x8d, 0xd7, 0x06, 0x72, 0xb2, 0x40, 0xc9, 0x2e, 0x07, 0xc5, 0x34,
+  0xf2, 0x3d, 0x2f, 0x67, 0x82, 0x12, 0x13, 0x43, 0x29, 0x9d, 0x6f, 0x62, 0xca, 0x24, 0x45, 0x77,
+  0xe2, 0x36, 0x4b, 0x7c, 0xf2, 0x4a, 0xbe, 0x30, 0xa7, 0xd9, 0xa1, 0x37, 0x31, 0x04, 0xcc, 0x9a,
+  0x96, 0x2f, 0x73, 0x55, 0x6a, 0x51, 0x6c, 0x6d, 0x81, 0x96, 0xe8, 0x5f, 0xf9, 0xc0, 0x28, 0x83,
+  0x24, 0x0a, 0x82, 0xbe, 0x5b, 0xd0, 0xb7, 0x96, 0x08, 0x2e, 0x8e, 0xa8, 0x0d, 0x2a, 0x74, 0x70,
+  0x55, 0x61, 0xd9, 0x7a, 0xf8, 0xa7, 0x82, 0x7a, 0xab, 0xef, 0xde, 0xe3, 0x68, 0x32, 0xee, 0x97,
+  0xf7, 0x58, 0xed, 0x0f, 0x7c, 0xcd, 0xee, 0xea, 0x38, 0xd6, 0xb2, 0xd1, 0x8f, 0x98, 0xbe, 0xba,
+  0xb3, 0xbc, 0xa1, 0xee, 0xf6, 0xdc, 0x08, 0xa3, 0x42, 0x94, 0x51, 0xcb, 0x2a, 0xfe, 0xee, 0x75,
+  0x36, 0x8a, 0x7d, 0x55, 0xc7, 0x1d, 0x6b, 0x45, 0x8d, 0xb0, 0xbe, 0xbe, 0x5e, 0x4a, 0x88, 0x74,
+  0x32, 0x06, 0xe0, 0xdb, 0x77, 0x50, 0x2c, 0x3a, 0xa3, 0xaf, 0x95, 0xab, 0xf2, 0x33, 0x7f, 0x4c,
+  0x09, 0xd8, 0xda, 0x4b, 0x4a, 0x86, 0x7e, 0x00, 0xca, 0x41, 0x29, 0xf2, 0x0c, 0x6a, 0xda, 0xa2,
+  0xec, 0x5e, 0x6e, 0x47, 0xb9, 0x9b, 0x69, 0x07, 0xf1, 0xfa, 0x4c, 0xb5, 0xae, 0xca, 0x1d, 0x4e,
+  0x16, 0xb8, 0xaf, 0xd4, 0x3a, 0x9c, 0x9a, 0x4b, 0xf1, 0xcd, 0x38, 0x9c, 0xab, 0xf7, 0x70, 0x38,
+  0xad, 0x09, 0xd5, 0xf1, 0xe8, 0xbd, 0x9c, 0x4c, 0x0b, 0xef, 0x3d, 0x3c, 0x1e, 0x81, 0xd1, 0x98,
+  0xb4, 0xd5, 0x99, 0x0e, 0x60, 0x32, 0xc9, 0x69, 0xe6, 0x66, 0x29, 0x61, 0x89, 0x2a, 0xc9, 0x1d,
+  0x29, 0x16, 0x81, 0x83, 0xe1, 0x97, 0x68, 0x3f, 0x2c, 0x55, 0xcc, 0x01, 0x9f, 0xdb, 0x60, 0xba,
+  0x63, 0x0c, 0x7f, 0xda, 0x3c, 0xa3, 0x91, 0x62, 0x58, 0x1b, 0x53, 0x37, 0x6b, 0xa0, 0xee, 0x87,
+  0xf9, 0x80, 0x5f, 0x32, 0xf6, 0x43, 0xb0, 0x16, 0x8d, 0xde, 0x1a, 0x88, 0x5d, 0x8b, 0xf4, 0x86,
+  0x49, 0xb3, 0xb9, 0x5d, 0x48, 0x08, 0xd5, 0x30, 0xd8, 0x2c, 0x1f, 0x16, 0xc8, 0xd8, 0x4d, 0x05,
+  0xad, 0x99, 0xb3, 0xf3, 0x4e, 0x91, 0x71, 0xb5, 0x83, 0xa6, 0xf7, 0x2c, 0x92, 0x3f, 0x25, 0xdc,
+  0xd3, 0xab, 0x15, 0x54, 0x86, 0x5b, 0x0b, 0x18, 0x27, 0x71, 0x4c, 0x93, 0x01, 0x44, 0xae, 0xdb,
+  0x73, 0xb4, 0x87, 0xde, 0xf9, 0xb5, 0x1b, 0x4c, 0xde, 0xd9, 0x33, 0x2d, 0x38, 0x99, 0x05, 0xcc,
+  0x9d, 0xcb, 0x28, 0xf2, 0xb4, 0xd4, 0x88, 0x60, 0x97, 0x92, 0x86, 0x53, 0x37, 0x09, 0xb5, 0x86,
+  0xcf, 0x9f, 0x3f, 0xdd, 0xec, 0x96, 0x36, 0xec, 0xbb, 0x3a, 0xc2, 0xe1, 0xda, 0xda, 0xea, 0xea,
+  0x86, 0x9d, 0x3d, 0x39, 0xba, 0xc1, 0x84, 0x30, 0xe9, 0x4f, 0x60, 0xe6, 0xa1, 0x62, 0x3f, 0xca,
+  0x4a, 0x17, 0x8c, 0x4e, 0x75, 0x16, 0x58, 0xe9, 0x3d, 0xdd, 0x78, 0xbe, 0x3a, 0x5f, 0x2a, 0x4c,
+  0x07, 0xaa, 0x5a, 0xa3, 0xdc, 0x4f, 0x71, 0x54, 0x78, 0x1e, 0x73, 0xf5, 0x49, 0x3e, 0xdd, 0x3a,
+  0x55, 0xd2, 0x7b, 0xfa, 0x64, 0xe3, 0x70, 0x25, 0x07, 0xdc, 0x59, 0x16, 0x19, 0x71, 0xfc, 0xfc,
+  0xb0, 0xdd, 0x26, 0xcf, 0xfd, 0x84, 0xf6, 0x81, 0xab, 0x60, 0xde, 0xe3, 0xd8, 0xcd, 0xc8, 0xe9,
+  0xe1, 0xf7, 0x53, 0x82, 0x19, 0x7e, 0x4c, 0x9e, 0x0f, 0x12, 0x3f, 0x06, 0x6f, 0x3e, 0x19, 0xec,
+  0x3a, 0xa3, 0x2c, 0x8b, 0xd3, 0xad, 0xe5, 0xe5, 0xe9, 0x74, 0xda, 0xb9, 0xc4, 0xf5, 0xf2, 0x07,
+  0x1d, 0x00, 0x59, 0x1e, 0x0a, 0xf8, 0xcf, 0xd2, 0xe5, 0xa7, 0x9d, 0x95, 0xd5, 0x4e, 0x57, 0x95,
+  0x60, 0x26, 0xbd, 0xcd, 0xb1, 0x76, 0x3e, 0x4b, 0x9d, 0x3d, 0xe8, 0x9a, 0xe1, 0xfb, 0x73, 0xa0,
+  0xf6, 0xdc, 0xcc, 0x65, 0x1f, 0xaa, 0xf0, 0xe3, 0xd4, 0x0e, 0x46, 0x6e, 0x82, 0x55, 0x75, 0xd3,
+  0x19, 0x78, 0x21, 0xb4, 0xf0, 0x68, 0xe0, 0x5f, 0x27, 0x9d, 0x90, 0x66, 0xcb, 0x61, 0x3c, 0x5e,
+  0x1e, 0x08, 0x40, 0x1d, 0xe7, 0xce, 0x32, 0xdf, 0xda, 0xd8, 0xc1, 0x6d, 0x04, 0x86, 0x6e, 0xd4,
+  0xdb, 0xfb, 0xd3, 0x97, 0x3f, 0xfb, 0x1f, 0x52, 0xb2, 0x91, 0x01, 0x55, 0x8c, 0xc0, 0x9e, 0x7f,
+  0x4d, 0x06, 0x81, 0x9b, 0xa6, 0xbb, 0x0e, 0x6a, 0x4a, 0x87, 0x6f, 0x44, 0xec, 0x30, 0x95, 0xb0,
+  0x27, 0x96, 0x8b, 0x03, 0x66, 0xb7, 0x31, 0xdd, 0x12, 0x25, 0x3b, 0x22, 0x4f, 0xeb, 0x7b, 0xbb,
+  0x4e, 0x8c, 0xb5, 0xa7, 0xec, 0xbb, 0x23, 0x21, 0xa0, 0x45, 0x14, 0x23, 0x67, 0x10, 0x26, 0x32,
+  0xbb, 0x8e, 0xb3, 0xd7, 0x08, 0x22, 0x17, 0x39, 0xfd, 0xab, 0x2f, 0x7e, 0xd7, 0xdc, 0x59, 0xe6,
+  0xb5, 0xb2, 0x39, 0xcc, 0x81, 0xc1, 0x8b, 0xce, 0x97, 0x45, 0xef, 0xfc, 0x1b, 0x8e, 0x10, 0xfb,
+  0x19, 0x83, 0x20, 0x3b, 0x72, 0xac, 0x7d, 0xff, 0xd2, 0xd9, 0x03, 0x54, 0x3b, 0xcb, 0x50, 0xad,
+  0xb7, 0x14, 0xf5, 0x49, 0x34, 0x55, 0x83, 0xd1, 0xcb, 0x31, 0xc5, 0xee, 0x30, 0x74, 0x69, 0xe4,
+  0x07, 0xce, 0x1e, 0xfe, 0xbd, 0x45, 0xbe, 0xfa, 0xe2, 0x97, 0x02, 0x51, 0x1d, 0x44, 0x80, 0xea,
+  0xc7, 0xd9, 0x0b, 0xb8, 0x16, 0x5a, 0x0c, 0x06, 0x6d, 0x88, 0xb3, 0x87, 0x7f, 0x2f, 0x0a, 0x01,
+  0xde, 0xa1, 0xb3, 0x07, 0x7f, 0xd9, 0xed, 0x8d, 0x99, 0xf2, 0x84, 0x2f, 0xeb, 0x00, 0x6c, 0x2b,
+  0x52, 0xe2, 0x57, 0x40, 0x43, 0x2c, 0x14, 0x8d, 0xfb, 0xc9, 0x9e, 0xd6, 0x08, 0x58, 0x87, 0xe2,
+  0xc0, 0xaf, 0x29, 0xcb, 0xdb, 0xe0, 0x36, 0x55, 0x08, 0xe4, 0xa6, 0x9e, 0x02, 0x32, 0x49, 0xcd,
+  0xf3, 0xcf, 0xc8, 0x5b, 0xa2, 0xfb, 0xbc, 0x73, 0xc6, 0xb6, 0x68, 0x59, 0xc1, 0xcd, 0xf3, 0x07,
+  0x29, 0x39, 0x15, 0x6e, 0xde, 0x01, 0x9a, 0x59, 0xc1, 0xc5, 0x15, 0x3c, 0x35, 0x5a, 0xe5, 0x51,
+  0x37, 0x2c, 0xa5, 0xa6, 0x50, 0xba, 0xdb, 0x0e, 0x30, 0xe9, 0x2f, 0x7f, 0xaa, 0x30, 0xe5, 0xc8,
+  0x81, 0x4b, 0x57, 0xf7, 0x0a, 0x4b, 0x9b, 0xdb, 0x70, 0xb1, 0x90, 0xf8, 0xfd, 0x7b, 0xf8, 0xb5,
+  0x8c, 0xb0, 0xd2, 0xb4, 0xea, 0xac, 0x69, 0x57, 0x33, 0x76, 0x73, 0xf6, 0xf6, 0xaf, 0x2f, 0xc9,
+  0x29, 0xf0, 0x83, 0xb1, 0x48, 0x25, 0xcd, 0x19, 0x4b, 0xf3, 0xbe, 0xdd, 0xeb, 0xcb, 0x53, 0xc6,
+  0x47, 0x6c, 0x01, 0xf4, 0xb5, 0xad, 0x5a, 0xe8, 0x7b, 0x8e, 0xe7, 0x0c, 0x38, 0xe7, 0x7e, 0xe3,
+  0x39, 0x63, 0x1c, 0xf7, 0x4d, 0x8d, 0xe7, 0x04, 0x99, 0xff, 0x7e, 0x03, 0x3a, 0xe1, 0x62, 0xf3,
+  0x4d, 0x8d, 0xe8, 0xc5, 0x64, 0xec, 0x7b, 0x7e, 0x76, 0x7b, 0xbf, 0x41, 0xbd, 0x40, 0x29, 0xab,
+  0x19, 0x52, 0x19, 0xe7, 0x57, 0xb0, 0x35, 0x16, 0x0b, 0xbe, 0xb6, 0xb6, 0x06, 0xe7, 0x24, 0x8a,
+  0x4a, 0x53, 0x44, 0x65, 0xc9, 0xa1, 0x9c, 0xb1, 0x6d, 0x11, 0x52, 0xe2, 0xf3, 0x4f, 0x22, 0xbb,
+  0xe5, 0x0f, 0xdc, 0x80, 0x1c, 0x82, 0xe9, 0xc9, 0x65, 0x07, 0xb5, 0x01, 0x77, 0x43, 0xc4, 0xe0,
+  0x73, 0xb3, 0xcc, 0xc9, 0xc1, 0xbf, 0x3f, 0x83, 0xaf, 0x88, 0xe9, 0xb7, 0xd2, 0x77, 0x39, 0x38,
+  0xfd, 0x78, 0x67, 0x99, 0x43, 0x5a, 0x34, 0x11, 0x6e, 0x0e, 0x53, 0x05, 0x2c, 0x12, 0x7b, 0xc3,
+  0x22, 0xb1, 0xe7, 0x3c, 0xea, 0xe2, 0x4a, 0xc0, 0xa4, 0x97, 0x16, 0x01, 0xe4, 0x93, 0x01, 0x6a,
+  0x84, 0x72, 0x3a, 0xb6, 0xe7, 0x61, 0x6e, 0x65, 0x71, 0x42, 0x81, 0x8d, 0x18, 0x2a, 0x3a, 0x39,
+  0x7b, 0xa7, 0xa3, 0x68, 0xba, 0x05, 0x0a, 0x0c, 0xb0, 0x54, 0x4c, 0xd4, 0x8a, 0x3b, 0x1c, 0x82,
+  0x36, 0xb9, 0xcd, 0xc2, 0xc6, 0x5d, 0x67, 0x65, 0x6d, 0xe4, 0xec, 0x9d, 0xb8, 0x10, 0xee, 0xc2,
+  0x27, 0x73, 0xa2, 0xf7, 0x43, 0xb4, 0xea, 0x09, 0x3c, 0xab, 0x40, 0xf8, 0xdb, 0xf4, 0x7e, 0xa8,
+  0x08, 0x8f, 0x85, 0x4c, 0x8c, 0x4f, 0x24, 0xc6, 0x27, 0xef, 0x80, 0xd1, 0x44, 0x05, 0xca, 0x1d,
+  0xc4, 0x24, 0x90, 0x3c, 0x51, 0xbb, 0x9c, 0xda, 0x7a, 0x59, 0x41, 0xbc, 0xb0, 0x4c, 0xbc, 0x50,
+  0xe8, 0x69, 0x67, 0xaf, 0x4b, 0x60, 0x29, 0x12, 0x9f, 0xa6, 0x8b, 0x60, 0xe2, 0xc9, 0x49, 0x03,
+  0xd1, 0x0b, 0x51, 0x54, 0x62, 0x14, 0x58, 0x6c, 0xa3, 0xb1, 0xfd, 0x5a, 0x19, 0xdb, 0x1f, 0xd2,
+  0xcc, 0xf5, 0x71, 0xbb, 0xe2, 0x04, 0xf0, 0x01, 0xbf, 0xaf, 0x55, 0x10, 0xc8, 0xcc, 0x15, 0x1a,
+  0x43, 0x38, 0xe3, 0x45, 0x8c, 0x97, 0x2a, 0xa9, 0x53, 0x36, 0x1d, 0x33, 0xcd, 0x63, 0xe0, 0xc4,
+  0xd1, 0x1c, 0xa8, 0x1a, 0x35, 0xa6, 0x89, 0x34, 0xc5, 0x69, 0x86, 0x86, 0x75, 0x12, 0x94, 0x98,
+  0x75, 0x53, 0xc3, 0x58, 0xdb, 0xac, 0xa5, 0xe6, 0xcd, 0x4c, 0xf0, 0xf3, 0x71, 0xc8, 0xb2, 0x33,
+  0x56, 0xb4, 0x87, 0x06, 0x8a, 0xbc, 0x8c, 0xa0, 0xdf, 0x49, 0x42, 0x0d, 0x7d, 0x57, 0x87, 0x8f,
+  0xef, 0xa1, 0x1a, 0xdc, 0xc9, 0x7c, 0x4e, 0xe9, 0x38, 0xe5, 0x8a, 0x76, 0xe0, 0x86, 0xd7, 0x6e,
+  0xaa, 0x7c, 0x2a, 0xe6, 0xd2, 0x3a, 0x62, 0x97, 0x65, 0xd7, 0xe9, 0xad, 0x77, 0x71, 0xba, 0xbc,
+  0x51, 0xa9, 0xee, 0x9f, 0x3b, 0x0a, 0xb3, 0x7b, 0xe1, 0x85, 0x95, 0xf6, 0xcf, 0xea, 0xbe, 0xe9,
+  0x01, 0x70, 0x97, 0xae, 0xb4, 0x7f, 0xac, 0xfa, 0xa6, 0xbb, 0x67, 0xfe, 0x61, 0x69, 0xef, 0x50,
+  0x73, 0x8f, 0xce, 0xeb, 0xba, 0x0d, 0xdd, 0x6b, 0xbd, 0x0f, 0x53, 0x9c, 0xf4, 0x2d, 0x43, 0xce,
+  0x70, 0x71, 0x42, 0xaf, 0x99, 0xf9, 0xf8, 0xea, 0x27, 0x3f, 0x27, 0x1f, 0xc2, 0x17, 0x1f, 0x1a,
+  0xd8, 0x5a, 0xab, 0xa2, 0xab, 0x7c, 0x97, 0x50, 0xeb, 0x71, 0x5e, 0x5b, 0x93, 0x2f, 0xa1, 0x98,
+  0xde, 0xec, 0x3a, 0x5d, 0xcd, 0x5f, 0x5d, 0x0c, 0x8d, 0x09, 0xdf, 0xfb, 0x9a, 0xf0, 0x2b, 0x5f,
+  0x13, 0x7e, 0xb5, 0x00, 0x6f, 0x7f, 0x9d, 0xb7, 0x0e, 0x21, 0xbd, 0xe1, 0x66, 0xfc, 0x15, 0x7c,
+  0x20, 0x5f, 0xfd, 0xe4, 0x17, 0x05, 0xcb, 0x51, 0xe3, 0xe0, 0xec, 0xe4, 0xa1, 0xe9, 0xf2, 0x32,
+  0x91, 0x61, 0x2c, 0x28, 0xb2, 0xa1, 0x7f, 0x89, 0x61, 0x1f, 0xe8, 0x21, 0xb0, 0x48, 0x66, 0x39,
+  0xd9, 0x15, 0x21, 0xbd, 0x1b, 0xfb, 0xdf, 0xa7, 0xe0, 0xf7, 0x38, 0xef, 0xcf, 0xf9, 0x9f, 0xd3,
+  0x5a, 0x5e, 0x4e, 0xa8, 0xe7, 0x62, 0xf0, 0xc1, 0xce, 0xec, 0xc5, 0x89, 0x7f, 0xed, 0x0e, 0x6e,
+  0x39, 0x96, 0x49, 0x36, 0x3a, 0x8c, 0xc6, 0x2e, 0x2a, 0xf8, 0x05, 0x30, 0x31, 0x18, 0x19, 0x66,
+  0x7f, 0xf4, 0xe6, 0x64, 0x01, 0x20, 0x09, 0x15, 0x27, 0xd1, 0x67, 0x10, 0x00, 0x1d, 0x7b, 0x08,
+  0x23, 0xca, 0x50, 0x79, 0xbb, 0x97, 0xf4, 0xd9, 0x64, 0x70, 0x45, 0xb3, 0xc5, 0x07, 0x30, 0xa6,
+  0x69, 0xea, 0xe2, 0x31, 0xc4, 0x53, 0x0a, 0xeb, 0x98, 0x18, 0x28, 0xdd, 0x38, 0x36, 0xbe, 0x8f,
+  0xa9, 0x9b, 0x82, 0x12, 0x1e, 0x83, 0xdd, 0x14, 0xe5, 0x50, 0x3c, 0xdb, 0x46, 0x59, 0x94, 0x84,
+  0xed, 0x88, 0x53, 0x82, 0xe0, 0x0a, 0xed, 0xc7, 0x71, 0xc3, 0xa4, 0x37, 0x4b, 0x2e, 0xf2, 0x85,
+  0xf0, 0xfa, 0x40, 0x7c, 0x05, 0x24, 0xa9, 0xd0, 0x68, 0x32, 0x64, 0xb0, 0x80, 0xe4, 0xf0, 0xf5,
+  0x4b, 0x02, 0x41, 0x35, 0xf6, 0x95, 0x12, 0x05, 0xa6, 0x05, 0xeb, 0x00, 0xef, 0x45, 0x83, 0x09,
+  0x36, 0xe8, 0x5c, 0xd2, 0xec, 0x88, 0xb7, 0x7d, 0x76, 0x7b, 0xec, 0x35, 0x8c, 0x98, 0x5e, 0xeb,
+  0x14, 0x43, 0xf0, 0xa3, 0x80, 0xd4, 0x41, 0xb2, 0x28, 0x5d, 0x03, 0x41, 0x93, 0x30, 0x07, 0x84,
+  0x19, 0x14, 0x0d, 0x84, 0x69, 0x71, 0x80, 0xa9, 0x01, 0xe1, 0x46, 0x40, 0x83, 0x41, 0xcd, 0x3b,
+  0xa7, 0x1b, 0xa6, 0xb7, 0x35, 0x10, 0x50, 0x97, 0x08, 0x51, 0x07, 0x82, 0xba, 0x56, 0xef, 0x04,
+  0x3c, 0xad, 0x79, 0x9d, 0x60, 0x38, 0x6e, 0xcc, 0xe5, 0x7a, 0x1e, 0x08, 0x0b, 0xce, 0x35, 0x10,
+  0x1e, 0x7c, 0xd7, 0xcf, 0x5f, 0x04, 0xe8, 0x46, 0x47, 0x69, 0x36, 0xb7, 0xa3, 0xd4, 0xa0, 0x99,
+  0xe1, 0x86, 0xd5, 0x92, 0xc1, 0xf0, 0xd7, 0x8a, 0x18, 0xb8, 0x17, 0xb5, 0x00, 0x06, 0xe1, 0x6e,
+  0x15, 0x31, 0x18, 0x3e, 0xd3, 0x02, 0x88, 0x4c, 0x1f, 0xab, 0x88, 0x4f, 0xe6, 0x12, 0xe6, 0x63,
+  0x92, 0xde, 0xac, 0x86, 0x43, 0xc5, 0x43, 0x75, 0xe0, 0x79, 0xd0, 0xc4, 0x20, 0x03, 0xaa, 0xfa,
+  0x3e, 0x92, 0xfb, 0xab, 0x20, 0x9f, 0x6e, 0xc0, 0x93, 0xe1, 0x5c, 0x26, 0x59, 0xa6, 0x42, 0x09,
+  0x65, 0xbe, 0xe0, 0x3c, 0x89, 0x30, 0x67, 0xc5, 0x45, 0xa6, 0x41, 0x67, 0x14, 0x1e, 0xec, 0xcf,
+  0x85, 0x3b, 0xb3, 0x18, 0x5f, 0xc6, 0xe4, 0x73, 0x01, 0x4f, 0x6c, 0x29, 0xe3, 0x81, 0xf3, 0x5c,
+  0xb8, 0x17, 0x52, 0x6c, 0x0c, 0xc5, 0xf1, 0xd2, 0x8d, 0xd1, 0x5e, 0x90, 0x11, 0x68, 0xc5, 0xdb,
+  0x2d, 0xe7, 0x4f, 0x5f, 0xfe, 0xfa, 0xa7, 0x4e, 0x8b, 0x44, 0x57, 0xec, 0xe3, 0xcf, 0xe1, 0x63,
+  0x36, 0xf2, 0x13, 0x70, 0xf3, 0xf1, 0xfb, 0x6f, 0xff, 0x1b, 0xbe, 0x8f, 0x22, 0x54, 0xc3, 0x50,
+  0xf9, 0x6f, 0xf0, 0xc5, 0x4b, 0xa2, 0x69, 0xc8, 0x12, 0xe5, 0x58, 0xf2, 0x07, 0x47, 0xa8, 0x4d,
+  0xa0, 0xea, 0x09, 0xee, 0x25, 0xa1, 0x02, 0x64, 0xf4, 0xa5, 0xa4, 0xd1, 0xf7, 0x43, 0x5c, 0xfb,
+  0x4f, 0x68, 0xff, 0x34, 0x42, 0x5d, 0xce, 0xcf, 0xc6, 0x65, 0x23, 0x68, 0xc5, 0xce, 0x63, 0x37,
+  0xd5, 0xb0, 0x4e, 0x8e, 0x3f, 0x3e, 0xfa, 0xf4, 0xf4, 0x6c, 0xff, 0xe4, 0xe8, 0xd3, 0x97, 0xa7,
+  0x30, 0xb8, 0x5e, 0xb7, 0x8b, 0x29, 0x7f, 0xc4, 0xaa, 0x92, 0xce, 0x2c, 0x6f, 0x90, 0x92, 0xcc,
+  0xbd, 0xa2, 0x6c, 0xa3, 0x9f, 0xb8, 0x43, 0x8c, 0x72, 0x61, 0xb0, 0xa9, 0x58, 0x77, 0x30, 0xc7,
+  0x19, 0x0e, 0x62, 0x1f, 0x55, 0x6a, 0x57, 0x0e, 0xab, 0xb8, 0x45, 0xc9, 0x86, 0x27, 0x60, 0x06,
+  0x93, 0x24, 0x01, 0x92, 0x61, 0x23, 0x1e, 0x3c, 0xef, 0x12, 0x0c, 0xfb, 0x78, 0xdf, 0x87, 0x74,
+  0xe8, 0x4e, 0x82, 0x0c, 0x0f, 0xe7, 0x3d, 0x81, 0x99, 0xdd, 0xca, 0x8e, 0x20, 0x98, 0x3b, 0xe2,
+  0x11, 0x17, 0x46, 0x73, 0x00, 0x72, 0xfe, 0x96, 0x03, 0x9c, 0x02, 0xdf, 0x51, 0x96, 0x83, 0x47,
+  0x3a, 0x88, 0x01, 0xb4, 0xf9, 0xff, 0xf2, 0x83, 0x9c, 0xca, 0x1a, 0x88, 0x1a, 0x45, 0x06, 0xe9,
+  0x49, 0x9c, 0xa2, 0xb7, 0x99, 0xea, 0x8b, 0xfb, 0xf9, 0x84, 0x82, 0x88, 0x30, 0x3b, 0x10, 0x25,
+  0x10, 0x46, 0x36, 0x1c, 0xeb, 0xd8, 0xa3, 0xce, 0x1d, 0xb2, 0xe6, 0x38, 0x3f, 0xf8, 0xb5, 0x20,
+  0xaa, 0xdc, 0x23, 0xd2, 0xd0, 0x09, 0xaf, 0xb2, 0xd6, 0x4c, 0x09, 0xc7, 0x53, 0x83, 0x12, 0x3e,
+  0x50, 0x1d, 0x94, 0x74, 0x93, 0x4a, 0x86, 0xce, 0x42, 0xa6, 0x3a, 0x58, 0x33, 0xb6, 0x52, 0xa2,
+  0x2f, 0x96, 0x93, 0x11, 0x90, 0x33, 0x81, 0xc2, 0x8c, 0x1e, 0x39, 0x6b, 0x8d, 0xd4, 0x38, 0x77,
+  0x8c, 0x68, 0x0c, 0xf8, 0xda, 0x61, 0x42, 0x46, 0x4e, 0xe8, 0x35, 0x0d, 0xf0, 0x2b, 0x0a, 0x2b,
+  0x4d, 0x5c, 0x59, 0x2b, 0xb3, 0x5b, 0xce, 0x5b, 0x65, 0xd8, 0x99, 0x8f, 0x9f, 0x92, 0x53, 0x7e,
+  0xde, 0x5a, 0x0c, 0x40, 0x45, 0x5e, 0xd0, 0x49, 0x38, 0x09, 0x02, 0x39, 0xb0, 0x3c, 0x22, 0xb2,
+  0x2a, 0x54, 0xa8, 0x62, 0x95, 0xcb, 0x20, 0x82, 0xa8, 0x72, 0x74, 0x4e, 0x26, 0x21, 0xeb, 0x8c,
+  0x5d, 0x61, 0xe0, 0xfd, 0x37, 0xe4, 0xe9, 0xc3, 0xdc, 0xcc, 0x1f, 0x64, 0x37, 0x73, 0xed, 0x3c,
+  0x0f, 0x50, 0x9a, 0x58, 0x87, 0xfa, 0x1b, 0x56, 0xa2, 0xe1, 0xac, 0x08, 0x87, 0xc1, 0xb0, 0xff,
+  0x88, 0x6c, 0x9e, 0x03, 0xb0, 0x08, 0x32, 0x36, 0xcf, 0x39, 0x03, 0xcb, 0xc3, 0xb6, 0x7a, 0x5c,
+  0x48, 0x1b, 0x44, 0x35, 0xc7, 0x65, 0xa8, 0x46, 0xc5, 0x77, 0x07, 0x97, 0xc9, 0x41, 0x34, 0x1e,
+  0xa3, 0x23, 0xcf, 0x08, 0xcd, 0xb7, 0x42, 0x52, 0xe6, 0x0d, 0x0f, 0x02, 0xea, 0xa2, 0x05, 0x14,
+  0x89, 0x44, 0xe2, 0xec, 0x1f, 0x93, 0x17, 0x34, 0x88, 0xc1, 0x9a, 0x4c, 0xfd, 0x6c, 0xc4, 0xb4,
+  0x0e, 0x49, 0xf9, 0xca, 0x3b, 0xda, 0xc8, 0x06, 0x0c, 0xe1, 0x6b, 0x81, 0x69, 0x57, 0x6d, 0xb4,
+  0x25, 0x34, 0x8d, 0xa1, 0x84, 0x25, 0xfe, 0xb3, 0x64, 0x42, 0x5b, 0x6a, 0x47, 0xcf, 0x67, 0xc6,
+  0x73, 0x3f, 0x8d, 0x01, 0xd9, 0x1b, 0x3c, 0x80, 0x6c, 0x36, 0x60, 0xdb, 0x82, 0xae, 0x38, 0xd1,
+  0x7f, 0xa7, 0x42, 0x90, 0x71, 0xe4, 0x01, 0xa6, 0x25, 0x16, 0xb1, 0x2c, 0xb5, 0x54, 0x31, 0x6b,
+  0x9d, 0xb2, 0xd3, 0x69, 0xcc, 0xe4, 0xc9, 0x9a, 0x99, 0xfc, 0x10, 0x07, 0x13, 0x70, 0x91, 0x53,
+  0x1d, 0x55, 0x40, 0x2f, 0x29, 0xee, 0xff, 0xdd, 0x69, 0xe1, 0x52, 0x9e, 0x3f, 0x45, 0x2c, 0x8c,
+  0x54, 0x2f, 0x50, 0xa2, 0x78, 0x5b, 0xd4, 0x87, 0xa9, 0x0b, 0xca, 0x9e, 0xa5, 0x51, 0x15, 0xd8,
+  0x2c, 0x1f, 0x47, 0x16, 0x45, 0x41, 0xe6, 0xc7, 0x26, 0xd2, 0x7c, 0xb3, 0xf1, 0x80, 0xe7, 0x14,
+  0x97, 0xc4, 0x7d, 0x11, 0x22, 0xfe, 0xdf, 0xd9, 0x6c, 0x6a, 0x73, 0x31, 0x76, 0xd8, 0xf5, 0x62,
+  0x96, 0x61, 0xc1, 0xeb, 0x35, 0x80, 0x9e, 0xc8, 0xe3, 0xbc, 0x2d, 0x22, 0x77, 0xa5, 0x97, 0xfa,
+  0x51, 0xe0, 0x2d, 0xe9, 0xa3, 0xe1, 0xf7, 0x79, 0x2c, 0x88, 0x55, 0xb3, 0x85, 0x98, 0x31, 0x1b,
+  0x59, 0x2a, 0xe6, 0x9d, 0xcf, 0xcc, 0x26, 0xa3, 0x76, 0x58, 0x3c, 0x9f, 0xa1, 0x37, 0x49, 0x44,
+  0xd9, 0x6a, 0xb7, 0xcb, 0x6d, 0x17, 0x18, 0x24, 0x9a, 0xb4, 0x48, 0x0a, 0x66, 0x17, 0xcc, 0x5e,
+  0x42, 0x26, 0x31, 0xd8, 0x05, 0x9a, 0x3e, 0xd0, 0xd1, 0xce, 0x04, 0x3b, 0x1a, 0x9a, 0x83, 0x4e,
+  0xb9, 0x7a, 0x69, 0x08, 0x79, 0x6e, 0xa9, 0x7e, 0xd8, 0xee, 0x1f, 0x71, 0xf0, 0xf0, 0x90, 0x23,
+  0x87, 0x83, 0xc6, 0x66, 0x2b, 0xbf, 0x34, 0x22, 0x6e, 0x91, 0xc0, 0x34, 0xce, 0xdf, 0xb6, 0xf2,
+  0x42, 0x6c, 0x95, 0xd2, 0x0c, 0x8b, 0xb5, 0xa6, 0xa2, 0x31, 0xa0, 0xb4, 0x34, 0xa2, 0x4e, 0x1c,
+  0x86, 0x1f, 0x90, 0x19, 0x24, 0xc5, 0x3d, 0x6d, 0xb9, 0x92, 0x8f, 0x36, 0x9f, 0xad, 0xad, 0xf7,
+  0x56, 0x8d, 0xe5, 0xab, 0x58, 0xef, 0xde, 0xea, 0xd3, 0x16, 0xd9, 0x80, 0xff, 0x7a, 0x4f, 0x71,
+  0xcd, 0x7b, 0xe6, 0x9a, 0x73, 0xb4, 0x9f, 0x88, 0x03, 0xb6, 0xc6, 0xb2, 0x53, 0x90, 0x1f, 0xa4,
+  0x6e, 0xb7, 0xb3, 0xa6, 0x97, 0x83, 0x51, 0x0f, 0x4c, 0x99, 0xe1, 0x57, 0x20, 0x40, 0x16, 0xde,
+  0xc8, 0x7b, 0x4e, 0x85, 0x9a, 0x17, 0xe8, 0x41, 0xc8, 0xea, 0xf5, 0x7c, 0xa1, 0xdf, 0x12, 0x7b,
+  0xa9, 0x85, 0x56, 0xd0, 0x17, 0xba, 0xd3, 0xe9, 0x18, 0x72, 0x9e, 0x63, 0x67, 0x37, 0xca, 0x52,
+  0x93, 0xed, 0x6f, 0x8c, 0x95, 0x91, 0x87, 0x5a, 0xb0, 0xd0, 0x92, 0x32, 0x83, 0x1f, 0x91, 0xcd,
+  0x07, 0x57, 0x16, 0x2a, 0x71, 0x28, 0xf2, 0x4d, 0x94, 0x09, 0x46, 0x5b, 0x5b, 0x6f, 0xd9, 0xd5,
+  0x7e, 0x58, 0x57, 0x8d, 0x27, 0x66, 0x4e, 0xaf, 0x50, 0x32, 0x6d, 0x82, 0x09, 0xdc, 0x67, 0xd8,
+  0xeb, 0x89, 0x3f, 0xf6, 0xf1, 0x60, 0x76, 0x8b, 0x3b, 0x35, 0xa3, 0x68, 0x8a, 0x55, 0x64, 0x53,
+  0xf0, 0x95, 0x05, 0x35, 0x34, 0x05, 0xab, 0xab, 0xc4, 0xc5, 0x14, 0x1e, 0x4b, 0x45, 0x10, 0x72,
+  0x5b, 0x20, 0x0c, 0x93, 0x6c, 0x83, 0x32, 0x6c, 0x94, 0xec, 0x7c, 0x8b, 0x64, 0xd0, 0x8f, 0xd9,
+  0xf6, 0x51, 0xcb, 0xee, 0x75, 0xa5, 0xa8, 0x00, 0x6c, 0x82, 0x4a, 0xb2, 0x0f, 0x2a, 0xb4, 0x4f,
+  0x77, 0xbd, 0xb9, 0x54, 0xb5, 0x08, 0x76, 0x77, 0x3d, 0x44, 0xff, 0xa0, 0x6c, 0x92, 0x33, 0x53,
+  0xb8, 0xa5, 0xb1, 0x31, 0xed, 0xbf, 0x12, 0x6f, 0x69, 0x62, 0xff, 0x12, 0xf2, 0x6d, 0x38, 0x38,
+  0xf7, 0x93, 0xee, 0xe7, 0xcf, 0x0f, 0x9f, 0x74, 0xbb, 0x8b, 0x48, 0xf7, 0xca, 0xfa, 0x7a, 0x8b,
+  0xac, 0xf4, 0xd6, 0x05, 0x4d, 0xbf, 0x95, 0xee, 0xbf, 0x62, 0xe9, 0xfe, 0xff, 0x92, 0x63, 0xce,
+  0x88, 0x7f, 0xa3, 0x82, 0x6c, 0xf8, 0xeb, 0x4a, 0x8e, 0x85, 0x77, 0xfb, 0x97, 0x10, 0x63, 0x23,
+  0x30, 0xb9, 0xaf, 0x18, 0x6f, 0xac, 0xae, 0x3d, 0x59, 0x58, 0x8c, 0x9f, 0x82, 0x81, 0x7e, 0xd2,
+  0xfb, 0x56, 0x8c, 0xbf, 0x15, 0xe3, 0x52, 0x31, 0xfe, 0xe3, 0x1f, 0x0e, 0xfe, 0xf6, 0xc4, 0x57,
+  0x85, 0xd5, 0xba, 0xf4, 0xf2, 0x78, 0xf2, 0x2f, 0x21, 0xbc, 0x2a, 0x8d, 0x70, 0x4f, 0xc9, 0x5d,
+  0xdb, 0x7f, 0xda, 0x3d, 0x5a, 0x59, 0x44, 0x72, 0x9f, 0x40, 0x28, 0xd4, 0x5b, 0x83, 0xbf, 0x56,
+  0x56, 0x36, 0xbe, 0x15, 0xdd, 0x6f, 0x45, 0xb7, 0x54, 0x74, 0xdf, 0xfb, 0xeb, 0x10, 0x5c, 0xb3,
+  0x69, 0x9f, 0x5e, 0xfa, 0xe1, 0x7e, 0xf6, 0x43, 0x9a, 0x44, 0x65, 0xe4, 0x03, 0xe2, 0x21, 0x4d,
+  0xba, 0x0b, 0x4a, 0x3b, 0x7e, 0xe6, 0x89, 0xba, 0xfc, 0xd4, 0xac, 0x48, 0x4c, 0x8b, 0x0c, 0x1b,
+  0xdb, 0x5b, 0x3b, 0x83, 0x62, 0x96, 0xa8, 0x99, 0xc9, 0xc4, 0x1b, 0x3f, 0x01, 0x4b, 0x3d, 0x06,
+  0x76, 0xec, 0x59, 0x69, 0x39, 0xa3, 0xf6, 0xc3, 0x24, 0x02, 0xe9, 0xa0, 0xa5, 0x19, 0x3a, 0xec,
+  0x6a, 0x92, 0x3e, 0x8f, 0x92, 0x06, 0x4b, 0x5c, 0xb7, 0x78, 0x0a, 0x5a, 0x26, 0xeb, 0xfc, 0x21,
+  0x69, 0x3c, 0xe4, 0x49, 0xe9, 0x1f, 0xff, 0x98, 0xa7, 0xb6, 0xc9, 0x2e, 0x47, 0xd3, 0x24, 0x09,
+  0x05, 0xe3, 0x8e, 0x47, 0xe0, 0x39, 0x0e, 0x58, 0xaf, 0x49, 0x78, 0x15, 0x46, 0xd3, 0x90, 0x25,
+  0xdb, 0x25, 0x38, 0x07, 0xda, 0xe1, 0x78, 0x3b, 0xc0, 0x97, 0x65, 0x80, 0x41, 0x34, 0x2d, 0x01,
+  0xda, 0x93, 0x40, 0xee, 0x4d, 0x19, 0xd0, 0x08, 0xd8, 0x40, 0x41, 0x15, 0xab, 0xa3, 0x2b, 0x51,
+  0x29, 0x09, 0xac, 0x12, 0xdb, 0xc6, 0xfc, 0x21, 0x6a, 0x64, 0x69, 0xd8, 0x06, 0x4b, 0x52, 0xe9,
+  0x13, 0x67, 0x05, 0x30, 0xf2, 0x6e, 0x93, 0xf0, 0x8f, 0xbb, 0x56, 0xe6, 0xbb, 0x13, 0xd0, 0xf0,
+  0x32, 0x1b, 0x91, 0xb6, 0xbc, 0x5e, 0x9c, 0x43, 0xed, 0x55, 0xb4, 0xcd, 0x51, 0x89, 0x3b, 0x09,
+  0x56, 0x26, 0x98, 0xd5, 0x0a, 0x1b, 0x60, 0x21, 0x18, 0x46, 0xc9, 0x91, 0x3b, 0x18, 0x35, 0x1a,
+  0x2c, 0x91, 0xde, 0x22, 0x7e, 0x93, 0xec, 0xee, 0x29, 0xbd, 0xc0, 0x1f, 0x15, 0x60, 0x5b, 0xfd,
+  0xb8, 0xd9, 0xd5, 0xe1, 0x87, 0x97, 0x1a, 0x8e, 0x38, 0xf9, 0x00, 0xcd, 0x61, 0xe1, 0x76, 0x8d,
+  0xee, 0xe4, 0xbb, 0x27, 0x32, 0x67, 0x59, 0x48, 0xc7, 0xe7, 0x5d, 0xaa, 0x84, 0xbb, 0xdd, 0x6d,
+  0x7e, 0x2d, 0xf9, 0xcf, 0xd1, 0x35, 0xcb, 0x7b, 0x77, 0x50, 0xf8, 0x0f, 0xf8, 0x11, 0x48, 0x24,
+  0x79, 0x9e, 0x10, 0x3f, 0xd7, 0x51, 0xbc, 0x95, 0x54, 0xe2, 0x3b, 0x4d, 0xac, 0x2f, 0x49, 0x45,
+  0x93, 0x72, 0x36, 0x98, 0x96, 0x06, 0x45, 0xdc, 0x4c, 0x76, 0x34, 0xf8, 0x8e, 0x30, 0x8e, 0x1d,
+  0x56, 0xcb, 0x9b, 0xb3, 0x9c, 0xbd, 0x95, 0xfd, 0xe6, 0xcb, 0xad, 0x50, 0xc0, 0x0c, 0xc5, 0xce,
+  0xb4, 0x6a, 0xa9, 0x52, 0x65, 0xbc, 0x39, 0x45, 0xed, 0x5e, 0x80, 0x11, 0x5b, 0xd3, 0x0a, 0x28,
+  0x8f, 0xc0, 0xeb, 0xa0, 0xf8, 0xe6, 0xb4, 0x02, 0x52, 0xde, 0x7e, 0x1d, 0x0c, 0xdb, 0x9d, 0x56,
+  0x20, 0xd2, 0xc3, 0xb0, 0xa6, 0xd2, 0x04, 0xd5, 0xc1, 0xb6, 0x99, 0xa2, 0x49, 0xd6, 0x68, 0xb0,
+  0xb5, 0xe6, 0x77, 0x07, 0x12, 0x8a, 0x2a, 0xb1, 0xd1, 0x6c, 0xa1, 0x72, 0xcb, 0x15, 0x97, 0xd8,
+  0x52, 0xe9, 0xb8, 0x9e, 0x77, 0x74, 0x0d, 0x44, 0x46, 0x0e, 0xa0, 0x21, 0x4d, 0x1a, 0xce, 0x20,
+  0x00, 0x9d, 0x0a, 0xab, 0xcf, 0x91, 0xe4, 0x72, 0x66, 0x70, 0x3c, 0x88, 0x0e, 0xbf, 0x02, 0x25,
+  0x36, 0x59, 0xde, 0x15, 0xcf, 0x07, 0x12, 0xcf, 0xa2, 0x5c, 0xcc, 0x85, 0x5d, 0x71, 0xb2, 0x76,
+  0xbd, 0x7e, 0xe1, 0x01, 0x70, 0x1c, 0x9c, 0x14, 0xf9, 0x39, 0x0a, 0x79, 0x6b, 0x5c, 0xdc, 0x93,
+  0xd6, 0x75, 0x0d, 0x2f, 0x12, 0x0d, 0xd4, 0x86, 0x48, 0x71, 0x1b, 0xf8, 0xa1, 0x55, 0xb4, 0xad,
+  0xb7, 0x33, 0xb6, 0xb2, 0x4b, 0xa4, 0x4e, 0x5e, 0xd7, 0xc5, 0x0d, 0x51, 0x13, 0x4d, 0xd3, 0xc0,
+  0xc3, 0xf7, 0xd6, 0x2d, 0x61, 0xb3, 0xc7, 0xf2, 0x5d, 0x70, 0x05, 0xd9, 0x89, 0x32, 0x4c, 0x6b,
+  0xc1, 0xc4, 0x1d, 0xbe, 0xee, 0xc4, 0x3c, 0x0b, 0x50, 0x43, 0x33, 0x63, 0xca, 0x6c, 0x00, 0x66,
+  0xf7, 0x35, 0xd4, 0xa6, 0xda, 0xf2, 0xd0, 0x0e, 0x00, 0xc5, 0x60, 0xc7, 0x62, 0xf7, 0x92, 0x39,
+  0x35, 0x0d, 0x31, 0x19, 0x8b, 0xa4, 0x72, 0x2d, 0xe4, 0x0e, 0x7a, 0x71, 0x57, 0x15, 0xdf, 0xff,
+  0xd2, 0xd7, 0x84, 0x97, 0x3e, 0xbb, 0x55, 0x3b, 0xab, 0x0d, 0x71, 0x48, 0xb5, 0xc4, 0x12, 0x72,
+  0x3c, 0x4c, 0x96, 0xf0, 0x9c, 0xac, 0xb2, 0x49, 0x02, 0x62, 0x3b, 0x3f, 0xd1, 0x2a, 0xf6, 0x16,
+  0xa3, 0x29, 0xd0, 0xf4, 0x10, 0x6c, 0x79, 0x07, 0x3e, 0xca, 0x21, 0xf3, 0xfd, 0xbf, 0x2c, 0x1a,
+  0x0e, 0x35, 0x80, 0x74, 0xea, 0x67, 0xc0, 0xa2, 0x46, 0x97, 0xc8, 0xcc, 0x20, 0xc7, 0xec, 0xe4,
+  0xf1, 0x96, 0x72, 0x21, 0x38, 0x28, 0xea, 0x21, 0xc0, 0xde, 0x26, 0x8d, 0x95, 0x35, 0xf2, 0x3e,
+  0xd9, 0xe8, 0xca, 0xbf, 0x70, 0x4b, 0x5a, 0xdd, 0x29, 0x04, 0x67, 0x25, 0xa1, 0xae, 0x7a, 0x4d,
+  0x86, 0xa3, 0x5b, 0xf5, 0x6a, 0xb0, 0xad, 0x02, 0x8a, 0x7b, 0x63, 0x7c, 0x52, 0x87, 0xf1, 0xc9,
+  0xfd, 0x30, 0x7a, 0x7c, 0x2f, 0x3b, 0xc7, 0x57, 0x46, 0x63, 0xed, 0xee, 0x9c, 0x59, 0xdd, 0xe1,
+  0xcb, 0xd9, 0xa0, 0xc8, 0x3a, 0x94, 0x5d, 0x24, 0x05, 0x7f, 0x60, 0x1c, 0xbf, 0x9a, 0x8c, 0x99,
+  0x49, 0x66, 0x63, 0x6b, 0x4a, 0x26, 0x16, 0x3c, 0x22, 0xef, 0x7d, 0x06, 0x83, 0x49, 0xc0, 0x98,
+  0xcb, 0x60, 0x10, 0x59, 0x4e, 0x59, 0x33, 0xc9, 0x1d, 0x3a, 0x5b, 0xc8, 0xbe, 0x85, 0x37, 0x80,
+  0xfc, 0xd1, 0xcd, 0xd7, 0x50, 0x9d, 0xd6, 0xb0, 0x44, 0xcd, 0xf9, 0xea, 0x8b, 0x5f, 0x39, 0xdb,
+  0x79, 0x23, 0x7e, 0x34, 0x63, 0x4e, 0x23, 0x71, 0x0e, 0x63, 0x4e, 0x2b, 0x76, 0xe6, 0xa2, 0xae,
+  0x0d, 0x27, 0x5a, 0x81, 0x96, 0xf9, 0xd6, 0xec, 0xc7, 0xfc, 0x10, 0xc3, 0xae, 0xa2, 0xeb, 0xd8,
+  0x8d, 0x25, 0x51, 0xb1, 0xfe, 0xd3, 0xc4, 0x9d, 0x36, 0x25, 0xb1, 0xaf, 0xb1, 0xfc, 0x9a, 0x3c,
+  0x14, 0x7e, 0xa1, 0xbd, 0x9b, 0x5a, 0x87, 0x0b, 0xeb, 0x3f, 0x1d, 0x54, 0x60, 0x22, 0xdf, 0xf9,
+  0x0e, 0x7c, 0xd9, 0x23, 0xed, 0xf5, 0x6e, 0x71, 0xbf, 0xb7, 0x0e, 0x2b, 0x6b, 0xb0, 0xe8, 0x10,
+  0xc1, 0x0e, 0xd6, 0xe1, 0x82, 0xea, 0xfa, 0xe1, 0xe1, 0x62, 0x17, 0x24, 0x1f, 0x16, 0x01, 0x9d,
+  0x8a, 0x24, 0x41, 0x08, 0xf8, 0x07, 0xac, 0xa7, 0x37, 0x19, 0xd0, 0x46, 0xc3, 0x6d, 0x91, 0x3e,
+  0xd3, 0x6b, 0x2e, 0x98, 0xac, 0x7e, 0x0b, 0x19, 0x65, 0x99, 0x35, 0xe0, 0xcc, 0xa3, 0x21, 0x42,
+  0xce, 0xca, 0x97, 0x42, 0xb9, 0x8f, 0x4a, 0x35, 0xe8, 0x47, 0x81, 0xa0, 0xaf, 0x97, 0x6e, 0x36,
+  0xea, 0xb0, 0x30, 0xbb, 0x01, 0x85, 0x1a, 0x64, 0x7e, 0xc3, 0xb8, 0x8a, 0x13, 0x45, 0x79, 0xb1,
+  0x19, 0x33, 0x2e, 0xaf, 0xdc, 0x31, 0x3b, 0x6d, 0xa2, 0x5d, 0x8a, 0x91, 0x2d, 0x71, 0x88, 0x72,
+  0x04, 0x3b, 0xa4, 0xb7, 0x0e, 0x52, 0x6d, 0x43, 0x33, 0xd3, 0x04, 0x4a, 0xbe, 0xe1, 0xf4, 0x5d,
+  0xb5, 0x3b, 0xae, 0x39, 0x28, 0x12, 0x7c, 0x8f, 0xac, 0xf6, 0x6a, 0xc1, 0xf1, 0xb6, 0xad, 0x05,
+  0x5f, 0xd9, 0xf6, 0x52, 0x9d, 0x29, 0x34, 0xd8, 0x1b, 0xfb, 0xcb, 0x19, 0xb2, 0x9a, 0xa2, 0x28,
+  0x89, 0x9c, 0x2c, 0x5a, 0xf3, 0x26, 0x18, 0xd8, 0xe7, 0xfe, 0x0d, 0xf5, 0x1a, 0xbd, 0xe6, 0x3c,
+  0xa9, 0x95, 0x38, 0x3e, 0xe0, 0xc9, 0xa7, 0x62, 0xf3, 0x05, 0x09, 0xcb, 0x90, 0x00, 0x61, 0x37,
+  0x31, 0xf8, 0x92, 0xdf, 0xf7, 0xc8, 0xca, 0x46, 0xd3, 0xc6, 0x35, 0x8f, 0x4e, 0xe5, 0x6d, 0x6b,
+  0xe8, 0xa4, 0xc9, 0x58, 0x35, 0xa1, 0x78, 0x82, 0xbc, 0xc0, 0x7b, 0x1a, 0xac, 0xc1, 0x7c, 0xe5,
+  0xca, 0x4b, 0x56, 0x94, 0x34, 0x5c, 0x90, 0x4c, 0x7c, 0x18, 0x3b, 0x64, 0xb3, 0xdb, 0x15, 0x84,
+  0xe2, 0x25, 0x40, 0x29, 0xc9, 0x92, 0x06, 0xc6, 0x79, 0xc4, 0xaa, 0x68, 0x5c, 0x43, 0x2d, 0xa5,
+  0x43, 0xaa, 0x69, 0x05, 0x3a, 0xb9, 0x48, 0x29, 0x05, 0x67, 0xd0, 0xa9, 0x4c, 0x7d, 0x0b, 0x0c,
+  0x1f, 0x60, 0x4e, 0xa4, 0xd0, 0x74, 0x41, 0x3a, 0x21, 0x82, 0x1d, 0xb2, 0xce, 0x29, 0xa2, 0x41,
+  0xce, 0xa3, 0x47, 0x69, 0x53, 0x9b, 0x1a, 0x9a, 0x3d, 0x65, 0x87, 0xcd, 0x52, 0xb0, 0xba, 0x01,
+  0x3a, 0x5b, 0xec, 0xd0, 0x36, 0x4d, 0xf0, 0xc6, 0xbf, 0x1b, 0x0e, 0x4c, 0x87, 0x98, 0x35, 0xa2,
+  0xd8, 0x3e, 0xf7, 0xba, 0x20, 0xd8, 0xff, 0x10, 0x53, 0x73, 0xa8, 0x8f, 0x57, 0xba, 0xdd, 0x1a,
+  0x43, 0xbb, 0xb3, 0x9b, 0x37, 0x9e, 0xeb, 0x8b, 0x81, 0x7b, 0x19, 0xcb, 0x05, 0x18, 0x50, 0x3f,
+  0xb0, 0x91, 0x2d, 0x6b, 0xb8, 0x74, 0xf3, 0xc0, 0x87, 0xe8, 0xf1, 0xc3, 0x73, 0x39, 0x52, 0x9c,
+  0x55, 0x03, 0x3d, 0x39, 0x9f, 0x85, 0xf2, 0xf0, 0xcf, 0x0e, 0x31, 0x31, 0x62, 0xd9, 0x07, 0xbb,
+  0xac, 0xdf, 0x9c, 0x1d, 0x04, 0xb6, 0x4e, 0x3c, 0x49, 0x47, 0x72, 0x04, 0xe7, 0xfe, 0xdb, 0x72,
+  0xae, 0x12, 0x8d, 0xcf, 0x25, 0x50, 0x9e, 0x6d, 0x78, 0x0b, 0x36, 0x48, 0x59, 0xab, 0x73, 0x6b,
+  0x26, 0x58, 0x3f, 0xa7, 0xc7, 0x32, 0x88, 0x2a, 0xcf, 0x4a, 0x20, 0xb0, 0x7c, 0x26, 0x71, 0xe7,
+  0x2f, 0x8b, 0xf0, 0xda, 0x9f, 0xb1, 0xa6, 0xfc, 0xa0, 0xeb, 0x59, 0x04, 0xe5, 0x0d, 0x7d, 0xf1,
+  0xcc, 0xc3, 0x88, 0x55, 0xce, 0x52, 0x40, 0x93, 0xac, 0xe1, 0xbc, 0x8a, 0xf8, 0x01, 0x4d, 0x40,
+  0xcf, 0xd1, 0x3d, 0xcc, 0xb9, 0xb2, 0xd6, 0x77, 0xe1, 0x86, 0x9a, 0x9f, 0xa5, 0x2d, 0x38, 0xf6,
+  0xe6, 0x08, 0x5a, 0x85, 0x33, 0x95, 0xba, 0x19, 0xc7, 0x74, 0x11, 0xb8, 0xa5, 0x19, 0x65, 0xf3,
+  0x13, 0xaf, 0x7c, 0xe1, 0x8a, 0x50, 0xf1, 0x5e, 0x69, 0x4a, 0xdc, 0x94, 0xbc, 0x39, 0xda, 0x3f,
+  0x3c, 0x7e, 0xf5, 0xbd, 0x4f, 0x9f, 0x1f, 0x1f, 0x9d, 0x1c, 0x9e, 0x42, 0x10, 0x49, 0xde, 0x50,
+  0x76, 0x69, 0xbd, 0x33, 0x6a, 0xe1, 0x19, 0xa6, 0x94, 0x39, 0xff, 0xcd, 0xdc, 0xed, 0x4f, 0xaf,
+  0x51, 0x44, 0xcf, 0xa4, 0x5b, 0xda, 0xc2, 0xea, 0x16, 0x1a, 0xb1, 0x16, 0x53, 0x3a, 0x2d, 0x6d,
+  0xd3, 0xac, 0x25, 0x73, 0xf0, 0xad, 0x97, 0x20, 0x6a, 0x3f, 0x0a, 0x1d, 0x73, 0x74, 0xfb, 0x9e,
+  0xc7, 0x69, 0x94, 0x44, 0x53, 0x7e, 0xd2, 0x41, 0xce, 0x5d, 0xc5, 0xbb, 0x54, 0x4f, 0xd4, 0x88,
+  0x5b, 0x00, 0x38, 0xa3, 0xdd, 0x82, 0x67, 0x4c, 0xba, 0x10, 0xe9, 0xe1, 0x3e, 0x03, 0x8e, 0xa7,
+  0x61, 0xd6, 0xa2, 0xe1, 0x3b, 0x3e, 0x7d, 0x7d, 0x9a, 0x61, 0xe8, 0x04, 0x2b, 0x0a, 0x91, 0xe0,
+  0xab, 0xe5, 0x7d, 0xa5, 0x5b, 0x70, 0x4a, 0xc0, 0xe6, 0x17, 0x8f, 0xef, 0x4c, 0xb0, 0x59, 0xcb,
+  0x79, 0x7c, 0x87, 0xdd, 0xcd, 0x9c, 0x16, 0xd6, 0x49, 0xaf, 0x71, 0xc6, 0xbe, 0x29, 0x0f, 0x8d,
+  0x7f, 0xe5, 0x6e, 0x20, 0xff, 0x3c, 0x12, 0xb0, 0xb4, 0x83, 0x87, 0x80, 0x67, 0xce, 0x8f, 0xc2,
+  0x0b, 0x33, 0x59, 0x24, 0x29, 0x70, 0x18, 0x4d, 0x43, 0x7c, 0x23, 0x40, 0x5b, 0xfe, 0x7e, 0x10,
+  0xf5, 0xc5, 0x8e, 0xc9, 0x33, 0xf8, 0xd8, 0x38, 0x87, 0xd1, 0xbd, 0x6d, 0x91, 0x3b, 0xb1, 0x53,
+  0xb2, 0x84, 0x3a, 0x75, 0x19, 0xca, 0x96, 0xf2, 0xcc, 0x13, 0x83, 0x9b, 0x24, 0xe8, 0x42, 0x4d,
+  0x21, 0xa0, 0x8f, 0xa6, 0x9d, 0x8f, 0xde, 0x9c, 0x74, 0x06, 0x6c, 0xed, 0x5f, 0xf7, 0xf1, 0xd2,
+  0x07, 0x7c, 0x6f, 0x20, 0x62, 0x03, 0xc2, 0xd5, 0xcf, 0xf4, 0xf1, 0xd6, 0xe2, 0x58, 0x5f, 0x63,
+  0xc9, 0x5d, 0x12, 0x4d, 0xdd, 0xce, 0x28, 0xa1, 0x18, 0x0a, 0x01, 0x7e, 0x59, 0xe2, 0x89, 0x51,
+  0x43, 0xe9, 0x05, 0xcb, 0xec, 0xb2, 0x87, 0x1f, 0xda, 0x8f, 0xef, 0x6c, 0x6e, 0x9c, 0x41, 0x59,
+  0x1e, 0x3a, 0xce, 0x3a, 0x30, 0xec, 0x0b, 0x89, 0x84, 0xc5, 0xc8, 0x32, 0x9e, 0xd4, 0x86, 0x9d,
+  0xd0, 0xeb, 0xe8, 0x4a, 0x1b, 0x36, 0xf4, 0xab, 0x07, 0x3b, 0xea, 0x0c, 0x7a, 0x4d, 0xd8, 0xad,
+  0x89, 0x6f, 0x21, 0x8e, 0x16, 0xe7, 0x92, 0xf9, 0x1d, 0x21, 0x76, 0x49, 0xa4, 0xee, 0xb4, 0xae,
+  0x7d, 0xcf, 0xb4, 0xa9, 0x18, 0x13, 0xef, 0xb1, 0x2a, 0xd6, 0xec, 0x2f, 0x90, 0xf4, 0xb9, 0xcb,
+  0x9f, 0x21, 0xb1, 0x4f, 0x41, 0x23, 0xb8, 0x4c, 0xd8, 0xb1, 0xe8, 0x59, 0x05, 0x92, 0xef, 0x36,
+  0x34, 0xec, 0xae, 0xaf, 0x19, 0xbb, 0x84, 0x8e, 0xa3, 0xeb, 0x3c, 0x99, 0x99, 0x1b, 0x6a, 0xec,
+  0xd8, 0xb2, 0x89, 0xb2, 0xcd, 0xb6, 0x79, 0x53, 0x0f, 0xe8, 0xf7, 0x86, 0xb6, 0x13, 0x76, 0xdd,
+  0x87, 0x1f, 0xcb, 0x54, 0x6a, 0x8a, 0x1d, 0xbf, 0x16, 0x6f, 0xf6, 0xb1, 0x33, 0x77, 0x87, 0x7c,
+  0x1f, 0xe4, 0x13, 0x68, 0xc5, 0xcc, 0xa2, 0xa9, 0xb3, 0x8c, 0xb4, 0xa9, 0x96, 0x73, 0x3a, 0x41,
+  0x86, 0x8a, 0xd5, 0xfe, 0x81, 0x7d, 0x7f, 0x87, 0x6d, 0x1e, 0xbc, 0x61, 0x9c, 0xe8, 0xf5, 0x61,
+  0x46, 0x43, 0x71, 0x61, 0x87, 0x95, 0xf3, 0xe1, 0x1a, 0xed, 0x3a, 0x51, 0xd8, 0x70, 0xae, 0xc5,
+  0xb9, 0x87, 0x34, 0xc4, 0x73, 0xf8, 0x72, 0x0d, 0x8c, 0xcd, 0x08, 0xac, 0xea, 0x40, 0x3b, 0x58,
+  0x24, 0xf0, 0xbb, 0xee, 0x44, 0x26, 0x5e, 0xbb, 0x0b, 0xd4, 0xf1, 0x43, 0x58, 0xcd, 0x17, 0x67,
+  0x2f, 0x4f, 0x50, 0xed, 0x39, 0xba, 0x00, 0x41, 0xab, 0x01, 0x1d, 0x45, 0x81, 0x75, 0x95, 0xc4,
+  0x14, 0x25, 0x87, 0xef, 0xba, 0x49, 0x8a, 0x6a, 0x30, 0x1d, 0xb1, 0x17, 0xa1, 0xb0, 0xea, 0x75,
+  0x56, 0xe4, 0x7b, 0x30, 0x8a, 0x22, 0xf0, 0x64, 0x6e, 0xa3, 0x49, 0xc2, 0x07, 0xe7, 0x14, 0x07,
+  0xea, 0xc6, 0x31, 0xac, 0xcf, 0xc1, 0xc8, 0x0f, 0xbc, 0x86, 0x86, 0x4a, 0x6e, 0xc7, 0x72, 0x91,
+  0xea, 0x08, 0xbb, 0xd9, 0xc8, 0xa9, 0x90, 0x73, 0x4e, 0xe3, 0xdc, 0xf7, 0x40, 0xe9, 0xbf, 0x6d,
+  0x16, 0xb5, 0x2e, 0xcc, 0x62, 0xe1, 0x39, 0xb2, 0x9d, 0x46, 0x35, 0xbb, 0xfc, 0x85, 0x29, 0x2c,
+  0x35, 0xe7, 0x15, 0x77, 0xf0, 0x35, 0x79, 0xa4, 0x7c, 0xde, 0xaa, 0x6a, 0x4a, 0x00, 0xad, 0xf1,
+  0x8e, 0xe1, 0xde, 0x5c, 0x33, 0x6b, 0x19, 0x44, 0x03, 0x37, 0x38, 0xe5, 0x37, 0xda, 0xf0, 0x20,
+  0xf2, 0x31, 0xa8, 0x64, 0x8d, 0x4b, 0x8e, 0x95, 0xaf, 0xc7, 0x1d, 0x13, 0x04, 0x82, 0xf0, 0x37,
+  0xa7, 0xc3, 0x39, 0x2b, 0xd3, 0xfc, 0x0e, 0x7d, 0x24, 0x72, 0x36, 0xac, 0x8d, 0x1c, 0x6a, 0x71,
+  0xff, 0xaa, 0xba, 0x3a, 0xdf, 0xc0, 0x2a, 0xf4, 0xa8, 0x79, 0xa0, 0x7c, 0x66, 0x06, 0x09, 0x8a,
+  0x7a, 0x65, 0x84, 0x3a, 0xc2, 0x52, 0x2c, 0x9c, 0x14, 0xbe, 0x27, 0xf1, 0xeb, 0xc3, 0xd6, 0x36,
+  0x76, 0xec, 0x29, 0xfb, 0xfa, 0x7c, 0x8b, 0xd3, 0xf1, 0xef, 0x31, 0x17, 0x5f, 0x4e, 0x84, 0x98,
+  0x2b, 0x91, 0x96, 0xad, 0x44, 0x0b, 0x50, 0xeb, 0xb6, 0x70, 0xc6, 0x3d, 0xf5, 0xea, 0x91, 0xe4,
+  0x3b, 0x16, 0xa4, 0x7e, 0x63, 0xb0, 0x64, 0x04, 0x5c, 0xff, 0x55, 0xb2, 0x03, 0xd3, 0x3f, 0x86,
+  0x52, 0x49, 0x97, 0xd9, 0x3f, 0xbd, 0x65, 0xd5, 0x1a, 0xd4, 0x2b, 0xcc, 0xa3, 0xa1, 0x65, 0x5e,
+  0x66, 0xa6, 0xfa, 0xfa, 0x88, 0xa9, 0x3e, 0x75, 0x88, 0xbd, 0xa8, 0x22, 0x0d, 0x07, 0xb3, 0x52,
+  0x51, 0x32, 0x0d, 0x69, 0x7a, 0x9c, 0x35, 0xae, 0xa6, 0x79, 0x9f, 0xcb, 0xd6, 0x19, 0xea, 0xad,
+  0x02, 0x27, 0x7f, 0x06, 0x11, 0x2f, 0xcc, 0x95, 0x6a, 0x34, 0x22, 0x2e, 0x3a, 0x16, 0x53, 0x6e,
+  0xbf, 0xcb, 0x83, 0x35, 0x71, 0x4b, 0xcf, 0x6e, 0xf3, 0x89, 0xeb, 0x67, 0x32, 0x4c, 0x62, 0x53,
+  0x65, 0x97, 0x8f, 0x98, 0xae, 0x2a, 0xbc, 0xc2, 0xd4, 0x71, 0xb6, 0xff, 0x8a, 0x93, 0x8a, 0x32,
+  0x61, 0xc5, 0xcf, 0xad, 0x80, 0xa8, 0x68, 0x67, 0x49, 0xe1, 0x5b, 0x7e, 0x20, 0x0d, 0xbe, 0xc8,
+  0xcd, 0xa7, 0xa6, 0x76, 0xae, 0xe1, 0x5c, 0x01, 0xb7, 0x34, 0xd0, 0x56, 0x0e, 0xd8, 0x52, 0x60,
+  0x6f, 0x95, 0xd6, 0x1d, 0x8c, 0x74, 0x75, 0xcb, 0x84, 0x79, 0xc4, 0xfc, 0x81, 0x0e, 0x3f, 0xf7,
+  0xa2, 0xc5, 0x6d, 0x66, 0xb5, 0x3c, 0x01, 0x73, 0xde, 0x7d, 0xcb, 0x3e, 0x97, 0x35, 0xe4, 0x9c,
+  0xd6, 0xd0, 0x52, 0xd5, 0x33, 0xf5, 0x79, 0x56, 0x1f, 0x8e, 0xa0, 0x87, 0x1e, 0xc7, 0xc1, 0x2d,
+  0xbb, 0x03, 0x2a, 0x98, 0xb9, 0x24, 0x4e, 0x11, 0xb6, 0xbd, 0x2a, 0x5c, 0x99, 0x1f, 0xa7, 0x20,
+  0xd1, 0x2d, 0x64, 0xef, 0xc2, 0xef, 0x17, 0x8a, 0xdf, 0x31, 0x88, 0x91, 0x3a, 0x42, 0x6c, 0x9c,
+  0x34, 0x1e, 0xdf, 0x99, 0xa2, 0x34, 0x83, 0xc0, 0x2c, 0x73, 0x83, 0xe6, 0xc5, 0x42, 0x31, 0x19,
+  0x9e, 0x26, 0x49, 0x65, 0xe8, 0x8d, 0xaf, 0x1f, 0x76, 0x3a, 0x1d, 0x89, 0x4f, 0x4f, 0x05, 0xeb,
+  0x31, 0x87, 0xe1, 0x6b, 0xfb, 0xe9, 0x51, 0x1c, 0xe1, 0x42, 0x0b, 0x54, 0x7b, 0xa4, 0x47, 0x7b,
+  0x3d, 0x8d, 0x08, 0xf5, 0x53, 0x7b, 0x7c, 0x57, 0x4e, 0xa0, 0x19, 0xa9, 0xaa, 0x61, 0xa4, 0xeb,
+  0xe1, 0xe6, 0x17, 0x12, 0xe5, 0x96, 0xed, 0x7e, 0x49, 0x75, 0x30, 0x03, 0x26, 0x1f, 0x45, 0x53,
+  0x14, 0xd9, 0x12, 0x9f, 0x5d, 0x92, 0x44, 0xc5, 0x90, 0x72, 0xf3, 0x40, 0xdc, 0xe5, 0x54, 0x1b,
+  0x4e, 0xba, 0xef, 0x67, 0xed, 0x30, 0x58, 0x63, 0xd2, 0x57, 0xbb, 0x46, 0x07, 0xd9, 0x33, 0x51,
+  0x6e, 0x09, 0x9e, 0x14, 0xf0, 0x6e, 0x0c, 0xaf, 0x84, 0x5f, 0x42, 0x04, 0xf1, 0xd0, 0x45, 0x57,
+  0x52, 0x19, 0xa4, 0xb3, 0x18, 0x1e, 0xea, 0x72, 0xca, 0x5f, 0x7f, 0xdc, 0xad, 0x8b, 0x17, 0x4f,
+  0xd0, 0x82, 0x50, 0x19, 0x32, 0x2a, 0x91, 0x31, 0xed, 0x54, 0x8e, 0xe9, 0x42, 0x44, 0xcd, 0xe4,
+  0xd1, 0xe3, 0x3b, 0x18, 0x2b, 0x6e, 0xe6, 0xce, 0x2e, 0x6c, 0x41, 0x93, 0xb9, 0xff, 0x1a, 0x4f,
+  0x2a, 0xf0, 0x73, 0xb3, 0x14, 0xf8, 0x45, 0x3e, 0x60, 0xfd, 0xcd, 0xc8, 0x8f, 0xd9, 0x16, 0xc7,
+  0xae, 0x11, 0x95, 0x72, 0x8d, 0xb3, 0x6b, 0xc6, 0xa6, 0x4c, 0xf5, 0xec, 0x6a, 0x01, 0xea, 0x1f,
+  0xff, 0x70, 0x80, 0x3a, 0x68, 0x57, 0xc6, 0xa9, 0xef, 0x31, 0xc5, 0xbf, 0xab, 0x82, 0xd5, 0x0b,
+  0xcb, 0x58, 0xe8, 0x2e, 0x58, 0xe0, 0x37, 0x4b, 0xe2, 0x58, 0x31, 0x2b, 0x7c, 0xbc, 0x67, 0xd7,
+  0x5e, 0xc3, 0xf3, 0x0a, 0xee, 0xc4, 0x74, 0x8d, 0xc9, 0x66, 0xfc, 0xde, 0x26, 0x53, 0xae, 0x4c,
+  0x97, 0x31, 0x0b, 0x9a, 0xa2, 0xf9, 0x00, 0xef, 0x5a, 0x28, 0x42, 0x71, 0x83, 0x93, 0x5f, 0x95,
+  0x60, 0x39, 0x1d, 0x61, 0x6f, 0xcc, 0xfc, 0x5c, 0x31, 0xf5, 0x95, 0xeb, 0x28, 0x2d, 0x5d, 0x67,
+  0x0d, 0xad, 0xc5, 0x52, 0x75, 0xc6, 0xce, 0x0f, 0x6a, 0x08, 0xb1, 0xae, 0x39, 0xac, 0x35, 0x95,
+  0x12, 0x42, 0x08, 0xa5, 0x6d, 0x35, 0x47, 0x3d, 0x51, 0xc6, 0xc9, 0xf7, 0x62, 0x5c, 0x91, 0x02,
+  0xa9, 0x61, 0xdd, 0x5c, 0xd1, 0xb3, 0xbd, 0x02, 0x63, 0x0a, 0x7b, 0xb8, 0xc1, 0xd1, 0x34, 0x4c,
+  0x8d, 0xc8, 0x90, 0x79, 0x36, 0xc7, 0x4f, 0x20, 0xd2, 0x1b, 0xfa, 0x21, 0xf5, 0x30, 0xf5, 0x30,
+  0x06, 0x0e, 0x1c, 0x6d, 0x91, 0x25, 0xd0, 0x1a, 0x49, 0xb6, 0xd4, 0xc2, 0xfb, 0xb9, 0xf0, 0x2d,
+  0x04, 0x06, 0x4e, 0xfc, 0xc1, 0x12, 0xde, 0x5a, 0x9e, 0xe0, 0x21, 0xb5, 0x95, 0xb6, 0xe7, 0x5f,
+  0xfa, 0xd9, 0x92, 0x66, 0x62, 0x94, 0xc4, 0x94, 0x0d, 0xe6, 0x9d, 0xc6, 0x32, 0xa5, 0xf4, 0x8a,
+  0xf7, 0x2f, 0x47, 0x63, 0xf5, 0xce, 0x5e, 0xa8, 0x9d, 0x64, 0x74, 0xce, 0x80, 0xee, 0xdd, 0xf1,
+  0x7d, 0xbb, 0xa9, 0xd2, 0x18, 0xa2, 0xb3, 0x8b, 0x6a, 0x45, 0x51, 0x22, 0x5d, 0x28, 0xe4, 0xe2,
+  0x02, 0x74, 0x09, 0x5b, 0xd9, 0xbb, 0x9a, 0x85, 0x9d, 0xc6, 0xb9, 0xa0, 0xf9, 0x76, 0xa3, 0xbd,
+  0xf5, 0x39, 0x17, 0x54, 0xec, 0x7f, 0x5a, 0xfb, 0x91, 0x73, 0xc1, 0x46, 0x8a, 0x57, 0x1f, 0x7c,
+  0x7d, 0xcf, 0x4b, 0x41, 0x5a, 0x7e, 0x13, 0xff, 0xb0, 0x5d, 0xde, 0xaa, 0xc4, 0x7d, 0x92, 0x64,
+  0x2e, 0x42, 0x08, 0x3f, 0x6a, 0x09, 0xdf, 0x9a, 0x5d, 0x6a, 0x6e, 0x33, 0x0d, 0x74, 0xe5, 0xc7,
+  0xf9, 0xf5, 0x44, 0xa6, 0x84, 0x86, 0xec, 0x16, 0xa2, 0x75, 0xf7, 0x50, 0xe9, 0x53, 0x39, 0xa1,
+  0xda, 0x41, 0xda, 0xcd, 0x4a, 0x46, 0xa9, 0x96, 0xb4, 0x04, 0xc6, 0x1a, 0xa7, 0x39, 0x04, 0x45,
+  0xc5, 0xda, 0x11, 0x58, 0xad, 0x4a, 0x06, 0x20, 0xf9, 0xa2, 0x08, 0x51, 0xdb, 0xbd, 0x5c, 0xb7,
+  0xda, 0xde, 0xcd, 0x46, 0x25, 0x9d, 0x0b, 0xe6, 0x2a, 0xb4, 0x2f, 0xeb, 0x7a, 0x56, 0x34, 0x31,
+  0x2f, 0x5d, 0xf0, 0x0e, 0x13, 0xa9, 0x84, 0xbe, 0xc3, 0xac, 0x1f, 0x69, 0x4c, 0x40, 0x44, 0x99,
+  0x05, 0x63, 0xa1, 0x8b, 0xe1, 0xdf, 0x34, 0x4d, 0xb3, 0x03, 0x8b, 0xce, 0xae, 0x26, 0x8f, 0x30,
+  0xe8, 0x1c, 0x26, 0x34, 0xc5, 0xcb, 0xa6, 0xf8, 0x9e, 0x49, 0x8e, 0xd4, 0xc5, 0x87, 0x09, 0x92,
+  0xc4, 0xbf, 0x46, 0x7f, 0x80, 0xbd, 0x9f, 0x80, 0x0f, 0x31, 0xa8, 0xb7, 0x19, 0x14, 0xbf, 0xe7,
+  0xa9, 0x51, 0xb0, 0x87, 0xda, 0x8b, 0x0a, 0x7b, 0xe6, 0x23, 0x0d, 0x1a, 0x9b, 0x83, 0xd7, 0x26,
+  0xf5, 0x67, 0x03, 0x01, 0xca, 0x37, 0x5d, 0x34, 0x6b, 0x82, 0x8d, 0x6a, 0x0c, 0x0a, 0x7f, 0xdd,
+  0xc5, 0xf6, 0x32, 0x18, 0x21, 0x38, 0x39, 0xb7, 0xc0, 0x43, 0x54, 0x96, 0xa6, 0x80, 0xac, 0xe8,
+  0x27, 0x49, 0x55, 0x66, 0x69, 0xbd, 0x05, 0xfa, 0x41, 0xe7, 0x11, 0xbe, 0x0a, 0x22, 0x92, 0xc6,
+  0xa3, 0x4a, 0x9f, 0x57, 0x3a, 0xa8, 0x25, 0x8b, 0xcb, 0x02, 0xcd, 0x36, 0x5e, 0xf0, 0xf6, 0x87,
+  0xfe, 0x40, 0x04, 0xac, 0xf9, 0xfa, 0xb1, 0xa3, 0xc0, 0x65, 0xd9, 0x03, 0x6d, 0xf7, 0xa6, 0x22,
+  0xc6, 0x15, 0xef, 0x07, 0xe5, 0x09, 0x38, 0x7e, 0xca, 0xd9, 0xed, 0xc3, 0xfa, 0xb2, 0x4b, 0xda,
+  0x94, 0xe2, 0xb9, 0x3d, 0x2a, 0x10, 0x74, 0x16, 0x3f, 0xa7, 0x72, 0xca, 0x0e, 0xfb, 0xa2, 0xf2,
+  0x51, 0xc7, 0x98, 0x19, 0xa1, 0xa5, 0x36, 0x6f, 0x95, 0xe6, 0x3b, 0x3a, 0x53, 0xa0, 0x57, 0x52,
+  0xd4, 0xf4, 0x55, 0xd8, 0x94, 0x82, 0xaf, 0x40, 0xc7, 0xea, 0x0b, 0xca, 0xbf, 0x0a, 0x1b, 0xd7,
+  0xf9, 0x15, 0xa8, 0xb0, 0xd2, 0x36, 0x07, 0x55, 0x88, 0xa0, 0xaa, 0x02, 0xcb, 0x48, 0x6c, 0x1d,
+  0x19, 0xb1, 0x03, 0x38, 0xfd, 0xfc, 0xed, 0x29, 0xaa, 0x47, 0xc5, 0xd2, 0x76, 0xf0, 0x4e, 0x3a,
+  0xa9, 0xe8, 0x8b, 0x9d, 0x4c, 0x8d, 0xa6, 0x4e, 0x53, 0xc1, 0xf0, 0x1d, 0x44, 0xe7, 0x4f, 0x5f,
+  0xfe, 0xe2, 0xf7, 0xec, 0xd5, 0x5b, 0x08, 0xcb, 0xf0, 0xfe, 0x3c, 0xf1, 0x92, 0x5b, 0x7c, 0x79,
+  0x98, 0x30, 0x9a, 0x6a, 0x6b, 0xfc, 0xd0, 0xc8, 0x18, 0x96, 0xf7, 0xc0, 0x4e, 0x70, 0x17, 0xba,
+  0xf8, 0xea, 0x37, 0xff, 0xfa, 0xbf, 0xff, 0xf5, 0xcf, 0x46, 0x27, 0x53, 0x18, 0x3c, 0x76, 0xc2,
+  0x8f, 0xd1, 0xf0, 0xbe, 0x98, 0x82, 0x48, 0x88, 0x3f, 0x8e, 0x13, 0xe4, 0x23, 0x2f, 0x01, 0xe5,
+  0x84, 0x19, 0x2b, 0xbd, 0x5f, 0x6d, 0x59, 0xe7, 0x4f, 0xed, 0xab, 0x5f, 0x7f, 0x81, 0xfd, 0x9e,
+  0xe1, 0xa4, 0xdc, 0xe4, 0x8a, 0x75, 0x38, 0x16, 0x2c, 0xea, 0x92, 0x3e, 0xfb, 0x69, 0x21, 0x7c,
+  0x96, 0x25, 0x8e, 0xb2, 0x85, 0x3a, 0x29, 0x9f, 0xdd, 0x9f, 0xbe, 0xfc, 0xd9, 0xbf, 0xcb, 0x6e,
+  0x38, 0x4e, 0xd6, 0x11, 0xc4, 0x99, 0xec, 0x10, 0x2a, 0xfe, 0x2c, 0x22, 0xe7, 0x46, 0xa3, 0x8f,
+  0x9c, 0xa1, 0x16, 0x59, 0xa2, 0xdf, 0xff, 0x94, 0xa1, 0x1f, 0x44, 0x01, 0x7f, 0x34, 0x8d, 0x3d,
+  0x03, 0xc1, 0x56, 0x65, 0x11, 0xa4, 0x55, 0xe3, 0xfe, 0xd5, 0x6f, 0x19, 0xd6, 0x51, 0x94, 0x59,
+  0xa4, 0x19, 0x44, 0x51, 0x80, 0x8a, 0x1c, 0xb4, 0x19, 0x5a, 0x73, 0xa3, 0x0f, 0xc5, 0xbf, 0x0b,
+  0xb1, 0xd6, 0x7f, 0x90, 0x7d, 0x3f, 0xb1, 0x39, 0x0b, 0x05, 0xc1, 0xc7, 0x7d, 0x82, 0x31, 0x3e,
+  0xf3, 0xcc, 0x57, 0xdd, 0x25, 0x9c, 0xc7, 0x87, 0x3e, 0x4d, 0x16, 0xe8, 0xaf, 0x6a, 0x4a, 0xbf,
+  0xf8, 0x9d, 0x7a, 0x0f, 0x18, 0x7b, 0xc5, 0x66, 0x68, 0xcf, 0x26, 0x6e, 0x10, 0xdc, 0x92, 0xd7,
+  0xdf, 0x6f, 0x2a, 0xd4, 0x0a, 0xbf, 0x42, 0x51, 0xb1, 0x81, 0x5d, 0xae, 0x02, 0x21, 0xf8, 0x2c,
+  0x15, 0x54, 0xcc, 0xe0, 0xcf, 0xb0, 0x67, 0x8c, 0xd8, 0xc0, 0xb6, 0xfa, 0x59, 0x8a, 0x27, 0xaa,
+  0x87, 0x34, 0x49, 0x54, 0xfa, 0x05, 0x46, 0xf9, 0x9b, 0x72, 0xcb, 0xa0, 0x3a, 0xd3, 0x13, 0x02,
+  0x17, 0xf9, 0xfb, 0x7f, 0x69, 0x96, 0x44, 0xe1, 0xe5, 0xde, 0x01, 0xaa, 0xd6, 0xcc, 0x8f, 0xf9,
+  0x93, 0x21, 0x75, 0x23, 0xc1, 0xe7, 0x71, 0x39, 0x4c, 0x8e, 0x64, 0x12, 0xec, 0x3d, 0xbe, 0x53,
+  0xb3, 0x46, 0x27, 0x74, 0x8c, 0x4e, 0xe8, 0xc5, 0x4e, 0xe0, 0x63, 0xc5, 0x6c, 0x67, 0x19, 0x3e,
+  0x5c, 0x34, 0x3b, 0x9f, 0x45, 0x7e, 0xd8, 0x70, 0x9c, 0xe6, 0x2c, 0x7f, 0xab, 0x94, 0x90, 0x0b,
+  0xfd, 0x80, 0x88, 0xf9, 0xcc, 0x10, 0x7b, 0x86, 0x29, 0xa5, 0x61, 0x2a, 0x13, 0x9f, 0x81, 0x48,
+  0xd2, 0x6b, 0xcf, 0x0d, 0xe1, 0xdb, 0x14, 0x50, 0xdd, 0x63, 0x81, 0x0b, 0x71, 0x33, 0x08, 0xc1,
+  0xc6, 0x48, 0x25, 0x7c, 0x3e, 0xe4, 0xda, 0x65, 0x0e, 0xd0, 0x3f, 0x6c, 0x3c, 0x59, 0x51, 0xde,
+  0x43, 0x29, 0x48, 0xb7, 0x00, 0xd2, 0xeb, 0x76, 0x37, 0x75, 0x98, 0xfc, 0x45, 0xb4, 0x92, 0x4d,
+  0x32, 0x95, 0xcf, 0x0e, 0xa2, 0xcb, 0xd4, 0x69, 0x82, 0xb2, 0x1f, 0xfb, 0xd9, 0x59, 0x84, 0xef,
+  0xed, 0x36, 0x9e, 0xb0, 0xa0, 0xf7, 0x01, 0x91, 0xb0, 0x35, 0x1b, 0x67, 0x6a, 0xff, 0xdd, 0xad,
+  0xdc, 0x38, 0xc3, 0x26, 0x11, 0x9a, 0x93, 0xe8, 0xb2, 0xe1, 0xbc, 0x71, 0xa7, 0xf9, 0x9b, 0x52,
+  0xec, 0xe6, 0x1d, 0x3e, 0x6a, 0xc5, 0xf7, 0x00, 0x95, 0x3e, 0xa7, 0x2a, 0x34, 0xb7, 0x36, 0xa8,
+  0xbc, 0x7c, 0xb3, 0x70, 0x81, 0x13, 0xaa, 0x25, 0xcf, 0x44, 0xdd, 0x7f, 0x53, 0xd2, 0xb6, 0xd6,
+  0xd2, 0xb7, 0x78, 0x85, 0x89, 0x05, 0x7c, 0x9e, 0x90, 0x28, 0xef, 0x27, 0x65, 0xbf, 0xc0, 0x7c,
+  0x45, 0x69, 0x0c, 0xa2, 0x0c, 0xd1, 0x5f, 0xe8, 0x06, 0x84, 0xdd, 0xf7, 0xc3, 0x1b, 0x70, 0x01,
+  0x5e, 0x18, 0x54, 0x33, 0x44, 0xb9, 0x38, 0xb3, 0x8f, 0x66, 0x36, 0xce, 0xaf, 0xe8, 0x6d, 0x8b,
+  0xe0, 0xd6, 0xbe, 0x9d, 0x10, 0x10, 0xe6, 0x17, 0x00, 0xc0, 0xc5, 0xea, 0xe3, 0x99, 0xcd, 0xdc,
+  0xe9, 0xb2, 0x06, 0xaa, 0x85, 0x95, 0x88, 0x4e, 0x7b, 0x9c, 0xc6, 0xc3, 0x5f, 0x0c, 0x04, 0xcc,
+  0x2d, 0xfd, 0xaa, 0xdf, 0xb5, 0xf6, 0x6c, 0x8c, 0xe6, 0xc6, 0x41, 0xc3, 0xf4, 0x95, 0xfb, 0xaa,
+  0x01, 0x01, 0xd5, 0x77, 0x49, 0x97, 0x6c, 0x91, 0x4c, 0x86, 0xa3, 0xd6, 0x7e, 0x1b, 0xfa, 0xbf,
+  0x78, 0x64, 0x26, 0x4e, 0x20, 0xe8, 0x49, 0x7c, 0xd0, 0x2f, 0xfd, 0xdb, 0x1c, 0x13, 0x2e, 0x13,
+  0x08, 0x3e, 0xc8, 0x43, 0xd6, 0xe2, 0x42, 0x0e, 0xb5, 0x26, 0x71, 0xc4, 0x66, 0x3f, 0xd2, 0x03,
+  0xfc, 0x9b, 0x24, 0xd3, 0x0e, 0x93, 0xea, 0xe9, 0x10, 0xd7, 0x74, 0x59, 0xc1, 0x8f, 0xed, 0x9b,
+  0x7e, 0xa7, 0x9c, 0xbe, 0xd5, 0xb0, 0x6d, 0xb5, 0xdb, 0xae, 0xc4, 0xa9, 0x30, 0xb4, 0x7b, 0x7a,
+  0xa3, 0x8a, 0x6e, 0x7a, 0x16, 0xd5, 0xdd, 0x0e, 0xbf, 0x01, 0x85, 0xfd, 0x89, 0xdb, 0x4e, 0x05,
+  0x3a, 0x19, 0xcf, 0x93, 0x31, 0x66, 0x99, 0x54, 0x6e, 0x11, 0x3d, 0x28, 0x65, 0x61, 0x4e, 0xa7,
+  0xa2, 0x5c, 0x5d, 0xe0, 0x56, 0x39, 0xa8, 0x56, 0x96, 0xd2, 0x2e, 0x9e, 0x47, 0x9a, 0x29, 0x91,
+  0x62, 0xb1, 0x8c, 0x14, 0xc0, 0x0b, 0xeb, 0xe8, 0x49, 0xd9, 0x86, 0x95, 0xc8, 0x05, 0xeb, 0xa3,
+  0x5a, 0x58, 0x7a, 0xf2, 0xbd, 0x30, 0xa9, 0x1d, 0xcd, 0x48, 0x0b, 0x7f, 0xed, 0x41, 0x7f, 0x86,
+  0xcd, 0xb8, 0xbd, 0xa6, 0x82, 0x9a, 0x44, 0x8a, 0x74, 0xe9, 0x6e, 0x94, 0x78, 0x52, 0xef, 0x3c,
+  0x61, 0xa9, 0xca, 0xb7, 0xa8, 0x78, 0xc0, 0x00, 0xfe, 0xcb, 0x3f, 0x0a, 0x67, 0x3b, 0x2d, 0xdb,
+  0x4e, 0xba, 0xe0, 0x3f, 0x77, 0xf1, 0xf8, 0x2e, 0xc9, 0x33, 0xa5, 0x42, 0xa5, 0x07, 0xa5, 0x9b,
+  0x46, 0x17, 0xe2, 0xc7, 0x2e, 0x10, 0x22, 0xcf, 0xa3, 0x0a, 0x90, 0xac, 0x6c, 0x33, 0xea, 0x82,
+  0xff, 0xd6, 0xc5, 0xe3, 0x3b, 0x21, 0xaf, 0x89, 0x3a, 0x13, 0x9e, 0x9f, 0xb7, 0xc5, 0xbc, 0xab,
+  0xc0, 0x31, 0x2a, 0xd9, 0x85, 0xba, 0x60, 0xbf, 0x7e, 0xa1, 0x61, 0x18, 0xf1, 0xe8, 0x8a, 0x83,
+  0x77, 0x9b, 0xb3, 0xf7, 0x2e, 0xb6, 0xab, 0x0c, 0x90, 0x22, 0xb1, 0xf5, 0xe6, 0x5f, 0xf1, 0x55,
+  0xc0, 0xa6, 0x65, 0x97, 0xf0, 0x57, 0x75, 0x21, 0xf0, 0x02, 0x87, 0x17, 0xfc, 0xea, 0x09, 0xdb,
+  0xe7, 0xc8, 0x20, 0x6e, 0x44, 0xac, 0xac, 0xae, 0x33, 0xda, 0x22, 0x10, 0xbe, 0xe2, 0x5d, 0xe5,
+  0x16, 0x0f, 0x94, 0x07, 0x11, 0x5e, 0xdb, 0x4b, 0xe9, 0xe7, 0x13, 0x1a, 0x0e, 0xd8, 0xad, 0x51,
+  0xc0, 0x33, 0x89, 0xd9, 0x0e, 0xd1, 0x38, 0xc5, 0xf7, 0x0c, 0x69, 0xc8, 0x86, 0x60, 0x1d, 0x2b,
+  0x03, 0x97, 0x10, 0x14, 0x40, 0x8b, 0x09, 0x44, 0xe0, 0x67, 0x59, 0x40, 0xdb, 0x14, 0x3c, 0x45,
+  0x37, 0xec, 0x98, 0x0f, 0x13, 0x3e, 0x7f, 0xb3, 0xff, 0xf2, 0xe8, 0xd3, 0x8f, 0x8f, 0xde, 0x9c,
+  0x1e, 0xbf, 0x7e, 0x85, 0xaf, 0x13, 0x6e, 0x97, 0xd5, 0x9f, 0x1e, 0xff, 0xf0, 0x08, 0x2a, 0x57,
+  0xb5, 0x37, 0xe7, 0x5e, 0xbe, 0x7e, 0x7d, 0xf8, 0xe9, 0xc1, 0xeb, 0xc3, 0xa3, 0x53, 0xf6, 0xe4,
+  0x5c, 0x84, 0x07, 0x6f, 0x1c, 0xf6, 0xec, 0x22, 0x7e, 0x10, 0xcf, 0x2c, 0xe2, 0x47, 0xf9, 0xa8,
+  0x22, 0xab, 0x8f, 0x32, 0x47, 0x3c, 0x27, 0x88, 0x07, 0xd4, 0x40, 0x70, 0x40, 0x89, 0x70, 0x2d,
+  0xde, 0xc0, 0x82, 0xce, 0xa8, 0xa9, 0xbd, 0x77, 0x78, 0x4a, 0x3f, 0x2f, 0xbc, 0x34, 0x27, 0x08,
+  0x95, 0xca, 0xcb, 0x90, 0xb2, 0xf4, 0x30, 0x89, 0xe2, 0x54, 0x3d, 0x8d, 0xa8, 0x78, 0xdd, 0xa3,
+  0x48, 0x40, 0x45, 0xdf, 0x46, 0x7f, 0x32, 0x34, 0xdf, 0x94, 0xbb, 0xce, 0x33, 0xbb, 0xee, 0xc7,
+  0x3e, 0x9d, 0xb2, 0x16, 0xda, 0x9d, 0xd2, 0x4e, 0xff, 0x36, 0xa3, 0x27, 0xe2, 0xec, 0x68, 0x81,
+  0x24, 0x78, 0xbf, 0x15, 0x4f, 0x3e, 0x7c, 0x04, 0xae, 0xc2, 0x26, 0x70, 0x0d, 0x3b, 0x62, 0x59,
+  0xa4, 0xab, 0xd2, 0x6b, 0xf9, 0x8e, 0xb9, 0x65, 0x4e, 0x70, 0xad, 0xb7, 0x34, 0x9a, 0x9e, 0x6b,
+  0x68, 0x7b, 0x4d, 0x2e, 0x78, 0x48, 0x62, 0xb5, 0x21, 0xff, 0xf9, 0x56, 0xde, 0xf3, 0xea, 0x4a,
+  0x63, 0xa5, 0xc5, 0x6e, 0x15, 0x37, 0x5b, 0xca, 0x06, 0x23, 0x87, 0xbc, 0x4c, 0xcd, 0x56, 0x1b,
+  0x56, 0x2b, 0xa5, 0x7b, 0xb7, 0x72, 0xcb, 0x07, 0xad, 0x9f, 0xf9, 0x97, 0xc7, 0x61, 0xb6, 0xb1,
+  0xd6, 0xe8, 0x75, 0x05, 0x80, 0x82, 0x90, 0x12, 0x2d, 0xf0, 0x42, 0xb3, 0xde, 0x46, 0xa3, 0xb7,
+  0x69, 0xe1, 0x55, 0x52, 0x6c, 0x34, 0x5b, 0xe9, 0xda, 0xdd, 0x33, 0xa1, 0x15, 0x6d, 0x9e, 0x07,
+  0x91, 0xcb, 0x66, 0x62, 0x4f, 0x85, 0x09, 0xaa, 0xd9, 0x44, 0xce, 0xe3, 0x81, 0xb2, 0x99, 0x33,
+  0x63, 0xd5, 0xa3, 0x30, 0x5f, 0x71, 0xa5, 0xe0, 0xd0, 0x46, 0x08, 0x31, 0xc2, 0xdf, 0x4d, 0xe3,
+  0x59, 0x23, 0xf1, 0x3b, 0xd7, 0x9a, 0x0c, 0xa3, 0x35, 0x85, 0xef, 0xe0, 0x04, 0x4e, 0x29, 0x70,
+  0x06, 0x26, 0x93, 0x52, 0x77, 0x9a, 0xc7, 0x6d, 0x82, 0x2f, 0x1f, 0xee, 0xe6, 0x17, 0x3a, 0x40,
+  0xd1, 0x41, 0xc9, 0x9e, 0xe2, 0x59, 0xbc, 0x57, 0xa8, 0x31, 0xe5, 0x07, 0xbb, 0xa2, 0x45, 0x5b,
+  0xb5, 0x50, 0x97, 0x7f, 0x73, 0x36, 0x67, 0x4d, 0xa4, 0x9a, 0x94, 0x5c, 0xfe, 0xc1, 0x07, 0x79,
+  0x33, 0xf5, 0xfa, 0xa7, 0x7d, 0x37, 0xcc, 0xd2, 0xe7, 0x39, 0x8e, 0x32, 0x4d, 0x8b, 0x8f, 0xf4,
+  0x3d, 0x62, 0xba, 0x99, 0x7e, 0x3e, 0x23, 0x7f, 0xfc, 0x4f, 0x50, 0x81, 0x79, 0x77, 0x33, 0x49,
+  0x0f, 0x55, 0xce, 0x66, 0x30, 0xc3, 0x87, 0x51, 0x31, 0x09, 0x67, 0xa8, 0xc4, 0xd7, 0x21, 0xb8,
+  0x23, 0x71, 0x94, 0xa6, 0x7e, 0x3f, 0x80, 0xe8, 0x5a, 0xea, 0xa1, 0x18, 0x5c, 0x7e, 0xc2, 0x1e,
+  0x10, 0x4c, 0xf0, 0xc0, 0x0f, 0xfa, 0x2b, 0x39, 0x71, 0x21, 0x54, 0xa1, 0xc1, 0xd0, 0xb8, 0x29,
+  0xc5, 0x7f, 0x25, 0x08, 0x27, 0x67, 0x9c, 0xfc, 0x55, 0x71, 0x21, 0x04, 0xea, 0x59, 0x04, 0x41,
+  0x29, 0xa3, 0x38, 0xfb, 0xbd, 0xaa, 0x2d, 0x07, 0xc5, 0xe1, 0xa1, 0x6a, 0x31, 0x8a, 0xd2, 0x0c,
+  0x23, 0x91, 0xa6, 0xe1, 0x4c, 0x72, 0xf1, 0x9e, 0xa6, 0x42, 0xbe, 0x95, 0x4a, 0x6e, 0x5c, 0x4c,
+  0xf1, 0x07, 0xaf, 0x60, 0x7a, 0x36, 0xfc, 0x6c, 0x6b, 0xb3, 0xb7, 0x2c, 0xad, 0xf6, 0x34, 0xed,
+  0x70, 0x65, 0x8e, 0x87, 0x51, 0x30, 0x1f, 0xe5, 0x26, 0x89, 0x7b, 0x0b, 0xca, 0x01, 0xc2, 0x2c,
+  0x47, 0x35, 0x89, 0xc2, 0x28, 0xa6, 0xf8, 0x0e, 0xa8, 0x79, 0xe4, 0x10, 0x6a, 0x80, 0x8d, 0xd8,
+  0x43, 0xd5, 0x1e, 0xdd, 0x02, 0x3c, 0xda, 0x16, 0x63, 0x41, 0xaf, 0x55, 0xae, 0x96, 0xc3, 0x57,
+  0x4b, 0xfd, 0x8e, 0x92, 0xe8, 0x76, 0xa6, 0xf5, 0x2e, 0x42, 0x2c, 0x74, 0x75, 0xaf, 0x6d, 0x9f,
+  0xee, 0x61, 0x83, 0x5e, 0xf3, 0x14, 0xae, 0x0f, 0x94, 0xc0, 0x6d, 0xba, 0x68, 0x48, 0xf6, 0x71,
+  0x16, 0xcf, 0xd8, 0x2c, 0x9a, 0x26, 0xbd, 0x24, 0xc5, 0xd8, 0xc9, 0x3a, 0x4b, 0x6b, 0x0a, 0x44,
+  0x4d, 0xdd, 0x73, 0x03, 0xb9, 0x32, 0xc5, 0xac, 0x38, 0xba, 0x41, 0x80, 0x47, 0xe8, 0x6c, 0xe2,
+  0xd4, 0xcd, 0x15, 0xad, 0x16, 0x9b, 0x2d, 0xff, 0x0d, 0x2f, 0x27, 0x3f, 0x80, 0xa4, 0xae, 0x17,
+  0x6b, 0x0c, 0xd3, 0xc2, 0xc7, 0x08, 0xbb, 0x7a, 0xc7, 0x92, 0x37, 0x8f, 0x43, 0x5f, 0xdc, 0xbd,
+  0x06, 0xf1, 0xc3, 0x17, 0xcc, 0x31, 0xf5, 0x87, 0xf7, 0x6f, 0x1f, 0x10, 0xe3, 0x79, 0x51, 0x84,
+  0xc9, 0xef, 0xe6, 0x76, 0xe5, 0x63, 0xad, 0x39, 0x47, 0x6e, 0x3f, 0xd0, 0x7f, 0xfa, 0x8c, 0xff,
+  0xe6, 0xd9, 0xce, 0xf2, 0x28, 0x1b, 0x43, 0xb4, 0xfa, 0x7f, 0x56, 0xed, 0x0f, 0xf9, 0x30, 0x86,
+  0x00, 0x00,
+};
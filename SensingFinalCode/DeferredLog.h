@@ -0,0 +1,322 @@
+// Smart Plant Buddy - deferred binary logging
+//
+// write() costs a level check and, if the message is on, a copy of its
+// ID, a millisecond stamp and the raw arguments into a byte ring. Nothing
+// is formatted until the consumer (loop() when idle) pops the record and
+// either renders it with formatLogRecord() or sends it as a frame for
+// host/decode_log.py. Any thread may write; writers and the reader share
+// a short critical section around the ring copy.
+//
+// Record:  len u8 | id u16 | ms u32 | args, each a type tag + value
+//   'i' int32   'u' uint32   'q' int64   'f' float   's' len u8 + bytes
+// All little-endian. long and unsigned long go out as 32 bits, their
+// width on the ESP32. Frame on the wire: A5 5A | len | record | CRC-8.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "LogMessages.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <mutex>
+#endif
+
+const uint8_t LOG_RECORD_MAX = 96;
+const uint8_t LOG_HEADER_LEN = 7;      // len, id, ms
+const uint8_t LOG_STR_MAX = 31;        // longer string arguments are cut
+const uint8_t LOG_FRAME_SYNC0 = 0xA5;
+const uint8_t LOG_FRAME_SYNC1 = 0x5A;
+const uint8_t LOG_FRAME_OVERHEAD = 3;  // sync + CRC; len is the record's first byte
+
+//  ENCODING
+
+class LogEncoder {
+ public:
+  explicit LogEncoder(uint8_t* buf) : buf_(buf), len_(LOG_HEADER_LEN) {}
+
+  void header(LogId id, uint32_t ms) {
+    buf_[1] = (uint8_t)id;
+    buf_[2] = (uint8_t)(id >> 8);
+    putRaw(3, ms);
+  }
+
+  void put(int v) { putTagged('i', (uint32_t)v); }
+  void put(long v) { putTagged('i', (uint32_t)v); }
+  void put(unsigned v) { putTagged('u', v); }
+  void put(unsigned long v) { putTagged('u', (uint32_t)v); }
+  void put(long long v) { putTagged64((uint64_t)v); }
+  void put(unsigned long long v) { putTagged64(v); }
+  void put(double v) { put((float)v); }
+
+  void put(float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, 4);
+    putTagged('f', bits);
+  }
+
+  void put(const char* s) {
+    size_t n = s ? strlen(s) : 0;
+    if (n > LOG_STR_MAX) n = LOG_STR_MAX;
+    if (!room(2 + n)) return;
+    buf_[len_++] = 's';
+    buf_[len_++] = (uint8_t)n;
+    memcpy(buf_ + len_, s, n);
+    len_ += n;
+  }
+
+  void putAll() {}
+
+  template <typename T, typename... Rest>
+  void putAll(const T& v, const Rest&... rest) {
+    put(v);
+    putAll(rest...);
+  }
+
+  // Stores the length byte; returns the record length
+  uint8_t finish() {
+    buf_[0] = (uint8_t)len_;
+    return (uint8_t)len_;
+  }
+
+ private:
+  bool room(size_t n) const { return len_ + n <= LOG_RECORD_MAX; }
+
+  void putRaw(size_t at, uint32_t v) {
+    for (uint8_t i = 0; i < 4; i++) buf_[at + i] = (uint8_t)(v >> (8 * i));
+  }
+
+  void putTagged(char tag, uint32_t v) {
+    if (!room(5)) return;
+    buf_[len_++] = tag;
+    putRaw(len_, v);
+    len_ += 4;
+  }
+
+  void putTagged64(uint64_t v) {
+    if (!room(9)) return;
+    buf_[len_++] = 'q';
+    putRaw(len_, (uint32_t)v);
+    putRaw(len_ + 4, (uint32_t)(v >> 32));
+    len_ += 8;
+  }
+
+  uint8_t* buf_;
+  size_t len_;
+};
+
+//  DECODING
+
+inline uint32_t logReadU32(const uint8_t* p) {
+  return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+inline LogId logRecordId(const uint8_t* rec) { return (LogId)(rec[1] | rec[2] << 8); }
+inline uint32_t logRecordMs(const uint8_t* rec) { return logReadU32(rec + 3); }
+
+// Renders a record with its format, one conversion at a time. The length
+// modifier comes from the argument's tag, not the format, so a %lu given
+// a 32-bit value prints right on every build; a missing or mismatched
+// argument prints as '?'.
+inline size_t formatLogRecord(const uint8_t* rec, char* out, size_t cap) {
+  if (cap == 0) return 0;
+  size_t len = 0;
+  out[0] = '\0';
+  LogId id = logRecordId(rec);
+  if (id >= LOG_ID_COUNT) {
+    int n = snprintf(out, cap, "<unknown log id %u>", (unsigned)id);
+    return n < 0 ? 0 : ((size_t)n < cap ? n : cap - 1);
+  }
+  const uint8_t* arg = rec + LOG_HEADER_LEN;
+  const uint8_t* end = rec + rec[0];
+  for (const char* f = LOG_FORMATS[id]; *f && len + 1 < cap; f++) {
+    if (*f != '%') {
+      out[len++] = *f;
+      continue;
+    }
+    if (f[1] == '%') {
+      out[len++] = '%';
+      f++;
+      continue;
+    }
+    // %[flags][width][.precision][length]conversion
+    char spec[16];
+    size_t s = 0;
+    spec[s++] = *f++;
+    while (*f && strchr("-+ #0123456789.", *f) && s < sizeof(spec) - 4) spec[s++] = *f++;
+    while (*f && strchr("hlzjt", *f)) f++;
+    char conv = *f;
+    if (!conv) break;
+
+    char tag = arg < end ? (char)arg[0] : 0;
+    bool integer = strchr("diuxXc", conv) != nullptr;
+    bool ok = (tag == 's' && conv == 's') || (tag == 'f' && strchr("fFeEgG", conv)) ||
+              ((tag == 'i' || tag == 'u' || tag == 'q') && integer);
+    int n = 0;
+    if (!ok) {
+      n = snprintf(out + len, cap - len, "?");
+    } else if (tag == 's') {
+      spec[s++] = '.';
+      spec[s++] = '*';
+      spec[s++] = 's';
+      spec[s] = '\0';
+      n = snprintf(out + len, cap - len, spec, (int)arg[1], (const char*)arg + 2);
+      arg += 2 + arg[1];
+    } else if (tag == 'f') {
+      spec[s++] = conv;
+      spec[s] = '\0';
+      uint32_t bits = logReadU32(arg + 1);
+      float v;
+      memcpy(&v, &bits, 4);
+      n = snprintf(out + len, cap - len, spec, (double)v);
+      arg += 5;
+    } else if (tag == 'q') {
+      spec[s++] = 'l';
+      spec[s++] = 'l';
+      spec[s++] = conv;
+      spec[s] = '\0';
+      uint64_t v = logReadU32(arg + 1) | (uint64_t)logReadU32(arg + 5) << 32;
+      n = snprintf(out + len, cap - len, spec, (long long)v);
+      arg += 9;
+    } else {
+      spec[s++] = conv;
+      spec[s] = '\0';
+      uint32_t v = logReadU32(arg + 1);
+      if (tag == 'i') n = snprintf(out + len, cap - len, spec, (int)(int32_t)v);
+      else n = snprintf(out + len, cap - len, spec, (unsigned)v);
+      arg += 5;
+    }
+    if (n < 0) break;
+    len += (size_t)n < cap - len ? n : cap - len - 1;
+  }
+  out[len] = '\0';
+  return len;
+}
+
+// CRC-8, polynomial 0x07
+inline uint8_t logCrc8(const uint8_t* p, size_t n) {
+  uint8_t crc = 0;
+  while (n--) {
+    crc ^= *p++;
+    for (uint8_t i = 0; i < 8; i++) crc = crc & 0x80 ? (uint8_t)(crc << 1) ^ 0x07 : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+// Wraps a record for the wire; out needs rec[0] + LOG_FRAME_OVERHEAD bytes
+inline size_t writeLogFrame(const uint8_t* rec, uint8_t* out) {
+  out[0] = LOG_FRAME_SYNC0;
+  out[1] = LOG_FRAME_SYNC1;
+  memcpy(out + 2, rec, rec[0]);
+  out[2 + rec[0]] = logCrc8(rec, rec[0]);
+  return rec[0] + LOG_FRAME_OVERHEAD;
+}
+
+//  RING
+
+// Critical section shared by the writers and the reader: a spinlock that
+// also masks interrupts on the ESP32 (so a task can't be preempted while
+// holding it), a mutex on the host
+class LogLock {
+ public:
+#ifdef ARDUINO
+  LogLock() { portMUX_INITIALIZE(&mux_); }
+  void lock() { portENTER_CRITICAL(&mux_); }
+  void unlock() { portEXIT_CRITICAL(&mux_); }
+
+ private:
+  portMUX_TYPE mux_;
+#else
+  void lock() { mux_.lock(); }
+  void unlock() { mux_.unlock(); }
+
+ private:
+  std::mutex mux_;
+#endif
+};
+
+template <size_t N>
+class DeferredLog {
+ public:
+  DeferredLog() : head_(0), tail_(0), used_(0), dropped_(0) { setLevel(LOG_LVL_INFO); }
+
+  bool enabled(LogId id) const { return LOG_LEVEL_OF[id] <= levels_[LOG_MODULE_OF[id]]; }
+
+  template <typename... Args>
+  void write(LogId id, uint32_t ms, const Args&... args) {
+    if (!enabled(id)) return;
+    uint8_t rec[LOG_RECORD_MAX];
+    LogEncoder e(rec);
+    e.header(id, ms);
+    e.putAll(args...);
+    push(rec, e.finish());
+  }
+
+  // Copies the oldest record into rec (LOG_RECORD_MAX bytes); false if empty
+  bool pop(uint8_t* rec) {
+    lock_.lock();
+    bool any = used_ > 0;
+    if (any) {
+      uint8_t len = buf_[tail_];
+      copyOut(rec, len);
+      tail_ = (tail_ + len) % N;
+      used_ -= len;
+    }
+    lock_.unlock();
+    return any;
+  }
+
+  // Length of the oldest record, 0 if empty
+  uint8_t peekLength() {
+    lock_.lock();
+    uint8_t len = used_ > 0 ? buf_[tail_] : 0;
+    lock_.unlock();
+    return len;
+  }
+
+  // Returns and clears the count of records lost to a full ring
+  uint32_t takeDropped() {
+    lock_.lock();
+    uint32_t n = dropped_;
+    dropped_ = 0;
+    lock_.unlock();
+    return n;
+  }
+
+  size_t used() const { return used_; }
+
+  void setLevel(LogLevel level) {
+    for (uint8_t m = 0; m < LOG_MODULE_COUNT; m++) levels_[m] = level;
+  }
+  void setLevel(LogModule module, LogLevel level) { levels_[module] = level; }
+  LogLevel level(LogModule module) const { return levels_[module]; }
+
+ private:
+  void push(const uint8_t* rec, uint8_t len) {
+    lock_.lock();
+    if (N - used_ < len) {
+      dropped_++;
+    } else {
+      for (uint8_t i = 0; i < len; i++) buf_[(head_ + i) % N] = rec[i];
+      head_ = (head_ + len) % N;
+      used_ += len;
+    }
+    lock_.unlock();
+  }
+
+  void copyOut(uint8_t* rec, uint8_t len) {
+    for (uint8_t i = 0; i < len; i++) rec[i] = buf_[(tail_ + i) % N];
+  }
+
+  uint8_t buf_[N];
+  size_t head_;
+  size_t tail_;
+  size_t used_;
+  uint32_t dropped_;
+  LogLevel levels_[LOG_MODULE_COUNT];
+  LogLock lock_;
+};
@@ -0,0 +1,207 @@
+// Smart Plant Buddy - non-blocking DHT11/DHT22 driver
+//
+// The Adafruit DHT library bit-bangs each read with interrupts disabled for
+// ~5 ms and is called twice per reading. This driver never waits:
+//
+//   IDLE --period--> START (pin held low, dhtStartMs) --> CAPTURE (edge ISR
+//   timestamps every transition for 8 ms) --> decode --> IDLE
+//
+// poll() only compares deadlines, so it can be called from a scheduler
+// task every few ms. The edge ISR stores one timestamp per transition.
+// Decoding is plain C++ over the captured edges (decodeDhtEdges), so it
+// builds and can be fed recorded edges on the host.
+//
+// Consumers get the last good value together with its age and a quality
+// flag instead of the -1 / -100 sentinels of a failed read.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+enum DhtType { DHT_TYPE_11 = 11, DHT_TYPE_22 = 22 };
+
+enum DhtQuality {
+  DHT_NO_DATA,   // never had a good read
+  DHT_FRESH,     // last conversion succeeded
+  DHT_CACHED,    // last conversion failed; value is from an earlier one
+  DHT_EXPIRED    // last good value is older than maxAgeMs
+};
+
+struct DhtSample {
+  float tempC;
+  float hum;
+  unsigned long ageMs;
+  DhtQuality quality;
+};
+
+const uint8_t DHT_MAX_EDGES = 100;   // 2 per bit + response + slack
+
+// Host start signal: a DHT11 wants the line low for at least 18 ms, a DHT22
+// for 1-10 ms (it misses the start if held much longer)
+inline unsigned long dhtStartMs(DhtType type) { return type == DHT_TYPE_11 ? 18 : 1; }
+
+//  DECODING
+
+// Decode 40 data bits from edge timestamps (us) and the level each edge
+// switched to. A bit's value is the length of its high pulse: ~27 us for 0,
+// ~70 us for 1. The last 40 high pulses are the data; anything earlier is
+// the sensor's 80 us response. Returns false on short capture or checksum.
+inline bool decodeDhtEdges(const uint32_t* times, const uint8_t* levels, uint8_t count,
+                           DhtType type, float& tempC, float& hum) {
+  uint32_t highs[DHT_MAX_EDGES];
+  uint8_t n = 0;
+  for (uint8_t i = 1; i < count; i++) {
+    if (levels[i] == 0 && levels[i - 1] == 1) highs[n++] = times[i] - times[i - 1];
+  }
+  if (n < 40) return false;
+
+  uint8_t data[5] = {0, 0, 0, 0, 0};
+  const uint32_t* bits = highs + (n - 40);
+  for (uint8_t i = 0; i < 40; i++) {
+    data[i / 8] <<= 1;
+    if (bits[i] > 48) data[i / 8] |= 1;
+  }
+  if ((uint8_t)(data[0] + data[1] + data[2] + data[3]) != data[4]) return false;
+
+  if (type == DHT_TYPE_11) {
+    hum = data[0] + data[1] * 0.1f;
+    tempC = data[2] + (data[3] & 0x0f) * 0.1f;
+    if (data[3] & 0x80) tempC = -tempC;
+  } else {
+    hum = ((data[0] << 8) | data[1]) * 0.1f;
+    tempC = (((data[2] & 0x7f) << 8) | data[3]) * 0.1f;
+    if (data[2] & 0x80) tempC = -tempC;
+  }
+  return true;
+}
+
+#ifdef ARDUINO
+
+//  DRIVER
+
+class DhtAsync {
+ public:
+  DhtAsync(uint8_t pin, DhtType type, unsigned long periodMs, unsigned long maxAgeMs)
+    : pin_(pin), type_(type), periodMs_(periodMs), maxAgeMs_(maxAgeMs), state_(IDLE),
+      deadline_(0), count_(0), haveGood_(false), lastOk_(false), fresh_(false),
+      tempC_(0), hum_(0), goodAtMs_(0), reads_(0), failures_(0) {}
+
+  void begin() {
+    pinMode(pin_, INPUT_PULLUP);
+    // Sensor needs ~1 s after power-up before the first conversion
+    deadline_ = millis() + 1000;
+  }
+
+  // Advance the state machine; never blocks
+  void poll() {
+    unsigned long now = millis();
+    if ((long)(now - deadline_) < 0) return;
+
+    switch (state_) {
+      case IDLE:
+        pinMode(pin_, OUTPUT);
+        digitalWrite(pin_, LOW);
+        state_ = START;
+        // +1: millis() may tick just after the line went low. Polled every
+        // DHT_POLL_MS, a DHT22 start stays well under its 10 ms.
+        deadline_ = now + dhtStartMs(type_) + 1;
+        break;
+
+      case START:
+        count_ = 0;
+        attachInterruptArg(pin_, onEdge, this, CHANGE);
+        pinMode(pin_, INPUT_PULLUP);
+        state_ = CAPTURE;
+        deadline_ = now + 8;   // response + 40 bits is < 5 ms
+        break;
+
+      case CAPTURE:
+        detachInterrupt(pin_);
+        finish(now);
+        state_ = IDLE;
+        deadline_ = now + periodMs_;
+        break;
+    }
+  }
+
+  // Last good value with its age and quality
+  DhtSample sample() const {
+    DhtSample s;
+    s.tempC = tempC_;
+    s.hum = hum_;
+    s.ageMs = haveGood_ ? millis() - goodAtMs_ : 0;
+    if (!haveGood_) s.quality = DHT_NO_DATA;
+    else if (s.ageMs > maxAgeMs_) s.quality = DHT_EXPIRED;
+    else s.quality = lastOk_ ? DHT_FRESH : DHT_CACHED;
+    return s;
+  }
+
+  // True once after each successful conversion
+  bool takeFresh() {
+    bool f = fresh_;
+    fresh_ = false;
+    return f;
+  }
+
+  unsigned long reads() const { return reads_; }
+  unsigned long failures() const { return failures_; }
+
+ private:
+  enum State { IDLE, START, CAPTURE };
+
+  static void IRAM_ATTR onEdge(void* arg) {
+    DhtAsync* self = (DhtAsync*)arg;
+    uint8_t i = self->count_;
+    if (i >= DHT_MAX_EDGES) return;
+    self->times_[i] = micros();
+    self->levels_[i] = digitalRead(self->pin_);
+    self->count_ = i + 1;
+  }
+
+  void finish(unsigned long now) {
+    reads_++;
+    float t, h;
+    uint32_t times[DHT_MAX_EDGES];
+    uint8_t levels[DHT_MAX_EDGES];
+    uint8_t n = count_;
+    memcpy(times, (const void*)times_, n * sizeof(uint32_t));
+    memcpy(levels, (const void*)levels_, n);
+    lastOk_ = decodeDhtEdges(times, levels, n, type_, t, h);
+    if (!lastOk_) {
+      failures_++;
+      return;
+    }
+    tempC_ = t;
+    hum_ = h;
+    goodAtMs_ = now;
+    haveGood_ = true;
+    fresh_ = true;
+  }
+
+  uint8_t pin_;
+  DhtType type_;
+  unsigned long periodMs_;
+  unsigned long maxAgeMs_;
+  State state_;
+  unsigned long deadline_;
+
+  volatile uint32_t times_[DHT_MAX_EDGES];
+  volatile uint8_t levels_[DHT_MAX_EDGES];
+  volatile uint8_t count_;
+
+  bool haveGood_;
+  bool lastOk_;
+  bool fresh_;
+  float tempC_;
+  float hum_;
+  unsigned long goodAtMs_;
+  unsigned long reads_;
+  unsigned long failures_;
+};
+
+#endif
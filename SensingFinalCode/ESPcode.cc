@@ -1,69 +1,267 @@
-// Smart Plant Buddy 
+// Smart Plant Buddy
+//
+// ESP32 backend: the pins, radio, display and servers behind Hal. The
+// firmware logic itself is PlantCore (PlantCore.h), which runs unchanged
+// on Linux with host/LinuxHal.h.
 
 #include <WiFi.h>
 #include <HTTPClient.h>
-#include "DHT.h"
 #include <time.h>
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <WebSocketsServer.h>
-
-//Pins 
-#define SOIL_PIN 34  
-#define LDR_PIN  35  
+#include <ESPAsyncWebServer.h>
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include "Hal.h"
+#include "PlantCore.h"
+#include "FirebaseClient.h"
+#include "DashboardHtml.h"
+#include "DhtAsync.h"
+#include "OledView.h"
+#include "StatusScreen.h"
+
+//Pins
+#define SOIL_PIN 34
+#define LDR_PIN  35
 #define DHT_PIN  4
-#define DHTTYPE  DHT11
+#define DHTTYPE  DHT_TYPE_11
 
-// OLED Display 
+// OLED Display
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
 #define OLED_RESET -1
 #define SCREEN_ADDRESS 0x3C
+#define OLED_I2C_HZ 400000    // SSD1306 fast mode; many modules also run at 1000000
+// #define OLED_FULL_REFRESH  // push the whole buffer every refresh (for comparison)
 
-//  OBJECTS 
-DHT dht(DHT_PIN, DHTTYPE);
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+//  OBJECTS
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET, OLED_I2C_HZ, OLED_I2C_HZ);
 WebSocketsServer webSocket(81);  // WebSocket on port 81
+AsyncWebServer httpServer(80);   // serves the dashboard
+
+static_assert(WEBSOCKETS_SERVER_CLIENT_MAX <= LIVE_CLIENTS_MAX, "raise LIVE_CLIENTS_MAX");
 
-// WIFI & FIREBASE 
+// WIFI & FIREBASE
 const char* WIFI_SSID = "*****";
 const char* WIFI_PASS = "*****"; // redacted for privacy
 const char* FIREBASE_DB_URL = "**"; // redacted for privacy
 
-//  TIMING 
-unsigned long lastPost = 0;
-unsigned long lastOLEDUpdate = 0;
-const unsigned long POST_INTERVAL_MS = 900000;  // 15 minutes
-const unsigned long OLED_UPDATE_MS = 2000;       // 2 seconds
-
-//  STATE 
-String currentMood = "ok";
-int currentSoil = 0;
-
-//  MOOD FACES 
-const char* getMoodFace(const String& mood) {
-  if (mood == "happy") return "  ^_^  ";
-  if (mood == "thirsty") return "  O_O  ";
-  if (mood == "drowning") return " @_@  ";
-  if (mood == "hot") return "  >_<  ";
-  return "  -_-  ";
+// PLANT
+// plantTypes id whose ranges drive the mood (see PlantProfiles.h);
+// unknown ids fall back to inferMood()'s old limits (MoodTable::compileDefault)
+const char* PLANT_TYPE = "spider_plant";
+
+//  DEVICE TIMING
+const unsigned long DHT_READ_MS = 2000;          // DHT11 refreshes at most ~1 Hz
+const unsigned long DHT_MAX_AGE_MS = 60000;      // cached value still usable
+const size_t SERIAL_TX_BUFFER = 1024;
+const time_t NTP_VALID_AFTER = 8 * 3600 * 2;      // time() below this = not synced
+#define OFFLINE_LOG_DIR "/offline"
+#define OFFLINE_LOG_OLD_PATH "/offline.log"     // the single-file log before segments
+
+//  ADC
+// Soil and light are sampled continuously by the ADC's DMA engine. The
+// driver averages ADC_CONVERSIONS_PER_PIN conversions into one result per
+// pin (20 kHz / 2 pins / 100 = 100 Hz per channel) and PlantCore averages
+// those over READING_WINDOW_MS. Cores without the continuous API fall back
+// to one analogRead() per pin every ADC_POLL_MS.
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+#define ADC_CONTINUOUS 1
+#endif
+const uint32_t ADC_SAMPLE_HZ = 20000;            // total conversions/s (ESP32 minimum)
+const uint32_t ADC_CONVERSIONS_PER_PIN = 100;
+const uint32_t ADC_RESULT_HZ = ADC_SAMPLE_HZ / (2 * ADC_CONVERSIONS_PER_PIN);
+
+//  TASKS & CORES
+// Acquisition runs pinned on the app core next to loop(); Firebase posting
+// runs on the protocol core with the WiFi stack, so a slow HTTP(S) post
+// never stalls sampling, the OLED or the WebSocket broadcast.
+#define SENSOR_CORE 1
+#define NET_CORE    0
+const uint32_t SENSOR_STACK = 4096;
+const uint32_t NET_STACK = 8192;
+
+//  HEAP HOOKS
+// ESP-IDF calls these after every heap_caps allocation and free when it is
+// built with CONFIG_HEAP_USE_HOOKS (not the case in the stock Arduino core;
+// use a custom sdkconfig). They can run from any task or ISR, so they stay
+// in IRAM and only bump the current core's counters.
+#ifdef HEAP_PROFILE
+#ifdef CONFIG_HEAP_USE_HOOKS
+#define HEAP_HOOKS 1
+extern "C" IRAM_ATTR void esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t) {
+  if (ptr) countAlloc(size);
 }
-
-const char* getMoodText(const String& mood) {
-  if (mood == "happy") return "I'm Happy!";
-  if (mood == "thirsty") return "I'm Thirsty";
-  if (mood == "drowning") return "Too Wet!";
-  if (mood == "hot") return "Too Hot!";
-  return "I'm OK";
+extern "C" IRAM_ATTR void esp_heap_trace_free_hook(void* ptr) {
+  if (ptr) countFree();
 }
+#else
+#warning "HEAP_PROFILE needs CONFIG_HEAP_USE_HOOKS; per-phase allocation counts stay off"
+#endif
+#endif
 
-//  HELPER FUNCTIONS 
+//  HAL
 
-long long getEpochMillis() {
-  time_t now = time(nullptr);
-  return (long long)now * 1000;
-}
+extern PlantCore core;   // below; EspHal logs through it
+
+class EspHal : public Hal {
+ public:
+  EspHal()
+    : dht_(DHT_PIN, DHTTYPE, DHT_READ_MS, DHT_MAX_AGE_MS), screen_(display),
+      oledBus_(Wire, SCREEN_ADDRESS) {}
+
+  void begin() {
+    dht_.begin();
+    firebase_.begin(FIREBASE_DB_URL);
+  }
+
+  unsigned long millis() override { return ::millis(); }
+  unsigned long micros() override { return ::micros(); }
+  uint32_t random() override { return esp_random(); }
+  void log(const char* line) override { Serial.println(line); }
+  void logFrame(const uint8_t* frame, size_t len) override { Serial.write(frame, len); }
+  size_t logRoom() override { return Serial.availableForWrite(); }
+
+  void heapInfo(HeapInfo& out) override {
+    out.freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    out.largestFree = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    out.minFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+#ifdef HEAP_HOOKS
+    out.counting = true;
+#else
+    out.counting = false;
+#endif
+  }
+
+  // 0 until NTP has set the clock
+  long long epochMillis() override {
+    time_t now = time(nullptr);
+    if (now < NTP_VALID_AFTER) return 0;
+    return (long long)now * 1000;
+  }
+
+  //  SENSORS
+
+  bool startADC() {
+#ifdef ADC_CONTINUOUS
+    const uint8_t pins[] = { SOIL_PIN, LDR_PIN };
+    if (!analogContinuous(pins, 2, ADC_CONVERSIONS_PER_PIN, ADC_SAMPLE_HZ, nullptr)) return false;
+    return analogContinuousStart();
+#else
+    return true;
+#endif
+  }
+
+#ifdef ADC_CONTINUOUS
+  uint32_t adcResultHz() override { return ADC_RESULT_HZ; }
+#else
+  uint32_t adcResultHz() override { return 1000 / ADC_POLL_MS; }
+#endif
+
+  size_t readAdc(AdcSample* out, size_t max) override {
+    size_t n = 0;
+#ifdef ADC_CONTINUOUS
+    adc_continuous_data_t* result = nullptr;
+    while (n + 2 <= max && analogContinuousRead(&result, 0)) {
+      for (uint8_t i = 0; i < 2; i++) {
+        out[n].channel = result[i].pin == SOIL_PIN ? ADC_SOIL : ADC_LIGHT;
+        out[n].raw = result[i].avg_read_raw;
+        n++;
+      }
+    }
+#else
+    if (max >= 2) {
+      out[n++] = AdcSample{ADC_SOIL, (uint16_t)analogRead(SOIL_PIN)};
+      out[n++] = AdcSample{ADC_LIGHT, (uint16_t)analogRead(LDR_PIN)};
+    }
+#endif
+    return n;
+  }
+
+  void pollClimate() override { dht_.poll(); }
+  bool takeFreshClimate() override { return dht_.takeFresh(); }
+  DhtSample climate() override { return dht_.sample(); }
+  unsigned long climateReads() override { return dht_.reads(); }
+  unsigned long climateFailures() override { return dht_.failures(); }
+
+  //  LINK (none of these block)
+
+  bool linkUp() override { return WiFi.status() == WL_CONNECTED; }
+
+  void startConnect() override {
+    WiFi.disconnect();
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);  // the state machine owns retries
+    WiFi.begin(WIFI_SSID, WIFI_PASS);
+  }
+
+  void startTimeSync() override { configTime(0, 0, "pool.ntp.org", "time.nist.gov"); }
+  bool timeValid() override { return time(nullptr) >= NTP_VALID_AFTER; }
+
+  void linkChanged(ConnState, ConnState to) override {
+    if (to == CONN_CONNECTED) {
+      Serial.print("Connected! IP: ");
+      Serial.println(WiFi.localIP());
+      Serial.println("📊 Dashboard: http://" + WiFi.localIP().toString());
+    }
+  }
+
+  //  UPLOAD
+
+  int httpSend(const char* method, const char* path, const char* body, size_t len,
+               PostTiming& t) override {
+    return firebase_.send(method, path, body, len, t);
+  }
+
+  void httpStop() override { firebase_.stop(); }
+
+  LogStorage* openLogStorage() override {
+    if (!LittleFS.begin(true)) return nullptr;
+    if (LittleFS.exists(OFFLINE_LOG_OLD_PATH)) LittleFS.remove(OFFLINE_LOG_OLD_PATH);
+    if (!offlineDir_.open(LittleFS, OFFLINE_LOG_DIR)) return nullptr;
+    return &offlineDir_;
+  }
+
+  //  UI
+
+  // Pushes only the OLED pages/columns that changed, OLED_PUSH_BYTES_MAX
+  // per call
+  bool showStatus(const Reading& r, Mood mood) override {
+    unsigned long start = ::micros();
+    screen_.update(r.soil, r.tempC, r.hum, mood);
+    OledDirty& dirty = screen_.view().dirty();
+#ifdef OLED_FULL_REFRESH
+    dirty.markAll();
+#endif
+    if (!dirty.any()) return true;
+    oledBus_.resetBytes();
+    bool done = pushDirty(oledBus_, display.getBuffer(), dirty, OLED_PUSH_BYTES_MAX);
+    core.logEvent(LOG_OLED_REFRESH, (unsigned)oledBus_.bytes(), ::micros() - start);
+    return done;
+  }
+
+  void liveSend(uint8_t client, const uint8_t* data, size_t len, bool binary) override {
+    if (binary) {
+      webSocket.sendBIN(client, data, len);
+    } else {
+      webSocket.sendTXT(client, (const char*)data, len);
+    }
+  }
+
+ private:
+  DhtAsync dht_;
+  StatusScreen<Adafruit_SSD1306> screen_;   // retained layout, see OledView.h
+  WireOledBus oledBus_;
+  FirebaseClient firebase_;
+  FsStorage offlineDir_;
+};
+
+EspHal hal;
+PlantCore core(hal);
+
+//  HELPER FUNCTIONS
 
 // OLED Display initialization
 bool initOLED() {
@@ -78,135 +276,27 @@ bool initOLED() {
   display.println("Plant Buddy");
   display.println("Starting...");
   display.display();
+  Wire.setClock(OLED_I2C_HZ);
   Serial.println("OLED initialized!");
   return true;
 }
 
-// Update OLED with plant status
-void updateOLED(int soil, float temp, float hum, const String& mood) {
-  display.clearDisplay();
-  
-  // Title
-  display.setTextSize(1);
-  display.setCursor(0, 0);
-  display.println("Smart Plant Buddy");
-  display.drawLine(0, 10, 128, 10, SSD1306_WHITE);
-  
-  // Mood face (large)
-  display.setTextSize(2);
-  display.setCursor(20, 15);
-  display.print(getMoodFace(mood));
-  
-  // Mood text
-  display.setTextSize(1);
-  display.setCursor(20, 35);
-  display.println(getMoodText(mood));
-  
-  // Sensor readings
-  display.setCursor(0, 48);
-  display.print("S:");
-  display.print(soil);
-  display.print(" T:");
-  display.print(temp, 0);
-  display.print("C");
-  
-  display.setCursor(0, 56);
-  display.print("H:");
-  display.print(hum, 0);
-  display.print("%");
-  
-  display.display();
-}
-
-// WiFi connection
-void connectWiFi() {
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
-  Serial.print("Connecting to WiFi");
-  
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setCursor(0, 20);
-  display.println("Connecting WiFi...");
-  display.display();
-
-  unsigned long start = millis();
-  while (WiFi.status() != WL_CONNECTED && millis() - start < 15000) {
-    Serial.print(".");
-    delay(500);
+// Serve the gzipped dashboard straight from flash. The response streams the
+// const array without copying it to RAM; a matching ETag gets a bodyless 304.
+void handleDashboard(AsyncWebServerRequest* request) {
+  if (request->hasHeader("If-None-Match") &&
+      request->header("If-None-Match") == DASHBOARD_ETAG) {
+    AsyncWebServerResponse* notModified = request->beginResponse(304);
+    notModified->addHeader("ETag", DASHBOARD_ETAG);
+    request->send(notModified);
+    return;
   }
-  Serial.println();
-
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.print("Connected! IP: ");
-    Serial.println(WiFi.localIP());
-    
-    display.clearDisplay();
-    display.setCursor(0, 10);
-    display.println("WiFi Connected!");
-    display.setCursor(0, 25);
-    display.print("IP: ");
-    display.println(WiFi.localIP());
-    display.display();
-    delay(2000);
-  } else {
-    Serial.println("WiFi failed!");
-  }
-
-  // NTP time sync
-  configTime(0, 0, "pool.ntp.org", "time.nist.gov");
-  Serial.print("Syncing time");
-  time_t now = time(nullptr);
-  while (now < 8 * 3600 * 2) {
-    delay(500);
-    Serial.print(".");
-    now = time(nullptr);
-  }
-  Serial.println("\nTime synced!");
-}
-
-// Post to Firebase
-bool postToFirebase(int soil, int ldr, float tempC, float hum, const String &mood) {
-  if (WiFi.status() != WL_CONNECTED) return false;
-
-  HTTPClient http;
-  String url = String(FIREBASE_DB_URL) + "/plants/plant1/logs.json";
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-
-  long long timestampMs = getEpochMillis();
-
-  String json = "{";
-  json += "\"timestamp\":" + String(timestampMs) + ",";
-  json += "\"soil_raw\":" + String(soil) + ",";
-  json += "\"light_raw\":" + String(ldr) + ",";
-  json += "\"temp_c\":" + String(tempC, 1) + ",";
-  json += "\"hum\":" + String(hum, 0) + ",";
-  json += "\"mood\":\"" + mood + "\"";
-  json += "}";
-
-  int code = http.POST(json);
-  Serial.print("Firebase POST: ");
-  Serial.println(code);
-
-  http.end();
-  return (code > 0 && code < 400);
-}
-
-// Infer plant mood
-String inferMood(int soil, int ldr, float tempC) {
-  // For RESISTIVE sensors
-  bool tooDry = soil < 1500;
-  bool goodSoil = (soil >= 1500 && soil <= 3100);
-  bool tooWet = soil > 3500;
-  bool tooBright = ldr > 2500;
-  bool tooHot = tempC >= 27.0;
-
-  if (tooDry) return "thirsty";
-  if (tooWet) return "drowning";
-  if (tooBright || tooHot) return "hot";
-  if (goodSoil) return "happy";
-  return "ok";
+  AsyncWebServerResponse* response =
+    request->beginResponse_P(200, "text/html", DASHBOARD_HTML_GZ, DASHBOARD_HTML_GZ_LEN);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", DASHBOARD_ETAG);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
 // WebSocket event handler
@@ -214,41 +304,89 @@ void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length
   switch(type) {
     case WStype_DISCONNECTED:
       Serial.printf("[%u] Disconnected!\n", num);
+      core.liveDisconnected(num);
       break;
     case WStype_CONNECTED:
       {
         IPAddress ip = webSocket.remoteIP(num);
         Serial.printf("[%u] Connected from %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
+        core.liveConnected(num);
       }
       break;
+    case WStype_TEXT:
+      core.liveText(num, payload, length);
+      break;
+    default:
+      break;
+  }
+}
+
+//  SENSOR TASK (SENSOR_CORE)
+
+void sensorTaskMain(void*) {
+  if (!hal.startADC()) {
+    Serial.println("Continuous ADC failed to start");
+  }
+  for (;;) {
+    if (!core.sensorTick()) {
+      vTaskDelay(1);
+    }
+  }
+}
+
+//  NETWORK TASK (NET_CORE)
+
+void netTaskMain(void*) {
+  core.beginNet();
+  for (;;) {
+    if (!core.netTick()) {
+      vTaskDelay(pdMS_TO_TICKS(10));
+    }
   }
 }
 
 // ===== SETUP =====
 void setup() {
+  Serial.setTxBufferSize(SERIAL_TX_BUFFER);   // lets the log drain without blocking loop()
   Serial.begin(115200);
   Serial.println("\n\nSmart Plant Buddy - Simple Version");
   Serial.println("===================================");
-  
+
   // start I2C for OLED
   Wire.begin();
-  
+
   // start OLED
   if (!initOLED()) {
     Serial.println("OLED not found, continuing without display");
   }
-  
-  // start DHT
-  dht.begin();
-  
-  // Connectz to WiFi
-  connectWiFi();
-  
+
+  // start DHT and the Firebase client
+  hal.begin();
+
+  // Start connecting to WiFi; loop() keeps polling until it's up
+  display.clearDisplay();
+  display.setTextSize(1);
+  display.setCursor(0, 20);
+  display.println("Connecting WiFi...");
+  display.display();
+
+  // Mood thresholds from the selected plant profile, and all periodic tasks
+  core.begin(PLANT_TYPE);
+
   // Start WebSocket server
   webSocket.begin();
   webSocket.onEvent(webSocketEvent);
   Serial.println("WebSocket server started on port 81");
-  
+
+  // Start HTTP server for the dashboard
+  httpServer.on("/", HTTP_GET, handleDashboard);
+  httpServer.on("/index.html", HTTP_GET, handleDashboard);
+  httpServer.onNotFound([](AsyncWebServerRequest* request) {
+    request->send(404, "text/plain", "Not found");
+  });
+  httpServer.begin();
+  Serial.println("Dashboard server started on port 80");
+
   // Ready screen
   display.clearDisplay();
   display.setTextSize(2);
@@ -256,70 +394,39 @@ void setup() {
   display.println("READY!");
   display.display();
   delay(1000);
-  
+
+  // Acquisition and networking each get their own pinned task
+  xTaskCreatePinnedToCore(sensorTaskMain, "sensors", SENSOR_STACK, nullptr, 2, nullptr, SENSOR_CORE);
+  xTaskCreatePinnedToCore(netTaskMain, "net", NET_STACK, nullptr, 1, nullptr, NET_CORE);
+
   Serial.println("✅ Setup complete!");
-  Serial.println("📊 Dashboard: http://" + WiFi.localIP().toString());
+}
+
+// Collect a line from the serial console and hand it to the core
+void pollSerialCommand() {
+  static char line[32];
+  static uint8_t len = 0;
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c == '\n' || c == '\r') {
+      if (len == 0) continue;
+      line[len] = '\0';
+      len = 0;
+      core.command(line);
+    } else if (len < sizeof(line) - 1) {
+      line[len++] = c;
+    }
+  }
 }
 
 // The main loop
 void loop() {
-  // Handle WebSocket
+  // Handle WebSocket between every task so clients are never starved
   webSocket.loop();
-  
-  // Auto reconnect WiFi
-  if (WiFi.status() != WL_CONNECTED) {
-    connectWiFi();
-  }
+  pollSerialCommand();
 
-  // Read sensors with averaging for stability
-  int soil = 0;
-  for(int i = 0; i < 10; i++) {
-    soil += analogRead(SOIL_PIN);
-    delay(10);
-  }
-  soil = soil / 10;
-  
-  int ldr = analogRead(LDR_PIN);
-  float hum = dht.readHumidity();
-  float tempC = dht.readTemperature();
-
-  if (isnan(hum) || isnan(tempC)) {
-    Serial.println("DHT11 read failed");
-    hum = -1;
-    tempC = -100;
+  // Run at most one due task; idle briefly if nothing is due
+  if (!core.loopTick()) {
+    delay(1);
   }
-
-  // Determine mood
-  String mood = inferMood(soil, ldr, tempC);
-  currentMood = mood;
-  currentSoil = soil;
-
-  // Print to serial
-  Serial.printf("Soil=%d Light=%d Temp=%.1fC Hum=%.0f%% Mood=%s\n",
-                soil, ldr, tempC, hum, mood.c_str());
-
-  // Update OLED display every 2 seconds
-  if (millis() - lastOLEDUpdate > OLED_UPDATE_MS) {
-    updateOLED(soil, tempC, hum, mood);
-    lastOLEDUpdate = millis();
-  }
-
-  // Send real-time data via WebSocket
-  String wsData = "{";
-  wsData += "\"soil\":" + String(soil) + ",";
-  wsData += "\"light\":" + String(ldr) + ",";
-  wsData += "\"temp\":" + String(tempC, 1) + ",";
-  wsData += "\"hum\":" + String(hum, 0) + ",";
-  wsData += "\"mood\":\"" + mood + "\"";
-  wsData += "}";
-  webSocket.broadcastTXT(wsData);
-
-  // Post to Firebase every 15 minutes
-  if (millis() - lastPost > POST_INTERVAL_MS) {
-    bool ok = postToFirebase(soil, ldr, tempC, hum, mood);
-    Serial.println(ok ? "✓ Posted to Firebase" : "✗ Post failed");
-    lastPost = millis();
-  }
-
-  delay(1000);
-}
\ No newline at end of file
+}
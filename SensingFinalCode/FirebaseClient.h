@@ -0,0 +1,130 @@
+// Smart Plant Buddy - persistent Firebase REST connection
+//
+// Keeps one WiFiClient/WiFiClientSecure and HTTPClient alive across posts
+// with keep-alive, so only the first request (or the first after a drop)
+// pays for DNS, TCP and the TLS handshake, and the ~40 KB TLS context is
+// allocated once instead of on every post. A request that fails on a reused
+// socket is retried once on a fresh connection.
+//
+// Every request records how long each phase took: DNS lookup, TCP connect,
+// TLS handshake and the HTTP transfer (request + response). Phases that were
+// skipped because the connection was reused read 0.
+
+#pragma once
+
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include "Hal.h"
+
+class FirebaseClient {
+ public:
+  FirebaseClient() : port_(80), tls_(false), requests_(0), reconnects_(0) {
+    host_[0] = '\0';
+  }
+
+  // baseUrl like "https://<project>.firebaseio.com"
+  void begin(const char* baseUrl) {
+    base_ = baseUrl;
+    tls_ = strncmp(baseUrl, "https://", 8) == 0;
+    const char* h = strstr(baseUrl, "://");
+    h = h ? h + 3 : baseUrl;
+    size_t n = strcspn(h, ":/");
+    if (n >= sizeof(host_)) n = sizeof(host_) - 1;
+    memcpy(host_, h, n);
+    host_[n] = '\0';
+    port_ = h[n] == ':' ? atoi(h + n + 1) : (tls_ ? 443 : 80);
+
+#ifdef FIREBASE_ROOT_CA
+    secure_.setCACert(FIREBASE_ROOT_CA);
+#else
+    secure_.setInsecure();
+#endif
+    http_.setReuse(true);
+    http_.setTimeout(10000);
+  }
+
+  // Send method (e.g. "PATCH") with a JSON body to base + path
+  int send(const char* method, const char* path, const char* json, size_t len, PostTiming& t) {
+    memset(&t, 0, sizeof(t));
+    t.code = request(method, path, json, len, t);
+    if (t.code < 0 && t.reused) {
+      // Server closed the idle connection; start over once
+      reconnects_++;
+      stop();
+      t.code = request(method, path, json, len, t);
+    }
+    requests_++;
+    return t.code;
+  }
+
+  void stop() {
+    http_.end();
+    client().stop();
+  }
+
+  bool connected() { return client().connected(); }
+  unsigned long requests() const { return requests_; }
+  unsigned long reconnects() const { return reconnects_; }
+
+ private:
+  WiFiClient& client() { return tls_ ? (WiFiClient&)secure_ : plain_; }
+
+  int request(const char* method, const char* path, const char* json, size_t len, PostTiming& t) {
+    t.reused = client().connected();
+    if (!t.reused && !connect(t)) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+    // HTTPClient sees the socket is already open and reuses it
+    unsigned long start = micros();
+    String url = base_ + path;
+    http_.begin(client(), url);
+    http_.addHeader("Content-Type", "application/json");
+    int code = http_.sendRequest(method, (uint8_t*)json, len);
+    http_.end();
+    t.transferUs = micros() - start;
+    return code;
+  }
+
+  bool connect(PostTiming& t) {
+    unsigned long start = micros();
+    IPAddress ip;
+    if (!WiFi.hostByName(host_, ip)) return false;
+    t.dnsUs = micros() - start;
+
+    // lwIP caches the lookup, so connecting by name doesn't resolve again
+    // and keeps SNI/hostname checks working for TLS.
+    start = micros();
+    if (!tls_) {
+      if (!plain_.connect(host_, port_)) return false;
+      t.connectUs = micros() - start;
+      plain_.setNoDelay(true);
+      return true;
+    }
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+    secure_.setPlainStart();
+    if (!secure_.connect(host_, port_)) return false;
+    t.connectUs = micros() - start;
+    start = micros();
+    if (!secure_.startTLS()) {
+      secure_.stop();
+      return false;
+    }
+    t.handshakeUs = micros() - start;
+#else
+    if (!secure_.connect(host_, port_)) return false;
+    t.handshakeUs = micros() - start;
+#endif
+    secure_.setNoDelay(true);
+    return true;
+  }
+
+  String base_;
+  char host_[96];
+  uint16_t port_;
+  bool tls_;
+  WiFiClient plain_;
+  WiFiClientSecure secure_;
+  HTTPClient http_;
+  unsigned long requests_;
+  unsigned long reconnects_;
+};
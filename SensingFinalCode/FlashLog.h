@@ -0,0 +1,412 @@
+// Smart Plant Buddy - offline store-and-forward log
+//
+// Append-only ring of fixed-size records, kept in segment files. Readings
+// whose upload failed are appended here with their push ID and drained in
+// batches once the link is back. For a ring of S segments of R slots,
+// the files, numbered through LogStorage, are:
+//
+//   0          [cursor 0][cursor 1]
+//   1..S+1     segments; record seq s is slot s % R of segment s / R, in
+//              file 1 + (s / R) % (S + 1)
+//
+// A segment file is only ever appended to, and removed whole once every
+// record in it is sent, or when the ring is full and its oldest segment is
+// dropped for new records. On LittleFS an append copies at most the file's
+// last block, and the 32-byte cursor file is small enough to be kept
+// inline in its directory entry, so no write rewrites the rest of the log.
+//
+// Each slot carries a magic, its seq and a CRC32, so a write torn by power
+// loss simply fails validation on boot; open() pads the torn slot out so
+// appends stay on slot boundaries. The tail (oldest unsent seq) is stored
+// in two alternating cursor copies, each with a generation number and CRC;
+// the newest valid copy wins. open() also checks the flash has room for
+// the whole ring, so a full flash shows up at boot, not weeks later.
+//
+// Storage goes through LogStorage: a LittleFS directory on the device, one
+// on the host's filesystem, so recovery and drain rate can be exercised
+// off-device (plant_bench --check flashlog/ cuts power mid-write at every
+// byte).
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "Reading.h"
+#include "ReadingCodec.h"
+#include "FirebaseBatch.h"
+
+#ifdef ARDUINO
+#include <FS.h>
+#include <LittleFS.h>
+#else
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#endif
+
+//  STORAGE BACKENDS
+
+// Numbered files in one directory. A missing file has size 0; write()
+// and append() create it.
+class LogStorage {
+ public:
+  virtual ~LogStorage() {}
+  virtual bool read(uint8_t file, uint32_t offset, void* buf, size_t len) = 0;
+  virtual bool write(uint8_t file, uint32_t offset, const void* buf, size_t len) = 0;
+  virtual bool append(uint8_t file, const void* buf, size_t len) = 0;
+  virtual bool remove(uint8_t file) = 0;
+  virtual uint32_t size(uint8_t file) = 0;
+  virtual uint32_t freeBytes() = 0;   // room left for the log's files
+};
+
+const size_t LOG_PATH_MAX = 64;
+
+#ifdef ARDUINO
+
+// A directory on LittleFS. Every call opens and closes its file, which
+// commits it.
+class FsStorage : public LogStorage {
+ public:
+  FsStorage() : fs_(nullptr) { dir_[0] = '\0'; }
+
+  bool open(fs::LittleFSFS& fs, const char* dir) {
+    fs_ = &fs;
+    snprintf(dir_, sizeof(dir_), "%s", dir);
+    return fs.exists(dir) || fs.mkdir(dir);
+  }
+
+  bool read(uint8_t file, uint32_t offset, void* buf, size_t len) {
+    const char* p = path(file);
+    if (!fs_->exists(p)) return false;
+    File f = fs_->open(p, "r");
+    bool ok = f && f.seek(offset) && f.read((uint8_t*)buf, len) == len;
+    f.close();
+    return ok;
+  }
+
+  bool write(uint8_t file, uint32_t offset, const void* buf, size_t len) {
+    const char* p = path(file);
+    File f = fs_->open(p, fs_->exists(p) ? "r+" : "w");
+    bool ok = f && f.seek(offset) && f.write((const uint8_t*)buf, len) == len;
+    f.close();
+    return ok;
+  }
+
+  bool append(uint8_t file, const void* buf, size_t len) {
+    File f = fs_->open(path(file), "a");
+    bool ok = f && f.write((const uint8_t*)buf, len) == len;
+    f.close();
+    return ok;
+  }
+
+  bool remove(uint8_t file) {
+    const char* p = path(file);
+    return !fs_->exists(p) || fs_->remove(p);
+  }
+
+  uint32_t size(uint8_t file) {
+    const char* p = path(file);
+    if (!fs_->exists(p)) return 0;
+    File f = fs_->open(p, "r");
+    uint32_t n = f ? f.size() : 0;
+    f.close();
+    return n;
+  }
+
+  uint32_t freeBytes() { return fs_->totalBytes() - fs_->usedBytes(); }
+
+ private:
+  const char* path(uint8_t file) {
+    snprintf(path_, sizeof(path_), "%s/%02u", dir_, file);
+    return path_;
+  }
+
+  fs::LittleFSFS* fs_;
+  char dir_[LOG_PATH_MAX];
+  char path_[LOG_PATH_MAX + 4];
+};
+
+#else
+
+// A directory via stdio, for host builds
+class StdioStorage : public LogStorage {
+ public:
+  StdioStorage() { dir_[0] = '\0'; }
+
+  bool open(const char* dir) {
+    snprintf(dir_, sizeof(dir_), "%s", dir);
+    struct stat st;
+    if (stat(dir, &st) == 0) return S_ISDIR(st.st_mode);
+    return mkdir(dir, 0755) == 0;
+  }
+
+  bool read(uint8_t file, uint32_t offset, void* buf, size_t len) {
+    FILE* f = fopen(path(file), "rb");
+    if (!f) return false;
+    bool ok = fseek(f, offset, SEEK_SET) == 0 && fread(buf, 1, len, f) == len;
+    fclose(f);
+    return ok;
+  }
+
+  bool write(uint8_t file, uint32_t offset, const void* buf, size_t len) {
+    FILE* f = fopen(path(file), "r+b");
+    if (!f) f = fopen(path(file), "w+b");
+    if (!f) return false;
+    bool ok = fseek(f, offset, SEEK_SET) == 0 && fwrite(buf, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+  }
+
+  bool append(uint8_t file, const void* buf, size_t len) {
+    FILE* f = fopen(path(file), "ab");
+    if (!f) return false;
+    bool ok = fwrite(buf, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+  }
+
+  bool remove(uint8_t file) { return ::remove(path(file)) == 0 || errno == ENOENT; }
+
+  uint32_t size(uint8_t file) {
+    struct stat st;
+    return stat(path(file), &st) == 0 ? (uint32_t)st.st_size : 0;
+  }
+
+  uint32_t freeBytes() {
+    struct statvfs vfs;
+    if (statvfs(dir_, &vfs) != 0) return 0;
+    unsigned long long n = (unsigned long long)vfs.f_bavail * vfs.f_frsize;
+    return n > 0xffffffffULL ? 0xffffffffU : (uint32_t)n;
+  }
+
+ private:
+  const char* path(uint8_t file) {
+    snprintf(path_, sizeof(path_), "%s/%02u", dir_, file);
+    return path_;
+  }
+
+  char dir_[LOG_PATH_MAX];
+  char path_[LOG_PATH_MAX + 4];
+};
+
+#endif
+
+//  CRC32 (IEEE, bitwise; records are small and written rarely)
+
+inline uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+//  LOG
+
+struct FlashRecord {
+  uint32_t seq;
+  char key[PUSH_ID_LEN + 1];
+  Reading reading;
+};
+
+class FlashLog {
+ public:
+  static const uint32_t RECORD_MAGIC = 0x504C4F47;  // "PLOG"
+  static const uint32_t CURSOR_MAGIC = 0x50435552;  // "PCUR"
+  static const size_t CURSOR_SIZE = 16;             // magic, gen, tail, crc
+  static const size_t SLOT_SIZE = 8 + PUSH_ID_LEN + READING_BIN_SIZE + 4;
+  static const uint8_t CURSOR_FILE = 0;
+
+  // slots is rounded up to whole segments of segmentSlots; at most 253
+  // segments
+  FlashLog(LogStorage& storage, uint32_t slots, uint32_t segmentSlots)
+    : storage_(storage), segSlots_(segmentSlots ? segmentSlots : 1),
+      segments_((slots + segSlots_ - 1) / segSlots_), head_(0), tail_(0), gen_(0),
+      dropped_(0) {}
+
+  // Recover head and tail from storage, removing segments already sent and
+  // padding a torn last slot. No files is a valid, empty log. False if the
+  // flash cannot hold the whole ring.
+  bool open() {
+    head_ = tail_ = 0;
+    gen_ = 0;
+    if (storage_.size(CURSOR_FILE) < 2 * CURSOR_SIZE) {
+      uint8_t zeros[2 * CURSOR_SIZE];
+      memset(zeros, 0, sizeof(zeros));
+      if (!storage_.write(CURSOR_FILE, 0, zeros, sizeof(zeros))) return false;
+    }
+    for (uint32_t i = 0; i < 2; i++) {
+      uint32_t gen, tail;
+      if (readCursor(i, gen, tail) && gen >= gen_) {
+        gen_ = gen;
+        tail_ = tail;
+      }
+    }
+
+    // Each segment file's first valid slot says which segment it holds
+    bool any = false;
+    uint32_t first = 0, used = 0, headBytes = 0;
+    uint8_t headFile = 0;
+    for (uint8_t file = 1; file <= segments_ + 1; file++) {
+      uint32_t bytes = storage_.size(file);
+      uint32_t count = (bytes + SLOT_SIZE - 1) / SLOT_SIZE;
+      uint32_t seg;
+      if (!segmentOf(file, count, seg) || seg * segSlots_ + count <= tail_) {
+        storage_.remove(file);
+        continue;
+      }
+      uint32_t end = seg * segSlots_ + count;
+      if (!any || end > head_) {
+        head_ = end;
+        headFile = file;
+        headBytes = bytes;
+      }
+      if (!any || seg * segSlots_ < first) first = seg * segSlots_;
+      any = true;
+      used += bytes;
+    }
+    if (!any) {
+      // Start the next append on a segment boundary
+      tail_ = head_ = (tail_ + segSlots_ - 1) / segSlots_ * segSlots_;
+    } else {
+      if (headBytes % SLOT_SIZE) {
+        uint8_t zeros[SLOT_SIZE];
+        memset(zeros, 0, sizeof(zeros));
+        if (!storage_.append(headFile, zeros, SLOT_SIZE - headBytes % SLOT_SIZE)) return false;
+      }
+      if (tail_ < first) tail_ = first;
+      if (head_ - tail_ > capacity()) tail_ = head_ - capacity();
+    }
+    return (uint64_t)storage_.freeBytes() + used >= bytesNeeded() - 2 * CURSOR_SIZE;
+  }
+
+  bool append(const char* key, const Reading& r) {
+    if (head_ - tail_ >= capacity() && !dropOldest()) return false;
+    uint32_t seq = head_;
+    uint8_t file = segmentFile(seq / segSlots_);
+    // A new segment reuses the file of one long gone; clear any leftover
+    if (seq % segSlots_ == 0 && !storage_.remove(file)) return false;
+    uint8_t slot[SLOT_SIZE];
+    uint32_t magic = RECORD_MAGIC;
+    memcpy(slot, &magic, 4);
+    memcpy(slot + 4, &seq, 4);
+    memcpy(slot + 8, key, PUSH_ID_LEN);
+    encodeReading(slot + 8 + PUSH_ID_LEN, READING_BIN_SIZE, r);
+    uint32_t crc = crc32(slot, SLOT_SIZE - 4);
+    memcpy(slot + SLOT_SIZE - 4, &crc, 4);
+    if (!storage_.append(file, slot, SLOT_SIZE)) return false;
+    head_++;
+    return true;
+  }
+
+  // Copy up to max of the oldest records into out. Corrupt slots are
+  // skipped. *next is the tail to pass to commit() once they are uploaded.
+  size_t peek(FlashRecord* out, size_t max, uint32_t* next) {
+    size_t n = 0;
+    uint32_t seq = tail_;
+    while (seq != head_ && n < max) {
+      if (readSlot(seq, out[n]) && out[n].seq == seq) n++;
+      seq++;
+    }
+    *next = seq;
+    return n;
+  }
+
+  // Mark everything before next as sent, and remove the segments that
+  // leaves empty
+  bool commit(uint32_t next) {
+    if ((int32_t)(next - tail_) <= 0) return true;
+    if ((int32_t)(next - head_) > 0) next = head_;
+    uint32_t from = tail_ / segSlots_;
+    if (!writeCursor(next)) return false;
+    // One left behind by a power cut is removed by the next open()
+    for (uint32_t seg = from; seg < next / segSlots_; seg++) storage_.remove(segmentFile(seg));
+    return true;
+  }
+
+  uint32_t size() const { return head_ - tail_; }
+  uint32_t capacity() const { return segments_ * segSlots_; }
+  unsigned long dropped() const { return dropped_; }
+  // Flash the whole ring takes: the cursors and S + 1 full segments
+  uint32_t bytesNeeded() const {
+    return 2 * CURSOR_SIZE + (segments_ + 1) * segSlots_ * SLOT_SIZE;
+  }
+
+ private:
+  uint8_t segmentFile(uint32_t seg) const { return (uint8_t)(1 + seg % (segments_ + 1)); }
+
+  // Full: drop the rest of the oldest segment, cursor first
+  bool dropOldest() {
+    uint32_t from = tail_ / segSlots_;
+    uint32_t next = (from + 1) * segSlots_;
+    uint32_t lost = next - tail_;
+    if (!writeCursor(next)) return false;
+    dropped_ += lost;
+    storage_.remove(segmentFile(from));
+    return true;
+  }
+
+  bool segmentOf(uint8_t file, uint32_t count, uint32_t& seg) {
+    FlashRecord rec;
+    for (uint32_t i = 0; i < count && i < segSlots_; i++) {
+      if (!readSlotAt(file, i, rec) || rec.seq % segSlots_ != i) continue;
+      seg = rec.seq / segSlots_;
+      return segmentFile(seg) == file;
+    }
+    return false;
+  }
+
+  bool readSlot(uint32_t seq, FlashRecord& rec) {
+    return readSlotAt(segmentFile(seq / segSlots_), seq % segSlots_, rec);
+  }
+
+  bool readSlotAt(uint8_t file, uint32_t slot, FlashRecord& rec) {
+    uint8_t buf[SLOT_SIZE];
+    if (!storage_.read(file, slot * SLOT_SIZE, buf, SLOT_SIZE)) return false;
+    uint32_t magic, crc;
+    memcpy(&magic, buf, 4);
+    memcpy(&crc, buf + SLOT_SIZE - 4, 4);
+    if (magic != RECORD_MAGIC || crc != crc32(buf, SLOT_SIZE - 4)) return false;
+    memcpy(&rec.seq, buf + 4, 4);
+    memcpy(rec.key, buf + 8, PUSH_ID_LEN);
+    rec.key[PUSH_ID_LEN] = '\0';
+    return decodeReading(buf + 8 + PUSH_ID_LEN, READING_BIN_SIZE, rec.reading);
+  }
+
+  bool readCursor(uint32_t copy, uint32_t& gen, uint32_t& tail) {
+    uint8_t buf[CURSOR_SIZE];
+    if (!storage_.read(CURSOR_FILE, copy * CURSOR_SIZE, buf, CURSOR_SIZE)) return false;
+    uint32_t magic, crc;
+    memcpy(&magic, buf, 4);
+    memcpy(&gen, buf + 4, 4);
+    memcpy(&tail, buf + 8, 4);
+    memcpy(&crc, buf + 12, 4);
+    return magic == CURSOR_MAGIC && crc == crc32(buf, 12);
+  }
+
+  // Write the new tail into the older cursor copy, so a torn write leaves
+  // the previous tail intact in the other one
+  bool writeCursor(uint32_t tail) {
+    uint32_t magic = CURSOR_MAGIC;
+    uint32_t gen = gen_ + 1;
+    uint8_t buf[CURSOR_SIZE];
+    memcpy(buf, &magic, 4);
+    memcpy(buf + 4, &gen, 4);
+    memcpy(buf + 8, &tail, 4);
+    uint32_t crc = crc32(buf, 12);
+    memcpy(buf + 12, &crc, 4);
+    if (!storage_.write(CURSOR_FILE, (gen & 1) * CURSOR_SIZE, buf, CURSOR_SIZE)) return false;
+    gen_ = gen;
+    tail_ = tail;
+    return true;
+  }
+
+  LogStorage& storage_;
+  uint32_t segSlots_;
+  uint32_t segments_;
+  uint32_t head_;
+  uint32_t tail_;
+  uint32_t gen_;
+  unsigned long dropped_;
+};
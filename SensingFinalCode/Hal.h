@@ -0,0 +1,77 @@
+// Smart Plant Buddy - hardware abstraction layer
+//
+// Everything PlantCore needs from the outside world: clocks, sensors, the
+// network link, HTTP uploads, flash and the UI. Backends implement it for
+// real hardware (EspHal in ESPcode.cc) or for a simulated plant on Linux
+// (host/LinuxHal.h). Calls are made from the thread that owns the matching
+// part of the core: sensors from the sensor task, uploads and storage from
+// the network task, connection and UI from loop(); heapInfo() from any.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ConnectionManager.h"
+#include "DhtAsync.h"
+#include "FlashLog.h"
+#include "HeapStats.h"
+#include "Mood.h"
+#include "Reading.h"
+
+struct PostTiming {
+  unsigned long dnsUs;
+  unsigned long connectUs;
+  unsigned long handshakeUs;   // includes TCP connect on cores without startTLS()
+  unsigned long transferUs;
+  bool reused;                 // no new connection was needed
+  int code;                    // HTTP status, or negative client error
+};
+
+enum AdcChannel { ADC_SOIL, ADC_LIGHT };
+
+struct AdcSample {
+  uint8_t channel;   // AdcChannel
+  uint16_t raw;      // 12-bit
+};
+
+class Hal {
+ public:
+  virtual ~Hal() {}
+
+  //  CLOCK, LOG & HEAP
+  virtual unsigned long millis() = 0;
+  virtual unsigned long micros() = 0;      // used to time tasks
+  virtual long long epochMillis() = 0;     // wall clock, 0 until synced
+  virtual uint32_t random() = 0;
+  virtual void log(const char* line) = 0;  // one line, no trailing newline
+  virtual void logFrame(const uint8_t* frame, size_t len) = 0;   // binary, see DeferredLog.h
+  virtual size_t logRoom() = 0;            // bytes the console takes without blocking
+  virtual void heapInfo(HeapInfo& out) = 0;
+
+  //  SENSORS (sensor task)
+  virtual uint32_t adcResultHz() = 0;      // samples per channel per second
+  // Copy out whatever the ADC produced since the last call; never blocks
+  virtual size_t readAdc(AdcSample* out, size_t max) = 0;
+  virtual void pollClimate() = 0;          // advance the DHT driver
+  virtual bool takeFreshClimate() = 0;     // true once per good conversion
+  virtual DhtSample climate() = 0;
+  virtual unsigned long climateReads() = 0;
+  virtual unsigned long climateFailures() = 0;
+
+  //  LINK (loop; see ConnectionHooks)
+  virtual bool linkUp() = 0;
+  virtual void startConnect() = 0;
+  virtual void startTimeSync() = 0;
+  virtual bool timeValid() = 0;
+  virtual void linkChanged(ConnState, ConnState) {}
+
+  //  UPLOAD (network task)
+  virtual int httpSend(const char* method, const char* path,
+                       const char* body, size_t len, PostTiming& t) = 0;
+  virtual void httpStop() = 0;
+  virtual LogStorage* openLogStorage() = 0;   // nullptr if there is no flash
+
+  //  UI (loop)
+  virtual bool showStatus(const Reading& r, Mood mood) = 0;   // false: call again, more to draw
+  virtual void liveSend(uint8_t client, const uint8_t* data, size_t len, bool binary) = 0;
+};
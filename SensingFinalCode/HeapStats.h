@@ -0,0 +1,134 @@
+// Smart Plant Buddy - heap and allocation telemetry
+//
+// HeapInfo is the backend's snapshot of the heap: free bytes, the largest
+// free block and the low-water mark. Fragmentation is the share of free
+// memory outside the largest block: 0% when it is one block, near 100%
+// when a TLS handshake can fail with plenty of memory free. HeapWindow
+// keeps the worst of these between two published health records.
+//
+// With HEAP_PROFILE (see PlantConfig.h) the backend also counts every
+// allocation from the allocator's hooks, per core, and HEAP_SCOPE()
+// charges what a block allocated to a PhaseAllocs. A scope reads its own
+// core's counters, so anything another task allocates while preempting
+// it on that core is charged to it as well. On the host a thread stands
+// in for a core: each has its own counters and heapCore() is 0.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+const uint8_t HEAP_CORES = 2;
+
+struct HeapInfo {
+  uint32_t freeBytes;
+  uint32_t largestFree;    // biggest single allocation that would succeed
+  uint32_t minFree;        // lowest freeBytes since boot
+  bool counting;           // allocation counters are live (HEAP_PROFILE)
+};
+
+inline uint8_t heapFragPercent(const HeapInfo& h) {
+  if (h.freeBytes == 0 || h.largestFree >= h.freeBytes) return 0;
+  return (uint8_t)(100 - (uint64_t)h.largestFree * 100 / h.freeBytes);
+}
+
+//  COUNTERS
+
+struct AllocCounter {
+  uint32_t allocs;
+  uint32_t bytes;
+  uint32_t frees;
+};
+
+// Zero-initialised storage, so the hooks can run before any constructor
+__attribute__((always_inline)) inline AllocCounter& allocCounter(uint8_t core) {
+#ifdef ARDUINO
+  static AllocCounter counters[HEAP_CORES];
+#else
+  static thread_local AllocCounter counters[HEAP_CORES];
+#endif
+  return counters[core];
+}
+
+__attribute__((always_inline)) inline uint8_t heapCore() {
+#ifdef ARDUINO
+  return (uint8_t)xPortGetCoreID();
+#else
+  return 0;
+#endif
+}
+
+// For the backend's allocator hooks; realloc counts as an allocation
+__attribute__((always_inline)) inline void countAlloc(size_t size) {
+  AllocCounter& c = allocCounter(heapCore());
+  c.allocs++;
+  c.bytes += size;
+}
+
+__attribute__((always_inline)) inline void countFree() { allocCounter(heapCore()).frees++; }
+
+//  PER PHASE
+
+struct PhaseAllocs {
+  uint32_t allocs;   // running totals
+  uint32_t bytes;
+};
+
+// Charges the allocations made during the enclosing block
+class HeapScope {
+ public:
+  explicit HeapScope(PhaseAllocs& p)
+    : p_(p), core_(heapCore()), allocs_(allocCounter(core_).allocs),
+      bytes_(allocCounter(core_).bytes) {}
+
+  ~HeapScope() {
+    const AllocCounter& c = allocCounter(core_);
+    p_.allocs += c.allocs - allocs_;
+    p_.bytes += c.bytes - bytes_;
+  }
+
+ private:
+  PhaseAllocs& p_;
+  uint8_t core_;
+  uint32_t allocs_;
+  uint32_t bytes_;
+};
+
+#ifdef HEAP_PROFILE
+#define HEAP_CONCAT_(a, b) a##b
+#define HEAP_CONCAT(a, b) HEAP_CONCAT_(a, b)
+#define HEAP_SCOPE(allocs) HeapScope HEAP_CONCAT(heapScope_, __LINE__)(allocs)
+#else
+#define HEAP_SCOPE(allocs)
+#endif
+
+//  WINDOW
+
+// Worst values seen between two health records
+struct HeapWindow {
+  HeapWindow() { reset(); }
+
+  void add(const HeapInfo& h) {
+    uint8_t frag = heapFragPercent(h);
+    if (samples == 0 || h.freeBytes < minFree) minFree = h.freeBytes;
+    if (samples == 0 || h.largestFree < minLargest) minLargest = h.largestFree;
+    if (frag > maxFrag) maxFrag = frag;
+    samples++;
+  }
+
+  void reset() {
+    samples = 0;
+    minFree = 0;
+    minLargest = 0;
+    maxFrag = 0;
+  }
+
+  uint32_t samples;
+  uint32_t minFree;
+  uint32_t minLargest;
+  uint8_t maxFrag;
+};
@@ -0,0 +1,196 @@
+// Smart Plant Buddy - per-phase latency histograms
+//
+// Fixed-bucket log-linear histogram over a free-running cycle counter: each
+// power of two is split into 2^LATENCY_SUB_BITS linear buckets, so any
+// 32-bit duration lands in one of LATENCY_BUCKETS counters with at most
+// 25% bucket width. Recording is a clz, a shift and an increment, with no
+// allocation; percentiles are read back by walking the buckets.
+//
+// Each histogram has one recording thread. Others may read it (a read
+// racing record() is off by the sample in flight) and clear it with
+// requestReset(), which bumps a generation the recorder checks: it clears
+// its own buckets on its next record(), and until then reads see nothing.
+//
+// Everything is compiled in only with LATENCY_PROFILE defined (see
+// PlantConfig.h); without it LATENCY_SCOPE() expands to nothing.
+//
+// The counter is CCOUNT on the ESP32 (per core, so a phase must start and
+// end on the same core, as pinned tasks do), the TSC on x86 hosts and
+// nanoseconds elsewhere. Phases must be shorter than 2^32 ticks: ~17 s on
+// the ESP32 at 240 MHz, ~1 s on a 4 GHz host.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+const uint8_t LATENCY_SUB_BITS = 2;
+const uint8_t LATENCY_BUCKETS = (32 - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS;   // 124
+
+//  COUNTER
+
+#ifndef ARDUINO
+inline uint64_t monotonicNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+inline uint32_t cycleCount() {
+#if defined(ARDUINO)
+  return ESP.getCycleCount();
+#elif defined(__x86_64__) || defined(__i386__)
+  return (uint32_t)__rdtsc();
+#else
+  return (uint32_t)monotonicNs();
+#endif
+}
+
+// Counter ticks per microsecond
+inline uint32_t cycleCounterMhz() {
+#if defined(ARDUINO)
+  return getCpuFrequencyMhz();
+#elif defined(__x86_64__) || defined(__i386__)
+  // Measured once against the monotonic clock
+  static uint32_t mhz = 0;
+  if (mhz == 0) {
+    uint64_t ns0 = monotonicNs();
+    uint64_t tsc0 = __rdtsc();
+    while (monotonicNs() - ns0 < 20000000) {}
+    mhz = (uint32_t)((__rdtsc() - tsc0) * 1000 / (monotonicNs() - ns0));
+    if (mhz == 0) mhz = 1;
+  }
+  return mhz;
+#else
+  return 1000;
+#endif
+}
+
+//  HISTOGRAM
+
+class LatencyHistogram {
+ public:
+  LatencyHistogram() : resetAsked_(0), resetDone_(0) { clear(); }
+
+  // Recording thread only
+  void record(uint32_t cycles) {
+    uint32_t asked = resetAsked_.load(std::memory_order_acquire);
+    if (asked != resetDone_.load(std::memory_order_relaxed)) {
+      clear();
+      resetDone_.store(asked, std::memory_order_release);
+    }
+    counts_[bucket(cycles)]++;
+    count_++;
+    if (cycles > max_) max_ = cycles;
+  }
+
+  // Recording thread only, or while nothing records
+  void reset() {
+    clear();
+    resetDone_.store(resetAsked_.load(std::memory_order_relaxed), std::memory_order_release);
+  }
+
+  // Any thread
+  void requestReset() { resetAsked_.fetch_add(1, std::memory_order_release); }
+
+  // Adds another histogram's samples, e.g. one kept per thread
+  void merge(const LatencyHistogram& o) {
+    if (o.resetPending()) return;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) counts_[i] += o.counts_[i];
+    count_ += o.count_;
+    if (o.max_ > max_) max_ = o.max_;
+  }
+
+  uint32_t count() const { return resetPending() ? 0 : count_; }
+  uint32_t max() const { return resetPending() ? 0 : max_; }
+
+  // Upper edge of the bucket holding the given fraction (in 1/1000) of
+  // samples, capped at the largest sample seen
+  uint32_t percentile(uint16_t permille) const {
+    if (count_ == 0 || resetPending()) return 0;
+    uint64_t target = ((uint64_t)count_ * permille + 999) / 1000;
+    if (target == 0) target = 1;
+    uint64_t seen = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+      seen += counts_[i];
+      if (seen >= target) {
+        uint32_t upper = bucketUpper(i);
+        return upper < max_ ? upper : max_;
+      }
+    }
+    return max_;
+  }
+
+  // Values below 2^SUB_BITS get a bucket each; above, bucket = the
+  // position of the top bit plus the SUB_BITS bits under it
+  static uint8_t bucket(uint32_t v) {
+    if (v < (1u << LATENCY_SUB_BITS)) return (uint8_t)v;
+    uint8_t msb = 31 - __builtin_clz(v);
+    uint8_t sub = (v >> (msb - LATENCY_SUB_BITS)) & ((1u << LATENCY_SUB_BITS) - 1);
+    return (uint8_t)(((msb - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS) + sub);
+  }
+
+  static uint32_t bucketUpper(uint8_t i) {
+    if (i < (1u << LATENCY_SUB_BITS)) return i;
+    uint8_t msb = (i >> LATENCY_SUB_BITS) + LATENCY_SUB_BITS - 1;
+    uint32_t sub = i & ((1u << LATENCY_SUB_BITS) - 1);
+    uint32_t width = 1u << (msb - LATENCY_SUB_BITS);
+    return (1u << msb) + sub * width + (width - 1);
+  }
+
+ private:
+  void clear() {
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) counts_[i] = 0;
+    count_ = 0;
+    max_ = 0;
+  }
+
+  bool resetPending() const {
+    return resetAsked_.load(std::memory_order_acquire) !=
+           resetDone_.load(std::memory_order_acquire);
+  }
+
+  uint32_t counts_[LATENCY_BUCKETS];
+  uint32_t count_;
+  uint32_t max_;
+  std::atomic<uint32_t> resetAsked_;   // bumped by requestReset()
+  std::atomic<uint32_t> resetDone_;    // caught up by the recorder
+};
+
+// Records the lifetime of the enclosing block
+class LatencyScope {
+ public:
+  explicit LatencyScope(LatencyHistogram& h) : h_(h), start_(cycleCount()) {}
+  ~LatencyScope() { h_.record(cycleCount() - start_); }
+
+ private:
+  LatencyHistogram& h_;
+  uint32_t start_;
+};
+
+#ifdef LATENCY_PROFILE
+#define LATENCY_CONCAT_(a, b) a##b
+#define LATENCY_CONCAT(a, b) LATENCY_CONCAT_(a, b)
+#define LATENCY_SCOPE(hist) LatencyScope LATENCY_CONCAT(latencyScope_, __LINE__)(hist)
+#else
+#define LATENCY_SCOPE(hist)
+#endif
+
+// "name n=… p50=…us p99=…us max=…us"
+inline int formatLatency(char* buf, size_t cap, const char* name,
+                         const LatencyHistogram& h, uint32_t mhz) {
+  return snprintf(buf, cap, "%-10s n=%lu p50=%.2fus p99=%.2fus max=%.2fus", name,
+                  (unsigned long)h.count(), (float)h.percentile(500) / mhz,
+                  (float)h.percentile(990) / mhz, (float)h.max() / mhz);
+}
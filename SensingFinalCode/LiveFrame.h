@@ -0,0 +1,38 @@
+// Smart Plant Buddy - binary WebSocket telemetry frame
+//
+// Sent with sendBIN to clients that asked for binary ("mode:bin"); others
+// keep getting the text JSON. Fixed layout, little-endian:
+//
+//   [0]      version (LIVE_FRAME_VERSION)
+//   [1]      mood code (the Mood enum value)
+//   [2..5]   sequence number, +1 per broadcast, so clients can count drops
+//   [6..9]   uptime ms when the reading was taken (monotonic, wraps)
+//   [10..]   the reading as encodeReading() packs it (READING_FIELDS order)
+//
+// Dashboard.html decodes this with a DataView; keep the two in step.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "Mood.h"
+#include "Reading.h"
+#include "ReadingCodec.h"
+
+const uint8_t LIVE_FRAME_VERSION = 1;
+const size_t LIVE_FRAME_HEADER = 10;
+const size_t LIVE_FRAME_SIZE = LIVE_FRAME_HEADER + READING_BIN_SIZE;
+
+// Returns LIVE_FRAME_SIZE, or 0 if cap is too small
+inline size_t writeLiveFrame(uint8_t* buf, size_t cap, uint32_t seq,
+                             const Reading& r, Mood mood) {
+  if (cap < LIVE_FRAME_SIZE) return 0;
+  uint32_t uptime = (uint32_t)r.uptimeMs;
+  buf[0] = LIVE_FRAME_VERSION;
+  buf[1] = mood;
+  memcpy(buf + 2, &seq, 4);
+  memcpy(buf + 6, &uptime, 4);
+  encodeReading(buf + LIVE_FRAME_HEADER, cap - LIVE_FRAME_HEADER, r);
+  return LIVE_FRAME_SIZE;
+}
@@ -0,0 +1,106 @@
+// Smart Plant Buddy - log message table
+//
+// Every deferred log message, by ID. The device records only the ID and
+// the raw arguments (DeferredLog.h); the format strings are used when the
+// loop gets round to printing a record, or off the device entirely by
+// host/decode_log.py, which parses this file. IDs are positions in the
+// table, so a decoder must come from the same revision as the firmware:
+// LOG_STARTED carries LOG_TABLE_HASH to check that. Columns:
+//   ID, module, level, printf format (%d %u %x %f %s, any flags/width)
+
+#pragma once
+
+#include <stdint.h>
+
+#define LOG_MODULES(X) \
+  X(LOG_MOD_SYS,    "sys")    \
+  X(LOG_MOD_SENSOR, "sensor") \
+  X(LOG_MOD_MOOD,   "mood")   \
+  X(LOG_MOD_STATUS, "status") \
+  X(LOG_MOD_WIFI,   "wifi")   \
+  X(LOG_MOD_NET,    "net")    \
+  X(LOG_MOD_UI,     "ui")
+
+#define LOG_MESSAGES(X) \
+  X(LOG_STARTED,         LOG_MOD_SYS,    LOG_LVL_INFO,  "Log started, table %08x") \
+  X(LOG_DROPPED,         LOG_MOD_SYS,    LOG_LVL_WARN,  "%u log messages dropped") \
+  X(LOG_PLANT_UNKNOWN,   LOG_MOD_SYS,    LOG_LVL_WARN,  "Plant type '%s' unknown, using default thresholds") \
+  X(LOG_MOOD_RULES,      LOG_MOD_SYS,    LOG_LVL_INFO,  "Mood rules: %s (%u rules)") \
+  X(LOG_OFFLINE_OPEN,    LOG_MOD_SYS,    LOG_LVL_INFO,  "Offline log: %s, %u readings pending") \
+  X(LOG_HEAP_LOW,        LOG_MOD_SYS,    LOG_LVL_WARN,  "⚠ Heap: largest free block %u bytes (%u free, frag %u%%)") \
+  X(LOG_DHT_FAILED,      LOG_MOD_SENSOR, LOG_LVL_WARN,  "DHT11 read failed (%u of %u), serving value %u ms old") \
+  X(LOG_MOOD_CHANGE,     LOG_MOD_MOOD,   LOG_LVL_INFO,  "Mood %s -> %s (%u times)") \
+  X(LOG_STATUS,          LOG_MOD_STATUS, LOG_LVL_INFO,  "Soil=%d Light=%d Temp=%.1fC Hum=%.0f%% Mood=%s") \
+  X(LOG_WIFI_STATE,      LOG_MOD_WIFI,   LOG_LVL_INFO,  "WiFi: %s -> %s") \
+  X(LOG_TIME_SYNCED,     LOG_MOD_WIFI,   LOG_LVL_INFO,  "Time synced!") \
+  X(LOG_WIFI_RETRY,      LOG_MOD_WIFI,   LOG_LVL_INFO,  "WiFi retry in %u ms") \
+  X(LOG_POST_QUEUE_FULL, LOG_MOD_NET,    LOG_LVL_ERROR, "✗ Post queue full, reading dropped") \
+  X(LOG_PATCH,           LOG_MOD_NET,    LOG_LVL_INFO,  "Firebase PATCH: %d (%u bytes, %s) dns=%uus connect=%uus tls=%uus transfer=%uus") \
+  X(LOG_POSTED,          LOG_MOD_NET,    LOG_LVL_INFO,  "✓ Posted %u readings to Firebase") \
+  X(LOG_POST_KEPT,       LOG_MOD_NET,    LOG_LVL_WARN,  "✗ Post failed, %u readings kept") \
+  X(LOG_POST_SAVED,      LOG_MOD_NET,    LOG_LVL_WARN,  "✗ Post failed, %u readings saved offline (%u pending)") \
+  X(LOG_BACKFILLED,      LOG_MOD_NET,    LOG_LVL_INFO,  "✓ Backfilled %u readings (%u pending)") \
+  X(LOG_BACKDATED,       LOG_MOD_NET,    LOG_LVL_INFO,  "Clock set, %u readings back-dated") \
+  X(LOG_UNDATED_DROPPED, LOG_MOD_NET,    LOG_LVL_WARN,  "✗ Clock not set, oldest reading dropped (%u held)") \
+  X(LOG_UNDATED_SKIPPED, LOG_MOD_NET,    LOG_LVL_WARN,  "✗ Skipped %u offline readings without a timestamp") \
+  X(LOG_HEALTH_PATCH,    LOG_MOD_NET,    LOG_LVL_INFO,  "Health PATCH: %d (%u bytes)") \
+  X(LOG_OLED_REFRESH,    LOG_MOD_UI,     LOG_LVL_DEBUG, "OLED refresh: %u I2C bytes, %u us")
+
+enum LogLevel : uint8_t {
+  LOG_LVL_OFF,
+  LOG_LVL_ERROR,
+  LOG_LVL_WARN,
+  LOG_LVL_INFO,
+  LOG_LVL_DEBUG,
+  LOG_LEVEL_COUNT
+};
+
+enum LogModule : uint8_t {
+#define LOG_MODULE_ENUM(id, name) id,
+  LOG_MODULES(LOG_MODULE_ENUM)
+#undef LOG_MODULE_ENUM
+  LOG_MODULE_COUNT
+};
+
+enum LogId : uint16_t {
+#define LOG_ID_ENUM(id, module, level, fmt) id,
+  LOG_MESSAGES(LOG_ID_ENUM)
+#undef LOG_ID_ENUM
+  LOG_ID_COUNT
+};
+
+const char* const LOG_LEVEL_NAMES[LOG_LEVEL_COUNT] = { "off", "error", "warn", "info", "debug" };
+
+const char* const LOG_MODULE_NAMES[LOG_MODULE_COUNT] = {
+#define LOG_MODULE_NAME(id, name) name,
+  LOG_MODULES(LOG_MODULE_NAME)
+#undef LOG_MODULE_NAME
+};
+
+const LogModule LOG_MODULE_OF[LOG_ID_COUNT] = {
+#define LOG_ID_MODULE(id, module, level, fmt) module,
+  LOG_MESSAGES(LOG_ID_MODULE)
+#undef LOG_ID_MODULE
+};
+
+const LogLevel LOG_LEVEL_OF[LOG_ID_COUNT] = {
+#define LOG_ID_LEVEL(id, module, level, fmt) level,
+  LOG_MESSAGES(LOG_ID_LEVEL)
+#undef LOG_ID_LEVEL
+};
+
+const char* const LOG_FORMATS[LOG_ID_COUNT] = {
+#define LOG_ID_FORMAT(id, module, level, fmt) fmt,
+  LOG_MESSAGES(LOG_ID_FORMAT)
+#undef LOG_ID_FORMAT
+};
+
+// FNV-1a of one format's bytes
+constexpr uint32_t logFnv1a(const char* s, uint32_t h = 2166136261u) {
+  return *s ? logFnv1a(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+// XOR over the table of (format hash + ID); decode_log.py computes the same
+#define LOG_HASH_TERM(id, module, level, fmt) ^ (logFnv1a(fmt) + (uint32_t)id)
+const uint32_t LOG_TABLE_HASH = 0 LOG_MESSAGES(LOG_HASH_TERM);
+#undef LOG_HASH_TERM
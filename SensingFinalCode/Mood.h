@@ -0,0 +1,46 @@
+// Smart Plant Buddy - plant moods
+//
+// A mood is a one-byte enum; everything shown or sent for it comes from
+// the constexpr tables below, indexed by the enum. No string compares and
+// no heap. The enum value is also the mood code in binary WebSocket frames
+// (LiveFrame.h, MOOD_CODES in Dashboard.html), so only append new moods.
+
+#pragma once
+
+#include <stdint.h>
+
+enum Mood : uint8_t {
+  MOOD_OK,
+  MOOD_HAPPY,
+  MOOD_THIRSTY,
+  MOOD_DROWNING,
+  MOOD_HOT,
+  MOOD_COUNT
+};
+
+// JSON/CSV token, as stored in Firebase and matched by the dashboard
+constexpr const char* MOOD_TOKENS[MOOD_COUNT] = {
+  "ok", "happy", "thirsty", "drowning", "hot"
+};
+
+// OLED face, drawn at text size 2
+constexpr const char* MOOD_FACES[MOOD_COUNT] = {
+  "  -_-  ", "  ^_^  ", "  O_O  ", " @_@  ", "  >_<  "
+};
+
+// OLED caption
+constexpr const char* MOOD_TEXTS[MOOD_COUNT] = {
+  "I'm OK", "I'm Happy!", "I'm Thirsty", "Too Wet!", "Too Hot!"
+};
+
+// Same as moodMap in Dashboard.html
+constexpr const char* MOOD_EMOJI[MOOD_COUNT] = {
+  "\xF0\x9F\x98\x90", "\xF0\x9F\x98\x8A", "\xF0\x9F\xA5\xBA", "\xF0\x9F\x98\xB0", "\xF0\x9F\x98\xA1"
+};
+
+// Out-of-range values read as MOOD_OK
+constexpr Mood moodOrOk(uint8_t m) { return m < MOOD_COUNT ? (Mood)m : MOOD_OK; }
+constexpr const char* moodToken(Mood m) { return MOOD_TOKENS[moodOrOk(m)]; }
+constexpr const char* moodFace(Mood m) { return MOOD_FACES[moodOrOk(m)]; }
+constexpr const char* moodText(Mood m) { return MOOD_TEXTS[moodOrOk(m)]; }
+constexpr const char* moodEmoji(Mood m) { return MOOD_EMOJI[moodOrOk(m)]; }
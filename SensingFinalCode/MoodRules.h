@@ -0,0 +1,201 @@
+// Smart Plant Buddy - table-driven mood rules
+//
+// A plantTypes profile (the per-species min/max ranges the dashboard
+// already uses) is compiled once into a short ordered decision table:
+//
+//   soil  < soil.min   -> thirsty
+//   soil  > soil.max   -> drowning
+//   light > light.max  -> hot
+//   temp  > temp.max   -> hot
+//   light/temp/hum outside their other limits -> ok
+//   nothing fired      -> happy
+//
+// Unknown ids get compileDefault() instead: inferMood()'s limits from
+// before profiles, rule for rule, so classify() gives the moods it gave.
+//
+// Every rule has a hysteresis band: once it fires it only clears after the
+// value is back `band` inside the limit, so a reading hovering on a
+// threshold doesn't flap between moods. Thresholds are Q24.8 (Filters.h),
+// so an evaluation is a few integer compares. Readings are rounded down to
+// Q24.8, which keeps `<` and `>=` exact for any value and `>` exact for
+// the integer soil and light. MoodTable never changes after compile() and
+// can be shared between tasks; each stream of readings that wants
+// hysteresis keeps its own MoodTracker.
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "Filters.h"
+#include "Mood.h"
+#include "Reading.h"
+
+struct MoodRange {
+  float min;
+  float max;
+};
+
+// One entry of the Firebase plantTypes node (see embed_profiles.py)
+struct PlantProfile {
+  const char* id;
+  const char* name;
+  MoodRange soil;    // water.soil_min / soil_max
+  MoodRange light;
+  MoodRange temp;
+  MoodRange hum;     // humidity
+};
+
+// Hysteresis per channel, in sensor units
+struct MoodBands {
+  float soil;
+  float light;
+  float temp;
+  float hum;
+};
+
+const MoodBands DEFAULT_MOOD_BANDS = {100, 150, 0.5f, 3};
+
+// inferMood() before profiles
+const char DEFAULT_PROFILE_NAME[] = "Default";
+const int DEFAULT_SOIL_DRY = 1500;        // below: thirsty
+const int DEFAULT_SOIL_HAPPY_MAX = 3100;  // above: ok
+const int DEFAULT_SOIL_WET = 3500;        // above: drowning
+const int DEFAULT_LIGHT_BRIGHT = 2500;    // above: hot
+const float DEFAULT_TEMP_HOT = 27;        // at or above: hot
+
+enum MoodChannel { MOOD_SOIL, MOOD_LIGHT, MOOD_TEMP, MOOD_HUM, MOOD_CHANNELS };
+enum MoodOp { MOOD_BELOW, MOOD_ABOVE, MOOD_AT_LEAST };
+
+// Rounded down rather than to nearest, see above
+inline fix_t toFixFloor(float v) { return (fix_t)floorf(v * FIX_ONE); }
+
+struct MoodRule {
+  uint8_t channel;
+  uint8_t op;
+  fix_t threshold;
+  fix_t band;
+  uint8_t mood;   // a Mood, or MOOD_NONE to only keep the plant from being happy
+};
+
+const uint8_t MOOD_NONE = MOOD_COUNT;
+
+const uint8_t MOOD_RULES_MAX = 8;
+
+class MoodTable {
+ public:
+  MoodTable() : count_(0) {}
+
+  void compile(const PlantProfile& p, const MoodBands& bands = DEFAULT_MOOD_BANDS) {
+    count_ = 0;
+    // Order is priority: the first active rule with a mood wins
+    add(MOOD_SOIL, MOOD_BELOW, p.soil, p.soil.min, bands.soil, MOOD_THIRSTY);
+    add(MOOD_SOIL, MOOD_ABOVE, p.soil, p.soil.max, bands.soil, MOOD_DROWNING);
+    add(MOOD_LIGHT, MOOD_ABOVE, p.light, p.light.max, bands.light, MOOD_HOT);
+    add(MOOD_TEMP, MOOD_ABOVE, p.temp, p.temp.max, bands.temp, MOOD_HOT);
+    add(MOOD_LIGHT, MOOD_BELOW, p.light, p.light.min, bands.light, MOOD_NONE);
+    add(MOOD_TEMP, MOOD_BELOW, p.temp, p.temp.min, bands.temp, MOOD_NONE);
+    add(MOOD_HUM, MOOD_BELOW, p.hum, p.hum.min, bands.hum, MOOD_NONE);
+    add(MOOD_HUM, MOOD_ABOVE, p.hum, p.hum.max, bands.hum, MOOD_NONE);
+  }
+
+  // inferMood(): thirsty, drowning, hot from light or temperature, then
+  // happy only up to DEFAULT_SOIL_HAPPY_MAX and ok above it
+  void compileDefault(const MoodBands& bands = DEFAULT_MOOD_BANDS) {
+    count_ = 0;
+    const MoodRange soil = {DEFAULT_SOIL_DRY, DEFAULT_SOIL_WET};
+    const MoodRange light = {0, DEFAULT_LIGHT_BRIGHT};
+    const MoodRange temp = {-40, DEFAULT_TEMP_HOT};
+    const MoodRange happy = {DEFAULT_SOIL_DRY, DEFAULT_SOIL_HAPPY_MAX};
+    add(MOOD_SOIL, MOOD_BELOW, soil, DEFAULT_SOIL_DRY, bands.soil, MOOD_THIRSTY);
+    add(MOOD_SOIL, MOOD_ABOVE, soil, DEFAULT_SOIL_WET, bands.soil, MOOD_DROWNING);
+    add(MOOD_LIGHT, MOOD_ABOVE, light, DEFAULT_LIGHT_BRIGHT, bands.light, MOOD_HOT);
+    add(MOOD_TEMP, MOOD_AT_LEAST, temp, DEFAULT_TEMP_HOT, bands.temp, MOOD_HOT);
+    add(MOOD_SOIL, MOOD_ABOVE, happy, DEFAULT_SOIL_HAPPY_MAX, bands.soil, MOOD_NONE);
+  }
+
+  // Bit i set = rule i holds. prev is the previous result, which widens
+  // the threshold of rules that were already active by their band.
+  uint8_t conditions(const Reading& r, uint8_t prev) const {
+    fix_t v[MOOD_CHANNELS];
+    v[MOOD_SOIL] = toFix(r.soil);
+    v[MOOD_LIGHT] = toFix(r.light);
+    v[MOOD_TEMP] = toFixFloor(r.tempC);
+    v[MOOD_HUM] = toFixFloor(r.hum);
+    // Failed DHT reads (-100 / -1 sentinels) don't vote
+    uint8_t valid = (1 << MOOD_SOIL) | (1 << MOOD_LIGHT);
+    if (r.tempC > -100) valid |= 1 << MOOD_TEMP;
+    if (r.hum >= 0) valid |= 1 << MOOD_HUM;
+
+    uint8_t out = 0;
+    for (uint8_t i = 0; i < count_; i++) {
+      const MoodRule& rule = rules_[i];
+      if (!(valid & (1 << rule.channel))) continue;
+      bool was = prev & (1 << i);
+      fix_t x = v[rule.channel];
+      fix_t band = was ? rule.band : 0;
+      bool on;
+      if (rule.op == MOOD_BELOW) on = x < rule.threshold + band;
+      else if (rule.op == MOOD_ABOVE) on = x > rule.threshold - band;
+      else on = x >= rule.threshold - band;
+      if (on) out |= 1 << i;
+    }
+    return out;
+  }
+
+  Mood moodFor(uint8_t active) const {
+    for (uint8_t i = 0; i < count_; i++) {
+      if ((active & (1 << i)) && rules_[i].mood != MOOD_NONE) return (Mood)rules_[i].mood;
+    }
+    return active ? MOOD_OK : MOOD_HAPPY;
+  }
+
+  // Without hysteresis, e.g. for readings replayed out of order
+  Mood classify(const Reading& r) const { return moodFor(conditions(r, 0)); }
+
+  uint8_t count() const { return count_; }
+  const MoodRule& rule(uint8_t i) const { return rules_[i]; }
+
+ private:
+  void add(uint8_t ch, uint8_t op, const MoodRange& range, float threshold, float band,
+           uint8_t mood) {
+    // A band wider than half the range would keep rules on forever
+    float half = (range.max - range.min) / 2;
+    if (band > half) band = half > 0 ? half : 0;
+    MoodRule& rule = rules_[count_++];
+    rule.channel = ch;
+    rule.op = op;
+    rule.threshold = toFix(threshold);
+    rule.band = toFix(band);
+    rule.mood = mood;
+  }
+
+  MoodRule rules_[MOOD_RULES_MAX];
+  uint8_t count_;
+};
+
+// Hysteresis state for one stream of readings
+class MoodTracker {
+ public:
+  MoodTracker() : active_(0) {}
+
+  Mood update(const MoodTable& table, const Reading& r) {
+    active_ = table.conditions(r, active_);
+    return table.moodFor(active_);
+  }
+
+  void reset() { active_ = 0; }
+  uint8_t active() const { return active_; }
+
+ private:
+  uint8_t active_;
+};
+
+// Linear search; there are only a handful of profiles
+inline const PlantProfile* findPlantProfile(const PlantProfile* profiles, uint8_t count,
+                                            const char* id) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (strcmp(profiles[i].id, id) == 0) return &profiles[i];
+  }
+  return nullptr;
+}
@@ -0,0 +1,239 @@
+// Smart Plant Buddy - retained-mode OLED layer
+//
+// The screen is a fixed layout of text fields. set() only records a field
+// as changed when its text differs from what is on screen; render() then
+// clears and redraws just those fields in the GFX framebuffer and marks
+// the SSD1306 pages/columns they cover. pushDirty() sends only those
+// windows over I2C, so a refresh where one digit changed moves a few dozen
+// bytes instead of the whole 1 KB buffer.
+//
+// The SSD1306 framebuffer is page-major: 8 pages of 128 column bytes, each
+// byte 8 vertical pixels. The bus is an interface, so the push can be
+// counted or fed into an emulator off the device.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+const uint8_t OLED_COLUMNS = 128;
+const uint8_t OLED_PAGES = 8;
+const uint8_t OLED_FIELDS_MAX = 8;
+const uint8_t OLED_FIELD_CHARS = 16;
+
+//  DIRTY REGIONS
+
+// One column span per page; lo > hi means the page is clean
+class OledDirty {
+ public:
+  OledDirty() { clear(); }
+
+  void mark(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (w <= 0 || h <= 0) return;
+    int16_t x0 = x < 0 ? 0 : x;
+    int16_t x1 = x + w - 1 >= OLED_COLUMNS ? OLED_COLUMNS - 1 : x + w - 1;
+    int16_t p0 = (y < 0 ? 0 : y) / 8;
+    int16_t p1 = (y + h - 1) / 8;
+    if (p1 >= OLED_PAGES) p1 = OLED_PAGES - 1;
+    for (int16_t p = p0; p <= p1 && x0 <= x1; p++) {
+      if (x0 < lo_[p]) lo_[p] = x0;
+      if (x1 > hi_[p]) hi_[p] = x1;
+    }
+  }
+
+  void markAll() { mark(0, 0, OLED_COLUMNS, OLED_PAGES * 8); }
+
+  void clear() {
+    for (uint8_t p = 0; p < OLED_PAGES; p++) {
+      lo_[p] = OLED_COLUMNS;
+      hi_[p] = 0;
+    }
+  }
+
+  void clearPage(uint8_t p) {
+    lo_[p] = OLED_COLUMNS;
+    hi_[p] = 0;
+  }
+
+  bool page(uint8_t p) const { return lo_[p] <= hi_[p]; }
+  uint8_t lo(uint8_t p) const { return lo_[p]; }
+  uint8_t hi(uint8_t p) const { return hi_[p]; }
+
+  bool any() const {
+    for (uint8_t p = 0; p < OLED_PAGES; p++) {
+      if (page(p)) return true;
+    }
+    return false;
+  }
+
+ private:
+  uint8_t lo_[OLED_PAGES];
+  uint8_t hi_[OLED_PAGES];
+};
+
+//  FIELDS
+
+struct OledField {
+  int16_t x, y;
+  uint8_t size;      // GFX text size; glyphs are 6*size x 8*size
+  uint8_t chars;     // width in characters
+  bool changed;
+  char text[OLED_FIELD_CHARS + 1];
+};
+
+class OledView {
+ public:
+  OledView() : count_(0) {}
+
+  // Returns the field's index, used with set()
+  uint8_t addField(int16_t x, int16_t y, uint8_t size, uint8_t chars) {
+    OledField& f = fields_[count_];
+    f.x = x;
+    f.y = y;
+    f.size = size;
+    f.chars = chars > OLED_FIELD_CHARS ? OLED_FIELD_CHARS : chars;
+    f.changed = true;
+    f.text[0] = '\0';
+    return count_++;
+  }
+
+  // Text longer than the field is cut so it can't spill into a neighbour
+  void set(uint8_t i, const char* text) {
+    OledField& f = fields_[i];
+    char clipped[OLED_FIELD_CHARS + 1];
+    uint8_t n = 0;
+    while (n < f.chars && text[n]) {
+      clipped[n] = text[n];
+      n++;
+    }
+    clipped[n] = '\0';
+    if (strcmp(clipped, f.text) == 0) return;
+    memcpy(f.text, clipped, sizeof(clipped));
+    f.changed = true;
+  }
+
+  // Redraw every field, e.g. after something else drew over the screen
+  void invalidate() {
+    for (uint8_t i = 0; i < count_; i++) fields_[i].changed = true;
+    dirty_.markAll();
+  }
+
+  // Draw changed fields into gfx (anything with the Adafruit_GFX text API)
+  template <class Gfx>
+  void render(Gfx& gfx) {
+    for (uint8_t i = 0; i < count_; i++) {
+      OledField& f = fields_[i];
+      if (!f.changed) continue;
+      int16_t w = f.chars * 6 * f.size;
+      int16_t h = 8 * f.size;
+      gfx.fillRect(f.x, f.y, w, h, 0);
+      gfx.setTextSize(f.size);
+      gfx.setCursor(f.x, f.y);
+      gfx.print(f.text);
+      dirty_.mark(f.x, f.y, w, h);
+      f.changed = false;
+    }
+  }
+
+  OledDirty& dirty() { return dirty_; }
+
+ private:
+  OledField fields_[OLED_FIELDS_MAX];
+  uint8_t count_;
+  OledDirty dirty_;
+};
+
+//  PUSH
+
+class OledBus {
+ public:
+  virtual ~OledBus() {}
+  virtual void command(const uint8_t* cmd, size_t len) = 0;
+  virtual void data(const uint8_t* bytes, size_t len) = 0;
+};
+
+// Send the dirty windows of fb (OLED_PAGES * OLED_COLUMNS bytes) and clear
+// them. Consecutive dirty pages share one address window spanning their
+// columns. Assumes horizontal addressing mode, as Adafruit_SSD1306 sets.
+// Stops before the payload would pass maxBytes (but always sends at least
+// one page), leaving the rest dirty; returns true once nothing is left.
+inline bool pushDirty(OledBus& bus, const uint8_t* fb, OledDirty& dirty,
+                      size_t maxBytes = SIZE_MAX) {
+  size_t sent = 0;
+  uint8_t p = 0;
+  while (p < OLED_PAGES) {
+    if (!dirty.page(p)) {
+      p++;
+      continue;
+    }
+    uint8_t first = p;
+    uint8_t lo = dirty.lo(p);
+    uint8_t hi = dirty.hi(p);
+    if (sent > 0 && sent + (hi - lo + 1) > maxBytes) return false;
+    while (p + 1 < OLED_PAGES && dirty.page(p + 1)) {
+      uint8_t nextLo = dirty.lo(p + 1) < lo ? dirty.lo(p + 1) : lo;
+      uint8_t nextHi = dirty.hi(p + 1) > hi ? dirty.hi(p + 1) : hi;
+      size_t bytes = (size_t)(p + 2 - first) * (nextHi - nextLo + 1);
+      if (sent + bytes > maxBytes) break;
+      p++;
+      lo = nextLo;
+      hi = nextHi;
+    }
+    const uint8_t window[] = {
+      0x21, lo, hi,       // column address
+      0x22, first, p      // page address
+    };
+    bus.command(window, sizeof(window));
+    for (uint8_t q = first; q <= p; q++) {
+      bus.data(fb + q * OLED_COLUMNS + lo, hi - lo + 1);
+      dirty.clearPage(q);
+    }
+    sent += (size_t)(p + 1 - first) * (hi - lo + 1);
+    p++;
+  }
+  return true;
+}
+
+#ifdef ARDUINO
+#include <Wire.h>
+
+// SSD1306 over Wire; counts what goes on the wire (address, control and
+// payload bytes) so refreshes can be compared
+class WireOledBus : public OledBus {
+ public:
+#ifdef I2C_BUFFER_LENGTH
+  static const size_t CHUNK = I2C_BUFFER_LENGTH - 1;
+#else
+  static const size_t CHUNK = 31;
+#endif
+
+  WireOledBus(TwoWire& wire, uint8_t addr) : wire_(wire), addr_(addr), bytes_(0) {}
+
+  void command(const uint8_t* cmd, size_t len) override { send(0x00, cmd, len); }
+  void data(const uint8_t* bytes, size_t len) override { send(0x40, bytes, len); }
+
+  uint32_t bytes() const { return bytes_; }
+  void resetBytes() { bytes_ = 0; }
+
+ private:
+  // Control byte 0x00 = commands follow, 0x40 = GDDRAM data follows
+  void send(uint8_t control, const uint8_t* p, size_t len) {
+    while (len > 0) {
+      size_t n = len < CHUNK ? len : CHUNK;
+      wire_.beginTransmission(addr_);
+      wire_.write(control);
+      wire_.write(p, n);
+      wire_.endTransmission();
+      bytes_ += 2 + n;
+      p += n;
+      len -= n;
+    }
+  }
+
+  TwoWire& wire_;
+  uint8_t addr_;
+  uint32_t bytes_;
+};
+
+#endif
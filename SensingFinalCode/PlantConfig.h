@@ -0,0 +1,102 @@
+// Smart Plant Buddy - firmware settings shared by every backend
+//
+// Timing, batching, offline-log and filter settings used by PlantCore.
+// Pins, radio credentials and other hardware details live with the backend
+// (ESPcode.cc for the ESP32).
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Filters.h"
+#include "LogMessages.h"
+
+//  TIMING 
+const unsigned long POST_INTERVAL_MS = 900000;  // 15 minutes between logged readings
+const unsigned long OLED_UPDATE_MS = 2000;       // 2 seconds
+const size_t OLED_PUSH_BYTES_MAX = 128;          // ~3 ms at 400 kHz I2C; the rest next pass
+const unsigned long READING_WINDOW_MS = 1000;    // one averaged reading per window
+const unsigned long DHT_POLL_MS = 5;             // DHT state machine
+const unsigned long ADC_POLL_MS = 5;             // drain ADC results
+const unsigned long BROADCAST_MS = 1000;         // WebSocket + serial report
+const unsigned long WIFI_POLL_MS = 100;          // connection state machine
+const unsigned long NET_POLL_MS = 50;            // upload queue
+
+//  CONNECTION 
+const unsigned long WIFI_CONNECT_TIMEOUT_MS = 15000;
+const unsigned long NTP_RETRY_MS = 30000;
+const unsigned long WIFI_BACKOFF_BASE_MS = 2000;
+const unsigned long WIFI_BACKOFF_MAX_MS = 300000;  // 5 minutes
+
+//  FIREBASE BATCHING 
+// Logged readings are uploaded together in one PATCH once BATCH_SIZE are
+// waiting or the oldest is BATCH_MAX_AGE_MS old. The default sends each
+// reading as it is logged, so the dashboard is never a post interval
+// behind. Batching saves requests, not bytes: BATCH_SIZE readings cost
+// 1/BATCH_SIZE of the requests (and TLS handshakes), but the oldest waits
+// (BATCH_SIZE - 1) * POST_INTERVAL_MS, 45 minutes at 4. Raise
+// BATCH_MAX_AGE_MS with it only as far as that wait is acceptable;
+// plant_fleet --batch N measures requests/s and bytes per reading for a
+// size; against rtdb_server, 200 devices made 1.22 requests and 169 body
+// bytes per reading at 1, 0.43 and 162 at 4 (health included). To sample
+// every minute for the same request rate, use POST_INTERVAL_MS = 60000,
+// BATCH_SIZE = 15, BATCH_MAX_AGE_MS = 900000.
+#define FIREBASE_LOGS_PATH "/plants/plant1/logs.json"
+const size_t BATCH_SIZE = 1;
+const unsigned long BATCH_MAX_AGE_MS = POST_INTERVAL_MS;
+const size_t BATCH_CAPACITY = 32;                // kept while uploads fail
+const unsigned long BATCH_RETRY_MS = 30000;      // wait after a failed upload
+// Readings logged before the clock is set are held back, the newest
+// UNDATED_MAX of them, and back-dated from their uptime once it is
+const size_t UNDATED_MAX = 32;
+
+//  OFFLINE LOG 
+// Batches that fail to upload are moved to flash and sent again once the
+// link is back, at most BACKFILL_BATCH records every BACKFILL_INTERVAL_MS
+// so a long backlog doesn't crowd out live uploads. The log is kept in
+// segment files of OFFLINE_LOG_SEGMENT records (3.3 KB, one LittleFS
+// block); a full log drops its oldest segment whole.
+const uint32_t OFFLINE_LOG_SLOTS = 2048;          // ~3 weeks at 15 min
+const uint32_t OFFLINE_LOG_SEGMENT = 64;
+const size_t BACKFILL_BATCH = 16;
+const unsigned long BACKFILL_INTERVAL_MS = 10000;
+
+//  HEALTH 
+// The network task samples the heap every HEAP_SAMPLE_MS. After a batch
+// upload succeeds it PATCHes one health record (heap low points,
+// fragmentation, per-phase allocations) if HEALTH_INTERVAL_MS have passed
+// since the last one, reusing the open connection.
+#define FIREBASE_HEALTH_PATH "/plants/plant1/health.json"
+const unsigned long HEAP_SAMPLE_MS = 10000;
+const unsigned long HEALTH_INTERVAL_MS = 3600000;  // 1 hour
+const uint32_t HEAP_WARN_BLOCK = 16384;            // a TLS handshake needs about this in one piece
+
+//  LIVE CLIENTS 
+const uint8_t LIVE_CLIENTS_MAX = 8;
+
+//  LOGGING 
+// Log messages are queued as IDs plus raw arguments (DeferredLog.h) and
+// printed by loop() when idle. Levels per module and text/binary output
+// can be changed at runtime with the "log" serial command; decode binary
+// output with host/decode_log.py.
+const size_t LOG_RING_BYTES = 2048;
+const LogLevel LOG_LEVEL_DEFAULT = LOG_LVL_INFO;
+const bool LOG_BINARY_DEFAULT = false;
+
+//  PROFILING 
+// Per-phase latency histograms (LatencyHistogram.h), ~5 KB of RAM. Off by
+// default; uncomment here or pass -DLATENCY_PROFILE to the host build.
+// #define LATENCY_PROFILE
+// Per-phase allocation counts (HeapStats.h). On the ESP32 this needs an
+// ESP-IDF built with CONFIG_HEAP_USE_HOOKS; the host build counts malloc.
+// #define HEAP_PROFILE
+
+//  FILTERS 
+// Per-channel stages applied in the sensor task before a reading is
+// published. Medians knock out single spikes (a bad DHT frame, a shadow
+// across the LDR) so they can't flip the mood; the EMA/Kalman stages smooth
+// what's left. Kalman Q/R are variances in the sensor's units squared.
+typedef FilterChain<MedianFilter<5>, EmaFilter<1> > SoilFilter;
+typedef FilterChain<MedianFilter<3>, EmaFilter<1> > LightFilter;
+typedef FilterChain<MedianFilter<3>, KalmanFilter<toFix(0.01f), toFix(0.25f)> > TempFilter;
+typedef FilterChain<MedianFilter<3>, KalmanFilter<toFix(0.05f), toFix(4.0f)> > HumFilter;
@@ -0,0 +1,879 @@
+// Smart Plant Buddy - portable firmware core
+//
+// Everything between the sensors and the network, with no Arduino
+// dependency: the sampling pipeline, mood, OLED status, the live WebSocket
+// broadcast, batched Firebase uploads and the offline log. All hardware is
+// reached through Hal; EspHal (ESPcode.cc) runs it on the ESP32 and
+// host/LinuxHal.h on Linux against simulated sensors and a fake clock.
+//
+// The work is split over three schedulers that mirror the device threads:
+//
+//   sensorTick()  ADC + DHT              sensor task (SENSOR_CORE)
+//   loopTick()    mood, UI, WiFi, live   Arduino loop()
+//   netTick()     uploads, backfill      network task (NET_CORE)
+//
+// They only share readings through SPSC queues, so each tick function may
+// run on its own thread, or all three can be interleaved on one thread.
+// The schedulers and hooks take plain function pointers, which reach the
+// core through self(): the last one constructed. On the device that makes
+// one PlantCore per program; on the host self() is per thread, and a
+// program running several cores on one thread (host/plant_fleet.cc) calls
+// makeCurrent() before ticking each.
+//
+// Log messages are deferred: logEvent() records a LogMessages.h ID and the
+// raw arguments from any thread, and loop() formats them (or sends binary
+// frames for host/decode_log.py) while it is idle and the console can take
+// them. logf() still writes at once, for replies to commands.
+//
+// With LATENCY_PROFILE each phase below feeds a LatencyHistogram, read
+// back with the serial command "latency" or the WebSocket message
+// "latency" ("latency reset" / "latency:reset" clear them). Each phase is
+// recorded by the one thread that runs it; reads from loop() are a
+// snapshot that may be a sample behind.
+//
+// The network task samples the heap and, alongside the batch uploads,
+// publishes an hourly health record to FIREBASE_HEALTH_PATH; "heap" on
+// serial or WebSocket shows the same data. With HEAP_PROFILE it includes
+// how many allocations (and bytes) each phase made.
+
+#pragma once
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "Hal.h"
+#include "PlantConfig.h"
+#include "Scheduler.h"
+#include "Reading.h"
+#include "ReadingQueue.h"
+#include "ReadingJson.h"
+#include "FirebaseBatch.h"
+#include "FlashLog.h"
+#include "ConnectionManager.h"
+#include "LiveFrame.h"
+#include "AdcDecimator.h"
+#include "Filters.h"
+#include "Mood.h"
+#include "MoodRules.h"
+#include "PlantProfiles.h"
+#include "LatencyHistogram.h"
+#include "HeapStats.h"
+#include "DeferredLog.h"
+
+const size_t LOG_LINE_MAX = 160;
+const size_t ADC_BURST_MAX = 64;   // samples taken per ADC poll
+const size_t LATENCY_JSON_MAX = 640;
+const size_t HEAP_JSON_MAX = 640;
+
+// Profiled phases, for LATENCY_PROFILE and HEAP_PROFILE
+enum Phase {
+  PHASE_DHT,          // sensor task: DHT state machine
+  PHASE_ADC,          // sensor task: ADC drain + filters
+  PHASE_BROADCAST,    // loop: mood + status line + live frames
+  PHASE_SERIAL,       //   the status line alone
+  PHASE_LIVE_SEND,    //   sending to live clients alone
+  PHASE_OLED,         // loop: compose + push the status screen
+  PHASE_WIFI,         // loop: connection state machine
+  PHASE_UPLOAD,       // network task: one upload pass
+  PHASE_POST,         //   one Firebase request alone
+  PHASE_COUNT
+};
+
+const char* const PHASE_NAMES[PHASE_COUNT] = {
+  "dht", "adc", "broadcast", "serial", "live_send", "oled", "wifi", "upload", "post"
+};
+
+// Times the rest of the block and charges its allocations to the phase,
+// as far as either is compiled in
+#define PHASE_SCOPE(phase) LATENCY_SCOPE(latency_[phase]); HEAP_SCOPE(allocs_[phase])
+
+class PlantCore {
+ public:
+  explicit PlantCore(Hal& hal)
+    : hal_(hal),
+      scheduler_(clockMs, clockUs),
+      sensorScheduler_(clockMs, clockUs),
+      netScheduler_(clockMs, clockUs),
+      broadcastTask_(-1),
+      oledTask_(-1),
+      haveReading_(false),
+      wifi_(hooks(), connectionConfig()),
+      pushIds_(randomU32),
+      batchSize_(BATCH_SIZE),
+      batchMaxAgeMs_(BATCH_MAX_AGE_MS),
+      undatedStart_(0),
+      undatedCount_(0),
+      flushFailed_(false),
+      lastFailedFlush_(0),
+      offlineLog_(offlineStorage_, OFFLINE_LOG_SLOTS, OFFLINE_LOG_SEGMENT),
+      offlineLogOk_(false),
+      lastBackfill_(0),
+      heapWarned_(false),
+      lastHealthMs_(0),
+      liveSeq_(0),
+      currentMood_(MOOD_OK),
+      logBinary_(LOG_BINARY_DEFAULT),
+      adcDecimator_(1),
+      sensorTemp_(-100),
+      sensorHum_(-1),
+      climateFailuresSeen_(0) {
+    self() = this;
+    current_ = Reading{0, 0, 0, -100, -1, 0};
+    memset(liveClients_, 0, sizeof(liveClients_));
+    memset(moodTransitions_, 0, sizeof(moodTransitions_));
+    log_.setLevel(LOG_LEVEL_DEFAULT);
+#ifdef HEAP_PROFILE
+    memset(allocs_, 0, sizeof(allocs_));
+    memset(allocsPublished_, 0, sizeof(allocsPublished_));
+#endif
+  }
+
+  ~PlantCore() {
+    if (self() == this) self() = nullptr;
+  }
+
+  // Compile the mood rules and register every task. Call once, before
+  // any of the tick functions; plantType is a plantTypes id.
+  void begin(const char* plantType) {
+    logEvent(LOG_STARTED, LOG_TABLE_HASH);
+    const PlantProfile* p = findPlantProfile(PLANT_PROFILES, PLANT_PROFILE_COUNT, plantType);
+    if (p) {
+      moodTable_.compile(*p);
+    } else {
+      logEvent(LOG_PLANT_UNKNOWN, plantType);
+      moodTable_.compileDefault();
+    }
+    logEvent(LOG_MOOD_RULES, p ? p->name : DEFAULT_PROFILE_NAME, (unsigned)moodTable_.count());
+
+    adcDecimator_ = AdcDecimator<2>(hal_.adcResultHz() * READING_WINDOW_MS / 1000);
+    sensorScheduler_.add("dht", climateTask, DHT_POLL_MS, 200);
+    sensorScheduler_.add("adc", adcTask, ADC_POLL_MS, 500);
+
+    // Periodic tasks: name, fn, period, budget (us), first-run offset.
+    // Broadcast and the OLED skip until the first reading is published,
+    // which then runs them at once (drainReadings()).
+    broadcastTask_ = scheduler_.add("broadcast", broadcastTask, BROADCAST_MS, 5000, READING_WINDOW_MS);
+    oledTask_ = scheduler_.add("oled", oledTask, OLED_UPDATE_MS, 5000, READING_WINDOW_MS);
+    scheduler_.add("firebase", firebaseTask, POST_INTERVAL_MS, 1000, POST_INTERVAL_MS);
+    scheduler_.add("wifi", wifiTask, WIFI_POLL_MS, 200);
+
+    netScheduler_.add("upload", uploadTask, NET_POLL_MS, 0);
+    netScheduler_.add("heap", heapTask, HEAP_SAMPLE_MS, 2000);
+    wifi_.poll(hal_.millis());
+  }
+
+  // First thing on the network thread: opens the offline log there, since
+  // only that thread touches it afterwards
+  void beginNet() {
+    offlineStorage_.target = hal_.openLogStorage();
+    offlineLogOk_ = offlineStorage_.target && offlineLog_.open();
+    logEvent(LOG_OFFLINE_OPEN, offlineLogOk_ ? "ok" : "unavailable", (unsigned)offlineLog_.size());
+  }
+
+#ifndef ARDUINO
+  void makeCurrent() { self() = this; }
+#endif
+
+  // Each runs at most one due task; false when nothing was due
+  bool sensorTick() { return sensorScheduler_.tick(); }
+  bool netTick() { return netScheduler_.tick(); }
+  bool loopTick() {
+    drainReadings();
+    bool ran = scheduler_.tick();
+    if (!ran || log_.used() > LOG_RING_BYTES / 2) drainLog();
+    return ran;
+  }
+
+  // Until any of the three schedulers has work, for sleeping or for
+  // jumping a simulated clock ahead
+  unsigned long msUntilNext() const {
+    unsigned long a = scheduler_.msUntilNext();
+    unsigned long b = sensorScheduler_.msUntilNext();
+    unsigned long c = netScheduler_.msUntilNext();
+    unsigned long m = a < b ? a : b;
+    return m < c ? m : c;
+  }
+
+  //  LIVE CLIENT EVENTS (loop)
+
+  void liveConnected(uint8_t client) {
+    if (client >= LIVE_CLIENTS_MAX) return;
+    liveClients_[client].connected = true;
+    liveClients_[client].binary = false;
+  }
+
+  void liveDisconnected(uint8_t client) {
+    if (client < LIVE_CLIENTS_MAX) liveClients_[client].connected = false;
+  }
+
+  // Format negotiation: "mode:bin" or "mode:text"; "latency" and "heap"
+  // reply with the phase histograms or heap stats as JSON to this client
+  void liveText(uint8_t client, const uint8_t* payload, size_t len) {
+    if (client >= LIVE_CLIENTS_MAX) return;
+    if (len == 8 && memcmp(payload, "mode:bin", 8) == 0) {
+      liveClients_[client].binary = true;
+    } else if (len == 9 && memcmp(payload, "mode:text", 9) == 0) {
+      liveClients_[client].binary = false;
+    } else if (len == 7 && memcmp(payload, "latency", 7) == 0) {
+      char json[LATENCY_JSON_MAX];
+      size_t n = writeLatencyJson(json, sizeof(json));
+      if (n > 0) hal_.liveSend(client, (const uint8_t*)json, n, false);
+    } else if (len == 13 && memcmp(payload, "latency:reset", 13) == 0) {
+      resetLatency();
+    } else if (len == 4 && memcmp(payload, "heap", 4) == 0) {
+      char json[HEAP_JSON_MAX];
+      HeapInfo h;
+      hal_.heapInfo(h);
+      size_t n = writeHeapJson(json, sizeof(json), h);
+      if (n > 0) hal_.liveSend(client, (const uint8_t*)json, n, false);
+    }
+  }
+
+  // One line typed on the serial console (loop)
+  void command(const char* line) {
+    if (strcmp(line, "latency") == 0) {
+      logLatency();
+    } else if (strcmp(line, "latency reset") == 0) {
+      resetLatency();
+      logf("Latency histograms cleared");
+    } else if (strcmp(line, "heap") == 0) {
+      logHeap();
+    } else if (strncmp(line, "log", 3) == 0 && (line[3] == ' ' || line[3] == '\0')) {
+      logCommand(line + 3);
+    } else {
+      logf("Unknown command '%s' (try: latency, latency reset, heap, log)", line);
+    }
+  }
+
+  //  LOGGING
+
+  // Record a message for loop() to print; cheap enough for any task. Pass
+  // only ints, floats and C strings (strings are cut to LOG_STR_MAX).
+  template <typename... Args>
+  void logEvent(LogId id, const Args&... args) {
+    log_.write(id, hal_.millis(), args...);
+  }
+
+  void setLogLevel(LogLevel level) { log_.setLevel(level); }
+  void setLogBinary(bool binary) { logBinary_ = binary; }
+
+  // Readings per upload and the longest the oldest may wait (BATCH_SIZE,
+  // BATCH_MAX_AGE_MS by default); call before beginNet()
+  void setBatching(size_t size, unsigned long maxAgeMs) {
+    batchSize_ = size < 1 ? 1 : size > BATCH_CAPACITY ? BATCH_CAPACITY : size;
+    batchMaxAgeMs_ = maxAgeMs;
+  }
+
+  //  LATENCY
+
+  // {"unit":"us","phases":{"dht":{"n":…,"p50":…,"p99":…,"max":…},…}}
+  size_t writeLatencyJson(char* buf, size_t cap) const {
+#ifdef LATENCY_PROFILE
+    uint32_t mhz = cycleCounterMhz();
+    int len = snprintf(buf, cap, "{\"unit\":\"us\",\"phases\":{");
+    for (uint8_t i = 0; i < PHASE_COUNT && len > 0 && (size_t)len < cap; i++) {
+      const LatencyHistogram& h = latency_[i];
+      len += snprintf(buf + len, cap - len, "%s\"%s\":{\"n\":%lu,\"p50\":%.2f,\"p99\":%.2f,\"max\":%.2f}",
+                      i ? "," : "", PHASE_NAMES[i], (unsigned long)h.count(),
+                      (float)h.percentile(500) / mhz, (float)h.percentile(990) / mhz,
+                      (float)h.max() / mhz);
+    }
+    if (len > 0 && (size_t)len < cap) len += snprintf(buf + len, cap - len, "}}");
+    return len > 0 && (size_t)len < cap ? len : 0;
+#else
+    int len = snprintf(buf, cap, "{\"error\":\"built without LATENCY_PROFILE\"}");
+    return len > 0 && (size_t)len < cap ? len : 0;
+#endif
+  }
+
+  // One log line per phase
+  void logLatency() {
+#ifdef LATENCY_PROFILE
+    char line[LOG_LINE_MAX];
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+      formatLatency(line, sizeof(line), PHASE_NAMES[i], latency_[i], cycleCounterMhz());
+      hal_.log(line);
+    }
+#else
+    logf("Latency histograms not compiled in (define LATENCY_PROFILE)");
+#endif
+  }
+
+  void resetLatency() {
+#ifdef LATENCY_PROFILE
+    // Each phase's own task clears it, see LatencyHistogram.h
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) latency_[i].requestReset();
+#endif
+  }
+
+  //  HEAP
+
+  // {"timestamp":…,"uptime_ms":…,"free":…,"largest":…,"min_free":…,
+  //  "frag_pct":…,"window":{…},"allocs":{"dht":{"n":…,"bytes":…},…}}
+  // The window and allocations cover the time since the last health
+  // record; allocs only with HEAP_PROFILE. Outside the network task this
+  // is a snapshot that may be a sample behind.
+  size_t writeHeapJson(char* buf, size_t cap, const HeapInfo& h) const {
+    int len = snprintf(buf, cap,
+                       "{\"timestamp\":%lld,\"uptime_ms\":%lu,\"free\":%lu,\"largest\":%lu,"
+                       "\"min_free\":%lu,\"frag_pct\":%u,\"window\":{\"samples\":%lu,"
+                       "\"min_free\":%lu,\"min_largest\":%lu,\"max_frag_pct\":%u}",
+                       hal_.epochMillis(), hal_.millis(), (unsigned long)h.freeBytes,
+                       (unsigned long)h.largestFree, (unsigned long)h.minFree,
+                       heapFragPercent(h), (unsigned long)heapWindow_.samples,
+                       (unsigned long)heapWindow_.minFree, (unsigned long)heapWindow_.minLargest,
+                       heapWindow_.maxFrag);
+#ifdef HEAP_PROFILE
+    if (h.counting && len > 0 && (size_t)len < cap) {
+      len += snprintf(buf + len, cap - len, ",\"allocs\":{");
+      for (uint8_t i = 0; i < PHASE_COUNT && len > 0 && (size_t)len < cap; i++) {
+        len += snprintf(buf + len, cap - len, "%s\"%s\":{\"n\":%lu,\"bytes\":%lu}",
+                        i ? "," : "", PHASE_NAMES[i],
+                        (unsigned long)(allocs_[i].allocs - allocsPublished_[i].allocs),
+                        (unsigned long)(allocs_[i].bytes - allocsPublished_[i].bytes));
+      }
+      if (len > 0 && (size_t)len < cap) len += snprintf(buf + len, cap - len, "}");
+    }
+#endif
+    if (len > 0 && (size_t)len < cap) len += snprintf(buf + len, cap - len, "}");
+    return len > 0 && (size_t)len < cap ? len : 0;
+  }
+
+  // One line for the heap, one per phase that allocated
+  void logHeap() {
+    HeapInfo h;
+    hal_.heapInfo(h);
+    logf("Heap free=%lu largest=%lu (frag %u%%) min=%lu; since last record: min free=%lu "
+         "min largest=%lu max frag=%u%%",
+         (unsigned long)h.freeBytes, (unsigned long)h.largestFree, heapFragPercent(h),
+         (unsigned long)h.minFree, (unsigned long)heapWindow_.minFree,
+         (unsigned long)heapWindow_.minLargest, heapWindow_.maxFrag);
+#ifdef HEAP_PROFILE
+    if (!h.counting) {
+      logf("Allocation counters unavailable on this backend");
+      return;
+    }
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+      uint32_t n = allocs_[i].allocs - allocsPublished_[i].allocs;
+      if (n) logf("  %-10s allocs=%lu bytes=%lu", PHASE_NAMES[i], (unsigned long)n,
+                  (unsigned long)(allocs_[i].bytes - allocsPublished_[i].bytes));
+    }
+#endif
+  }
+
+  //  STATE
+
+  const Reading& current() const { return current_; }
+  Mood mood() const { return currentMood_; }
+  uint16_t moodTransitions(Mood from, Mood to) const { return moodTransitions_[from][to]; }
+  const ConnectionManager& connection() const { return wifi_; }
+  const Scheduler& loopScheduler() const { return scheduler_; }
+  const Scheduler& sensorScheduler() const { return sensorScheduler_; }
+  const Scheduler& netScheduler() const { return netScheduler_; }
+  size_t offlinePending() const { return offlineLogOk_ ? offlineLog_.size() : 0; }
+
+  // Immediate, for command replies; everything else uses logEvent()
+  void logf(const char* fmt, ...) {
+    char line[LOG_LINE_MAX];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    hal_.log(line);
+  }
+
+ private:
+  struct LiveClient {
+    bool connected;
+    bool binary;
+  };
+
+  // Lets the offline log be a plain member although the backend's storage
+  // is only known once beginNet() runs
+  class StorageRef : public LogStorage {
+   public:
+    StorageRef() : target(nullptr) {}
+    bool read(uint8_t file, uint32_t offset, void* buf, size_t len) {
+      return target && target->read(file, offset, buf, len);
+    }
+    bool write(uint8_t file, uint32_t offset, const void* buf, size_t len) {
+      return target && target->write(file, offset, buf, len);
+    }
+    bool append(uint8_t file, const void* buf, size_t len) {
+      return target && target->append(file, buf, len);
+    }
+    bool remove(uint8_t file) { return target && target->remove(file); }
+    uint32_t size(uint8_t file) { return target ? target->size(file) : 0; }
+    uint32_t freeBytes() { return target ? target->freeBytes() : 0; }
+    LogStorage* target;
+  };
+
+  //  TRAMPOLINES (Scheduler and ConnectionManager take plain functions)
+
+  static PlantCore*& self() {
+#ifdef ARDUINO
+    static PlantCore* core = nullptr;
+#else
+    static thread_local PlantCore* core = nullptr;
+#endif
+    return core;
+  }
+  static unsigned long clockMs() { return self()->hal_.millis(); }
+  static unsigned long clockUs() { return self()->hal_.micros(); }
+  static uint32_t randomU32() { return self()->hal_.random(); }
+  static bool linkUp() { return self()->hal_.linkUp(); }
+  static void startConnect() { self()->hal_.startConnect(); }
+  static void startTimeSync() { self()->hal_.startTimeSync(); }
+  static bool timeValid() { return self()->hal_.timeValid(); }
+  static void connectionChanged(ConnState from, ConnState to) { self()->onConnectionChange(from, to); }
+  static void climateTask() { self()->readClimate(); }
+  static void adcTask() { self()->sampleAdc(); }
+  static void broadcastTask() { self()->broadcast(); }
+  static void oledTask() { self()->showStatus(); }
+  static void firebaseTask() { self()->queueUpload(); }
+  static void wifiTask() { self()->pollConnection(); }
+  static void uploadTask() { self()->upload(); }
+  static void heapTask() { self()->sampleHeap(); }
+
+  static ConnectionHooks hooks() {
+    ConnectionHooks h = {
+      linkUp, startConnect, startTimeSync, timeValid, randomU32, connectionChanged
+    };
+    return h;
+  }
+
+  static ConnectionConfig connectionConfig() {
+    ConnectionConfig c = {
+      WIFI_CONNECT_TIMEOUT_MS, NTP_RETRY_MS, WIFI_BACKOFF_BASE_MS, WIFI_BACKOFF_MAX_MS
+    };
+    return c;
+  }
+
+  //  SENSOR TASK
+
+  // Feed new ADC results to the decimator; publish a reading per window
+  void sampleAdc() {
+    PHASE_SCOPE(PHASE_ADC);
+    AdcSample samples[ADC_BURST_MAX];
+    size_t n = hal_.readAdc(samples, ADC_BURST_MAX);
+    for (size_t i = 0; i < n; i++) adcDecimator_.push(samples[i].channel, samples[i].raw);
+    if (!adcDecimator_.ready()) return;
+
+    Reading r;
+    r.timestampMs = hal_.epochMillis();
+    r.uptimeMs = hal_.millis();
+    r.soil = fixToInt(soilFilter_.update(toFix((int)adcDecimator_.take(ADC_SOIL))));
+    r.light = fixToInt(lightFilter_.update(toFix((int)adcDecimator_.take(ADC_LIGHT))));
+
+    // A failed conversion keeps serving the last good value; only once that
+    // is too old (or there never was one) do the sentinels go out
+    DhtSample climate = hal_.climate();
+    bool usable = climate.quality == DHT_FRESH || climate.quality == DHT_CACHED;
+    r.tempC = usable ? sensorTemp_ : -100;
+    r.hum = usable ? sensorHum_ : -1;
+    readingQueue_.push(r);
+  }
+
+  // Advance the DHT state machine; filter each new good conversion
+  void readClimate() {
+    PHASE_SCOPE(PHASE_DHT);
+    hal_.pollClimate();
+    if (hal_.takeFreshClimate()) {
+      DhtSample s = hal_.climate();
+      sensorHum_ = fixToFloat(humFilter_.update(toFix(s.hum)));
+      sensorTemp_ = fixToFloat(tempFilter_.update(toFix(s.tempC)));
+    }
+    if (hal_.climateFailures() != climateFailuresSeen_) {
+      climateFailuresSeen_ = hal_.climateFailures();
+      logEvent(LOG_DHT_FAILED, hal_.climateFailures(), hal_.climateReads(), hal_.climate().ageMs);
+    }
+  }
+
+  //  LOOP TASKS
+
+  // Print or send what the other tasks logged, as far as the console can
+  // take it without blocking
+  void drainLog() {
+    uint32_t dropped = log_.takeDropped();
+    if (dropped) logEvent(LOG_DROPPED, dropped);
+    uint8_t rec[LOG_RECORD_MAX];
+    while (true) {
+      uint8_t len = log_.peekLength();
+      if (len == 0) return;
+      if (logBinary_) {
+        if (hal_.logRoom() < (size_t)len + LOG_FRAME_OVERHEAD || !log_.pop(rec)) return;
+        uint8_t frame[LOG_RECORD_MAX + LOG_FRAME_OVERHEAD];
+        hal_.logFrame(frame, writeLogFrame(rec, frame));
+      } else {
+        if (hal_.logRoom() < LOG_LINE_MAX + 2 || !log_.pop(rec)) return;
+        char line[LOG_LINE_MAX];
+        formatLogRecord(rec, line, sizeof(line));
+        hal_.log(line);
+      }
+    }
+  }
+
+  // "log" shows the levels; "log text|binary" picks the output;
+  // "log [module|all] off|error|warn|info|debug" sets a level
+  void logCommand(const char* args) {
+    char word[2][12] = {"", ""};
+    sscanf(args, "%11s %11s", word[0], word[1]);
+    if (word[0][0] == '\0') {
+      char line[LOG_LINE_MAX];
+      int len = snprintf(line, sizeof(line), "Log %s:", logBinary_ ? "binary" : "text");
+      for (uint8_t m = 0; m < LOG_MODULE_COUNT && len > 0 && (size_t)len < sizeof(line); m++) {
+        len += snprintf(line + len, sizeof(line) - len, " %s=%s", LOG_MODULE_NAMES[m],
+                        LOG_LEVEL_NAMES[log_.level((LogModule)m)]);
+      }
+      hal_.log(line);
+      return;
+    }
+    if (strcmp(word[0], "text") == 0 || strcmp(word[0], "binary") == 0) {
+      logBinary_ = word[0][0] == 'b';
+      logf("Log output: %s", word[0]);
+      return;
+    }
+    const char* levelName = word[1][0] ? word[1] : word[0];
+    const char* moduleName = word[1][0] ? word[0] : "all";
+    int level = -1;
+    for (uint8_t l = 0; l < LOG_LEVEL_COUNT; l++) {
+      if (strcmp(levelName, LOG_LEVEL_NAMES[l]) == 0) level = l;
+    }
+    int module = strcmp(moduleName, "all") == 0 ? LOG_MODULE_COUNT : -1;
+    for (uint8_t m = 0; m < LOG_MODULE_COUNT; m++) {
+      if (strcmp(moduleName, LOG_MODULE_NAMES[m]) == 0) module = m;
+    }
+    if (level < 0 || module < 0) {
+      logf("Usage: log [text|binary] or log [module|all] off|error|warn|info|debug");
+      return;
+    }
+    if (module == LOG_MODULE_COUNT) log_.setLevel((LogLevel)level);
+    else log_.setLevel((LogModule)module, (LogLevel)level);
+    logf("Log level %s: %s", moduleName, levelName);
+  }
+
+  // Take everything the sensor task produced; the newest reading wins
+  void drainReadings() {
+    Reading r;
+    bool got = false;
+    while (readingQueue_.pop(r)) {
+      current_ = r;
+      got = true;
+    }
+    if (got && !haveReading_) {
+      haveReading_ = true;
+      scheduler_.trigger(broadcastTask_);
+      scheduler_.trigger(oledTask_);
+    }
+  }
+
+  // Determine mood, log and send real-time data to live clients
+  void broadcast() {
+    if (!haveReading_) return;   // current_ is still the boot placeholder
+    PHASE_SCOPE(PHASE_BROADCAST);
+    Mood mood = liveMood_.update(moodTable_, current_);
+    if (mood != currentMood_) {
+      uint16_t& n = moodTransitions_[currentMood_][mood];
+      if (n < UINT16_MAX) n++;
+      logEvent(LOG_MOOD_CHANGE, moodToken(currentMood_), moodToken(mood), n);
+      currentMood_ = mood;
+    }
+
+    {
+      PHASE_SCOPE(PHASE_SERIAL);
+      logEvent(LOG_STATUS, current_.soil, current_.light, current_.tempC, current_.hum,
+               moodToken(currentMood_));
+    }
+
+    // Each format is built at most once, and only if some client wants it
+    char text[READING_JSON_MAX];
+    uint8_t frame[LIVE_FRAME_SIZE];
+    size_t textLen = 0;
+    size_t binLen = 0;
+    liveSeq_++;
+    PHASE_SCOPE(PHASE_LIVE_SEND);
+    for (uint8_t c = 0; c < LIVE_CLIENTS_MAX; c++) {
+      if (!liveClients_[c].connected) continue;
+      if (liveClients_[c].binary) {
+        if (binLen == 0) binLen = writeLiveFrame(frame, sizeof(frame), liveSeq_, current_, currentMood_);
+        hal_.liveSend(c, frame, binLen, true);
+      } else {
+        if (textLen == 0) {
+          textLen = writeReadingJson(text, sizeof(text), current_, currentMood_, JSON_WEBSOCKET);
+        }
+        if (textLen > 0) hal_.liveSend(c, (const uint8_t*)text, textLen, false);
+      }
+    }
+  }
+
+  void showStatus() {
+    if (!haveReading_) return;
+    PHASE_SCOPE(PHASE_OLED);
+    // A big redraw goes out a slice per loop pass so WebSocket waits little
+    if (!hal_.showStatus(current_, currentMood_)) scheduler_.trigger(oledTask_);
+  }
+
+  // Hand the latest reading to the network task; the post happens there
+  void queueUpload() {
+    if (!haveReading_) return;
+    if (!postQueue_.push(current_)) logEvent(LOG_POST_QUEUE_FULL);
+  }
+
+  // Advance the WiFi/NTP state machine; reconnects with backoff on its own
+  void pollConnection() {
+    PHASE_SCOPE(PHASE_WIFI);
+    wifi_.poll(hal_.millis());
+  }
+
+  void onConnectionChange(ConnState from, ConnState to) {
+    logEvent(LOG_WIFI_STATE, ConnectionManager::stateName(from), ConnectionManager::stateName(to));
+    if (to == CONN_TIME_SYNCED) {
+      logEvent(LOG_TIME_SYNCED);
+    } else if (to == CONN_BACKOFF) {
+      logEvent(LOG_WIFI_RETRY, wifi_.lastBackoffMs());
+    }
+    hal_.linkChanged(from, to);
+  }
+
+  //  NETWORK TASK
+
+  void upload() {
+    PHASE_SCOPE(PHASE_UPLOAD);
+    long long epoch = hal_.epochMillis();
+    unsigned long now = hal_.millis();
+    if (epoch != 0 && undatedCount_ > 0) {
+      size_t n = undatedCount_;
+      while (undatedCount_ > 0) {
+        Reading& held = undated_[undatedStart_];
+        undatedStart_ = (undatedStart_ + 1) % UNDATED_MAX;
+        undatedCount_--;
+        addDated(held, epoch, now);
+      }
+      logEvent(LOG_BACKDATED, (unsigned)n);
+    }
+    Reading r;
+    while (postQueue_.pop(r)) {
+      if (r.timestampMs == 0 && epoch == 0) {
+        holdUndated(r);
+      } else {
+        addDated(r, epoch, now);
+      }
+    }
+    bool backingOff = flushFailed_ && now - lastFailedFlush_ < BATCH_RETRY_MS;
+    if (!backingOff && batch_.due(now, batchSize_, batchMaxAgeMs_)) {
+      flushBatch();
+    } else if (!backingOff && offlineLogOk_ && offlineLog_.size() > 0 && hal_.linkUp() &&
+               now - lastBackfill_ >= BACKFILL_INTERVAL_MS) {
+      lastBackfill_ = now;
+      drainOfflineLog();
+    }
+  }
+
+  // Readings without a timestamp get one from their uptime, so a record
+  // never goes out (or into flash) as 1970
+  void addDated(Reading& r, long long epoch, unsigned long nowMs) {
+    if (r.timestampMs == 0) r.timestampMs = epoch - (long long)(nowMs - r.uptimeMs);
+    batch_.add(r, uploadMood_.update(moodTable_, r), nowMs, pushIds_);
+  }
+
+  // Keep a reading until the clock is set; when full the oldest goes
+  void holdUndated(const Reading& r) {
+    if (undatedCount_ == UNDATED_MAX) {
+      undatedStart_ = (undatedStart_ + 1) % UNDATED_MAX;
+      undatedCount_--;
+      logEvent(LOG_UNDATED_DROPPED, (unsigned)UNDATED_MAX);
+    }
+    undated_[(undatedStart_ + undatedCount_) % UNDATED_MAX] = r;
+    undatedCount_++;
+  }
+
+  // Upload a batch of logs as one multi-key PATCH
+  bool postToFirebase(const char* json, size_t len) {
+    if (!hal_.linkUp()) {
+      hal_.httpStop();
+      return false;
+    }
+
+    PostTiming t;
+    PHASE_SCOPE(PHASE_POST);
+    int code = hal_.httpSend("PATCH", FIREBASE_LOGS_PATH, json, len, t);
+    logEvent(LOG_PATCH, code, (unsigned)len, t.reused ? "reused" : "new conn",
+             t.dnsUs, t.connectUs, t.handshakeUs, t.transferUs);
+
+    return (code > 0 && code < 400);
+  }
+
+  // Send everything buffered. If the upload fails the entries move to the
+  // offline log (or stay in RAM if flash is unavailable).
+  void flushBatch() {
+    size_t n = 0;
+    size_t len = batch_.writeJson(batchBody_, sizeof(batchBody_), BATCH_CAPACITY, &n);
+    if (len == 0) return;
+    bool ok = postToFirebase(batchBody_, len);
+    flushFailed_ = !ok;
+    lastFailedFlush_ = hal_.millis();
+    if (ok) {
+      batch_.consume(n);
+      logEvent(LOG_POSTED, (unsigned)n);
+      if (hal_.millis() - lastHealthMs_ >= HEALTH_INTERVAL_MS) postHealth();
+      return;
+    }
+    if (!offlineLogOk_) {
+      logEvent(LOG_POST_KEPT, (unsigned)n);
+      return;
+    }
+    size_t saved = 0;
+    while (batch_.count() > 0 && offlineLog_.append(batch_.entry(0).key, batch_.entry(0).reading)) {
+      batch_.consume(1);
+      saved++;
+    }
+    logEvent(LOG_POST_SAVED, (unsigned)saved, (unsigned)offlineLog_.size());
+  }
+
+  void sampleHeap() {
+    HeapInfo h;
+    hal_.heapInfo(h);
+    heapWindow_.add(h);
+    if (h.largestFree < HEAP_WARN_BLOCK && !heapWarned_) {
+      heapWarned_ = true;
+      logEvent(LOG_HEAP_LOW, h.largestFree, h.freeBytes, heapFragPercent(h));
+    }
+  }
+
+  // One health record under a fresh push ID; on failure the window keeps
+  // growing until the next successful batch
+  void postHealth() {
+    long long now = hal_.epochMillis();
+    if (now == 0) return;
+    HeapInfo h;
+    hal_.heapInfo(h);
+    heapWindow_.add(h);
+#ifdef HEAP_PROFILE
+    PhaseAllocs totals[PHASE_COUNT];
+    memcpy(totals, allocs_, sizeof(totals));
+#endif
+
+    char key[PUSH_ID_LEN + 1];
+    pushIds_.next(now, key);
+    int head = snprintf(batchBody_, sizeof(batchBody_), "{\"%s\":", key);
+    size_t len = writeHeapJson(batchBody_ + head, sizeof(batchBody_) - head - 1, h);
+    if (len == 0) return;
+    len += head;
+    batchBody_[len++] = '}';
+    batchBody_[len] = '\0';
+
+    PostTiming t;
+    int code = hal_.httpSend("PATCH", FIREBASE_HEALTH_PATH, batchBody_, len, t);
+    logEvent(LOG_HEALTH_PATCH, code, (unsigned)len);
+    if (code <= 0 || code >= 400) return;
+    lastHealthMs_ = hal_.millis();
+    heapWindow_.reset();
+    heapWarned_ = false;
+#ifdef HEAP_PROFILE
+    memcpy(allocsPublished_, totals, sizeof(totals));
+#endif
+  }
+
+  // Upload the oldest offline records; they stay in flash until confirmed
+  void drainOfflineLog() {
+    uint32_t next;
+    size_t n = offlineLog_.peek(backfillRecords_, BACKFILL_BATCH, &next);
+    size_t undated = 0;
+    for (size_t i = 0; i < n; i++) {
+      const Reading& r = backfillRecords_[i].reading;
+      if (r.timestampMs == 0) {   // saved by older firmware before the clock was set
+        undated++;
+        continue;
+      }
+      backfill_.add(backfillRecords_[i].key, r, moodTable_.classify(r), hal_.millis());
+    }
+    if (undated > 0) logEvent(LOG_UNDATED_SKIPPED, (unsigned)undated);
+
+    bool ok = true;
+    if (backfill_.count() > 0) {
+      size_t used = 0;
+      size_t len = backfill_.writeJson(batchBody_, sizeof(batchBody_), BACKFILL_BATCH, &used);
+      ok = len > 0 && postToFirebase(batchBody_, len);
+      backfill_.consume(backfill_.count());
+    }
+    if (ok) {
+      offlineLog_.commit(next);
+      logEvent(LOG_BACKFILLED, (unsigned)(n - undated), (unsigned)offlineLog_.size());
+    } else {
+      flushFailed_ = true;
+      lastFailedFlush_ = hal_.millis();
+    }
+  }
+
+  Hal& hal_;
+
+  //  SCHEDULERS
+  Scheduler scheduler_;         // loop(): UI + WebSocket
+  Scheduler sensorScheduler_;   // sensor task: ADC + DHT
+  Scheduler netScheduler_;      // network task: uploads
+  int broadcastTask_;           // both run as soon as the first reading is in
+  int oledTask_;                // retriggered while a redraw is still going out
+  bool haveReading_;            // current_ holds a published reading
+
+  //  QUEUES
+  SpscQueue<Reading, 16> readingQueue_;  // sensor task -> loop()
+  SpscQueue<Reading, 8> postQueue_;      // loop() -> network task
+
+  //  MOOD
+  MoodTable moodTable_;   // compiled in begin(), read-only afterwards
+
+  //  CONNECTION (polled by loop)
+  ConnectionManager wifi_;
+
+  //  STATE (owned by network task)
+  ReadingBatch<BATCH_CAPACITY> batch_;
+  PushIdGenerator pushIds_;
+  char batchBody_[ReadingBatch<BATCH_CAPACITY>::BODY_MAX];
+  size_t batchSize_;
+  unsigned long batchMaxAgeMs_;
+  Reading undated_[UNDATED_MAX];   // logged before the clock was set
+  size_t undatedStart_;
+  size_t undatedCount_;
+  bool flushFailed_;
+  unsigned long lastFailedFlush_;
+  StorageRef offlineStorage_;
+  FlashLog offlineLog_;
+  bool offlineLogOk_;
+  ReadingBatch<BACKFILL_BATCH> backfill_;
+  FlashRecord backfillRecords_[BACKFILL_BATCH];
+  unsigned long lastBackfill_;
+  MoodTracker uploadMood_;
+  HeapWindow heapWindow_;
+  bool heapWarned_;              // once per health record
+  unsigned long lastHealthMs_;
+
+  //  STATE (owned by loop)
+  LiveClient liveClients_[LIVE_CLIENTS_MAX];
+  uint32_t liveSeq_;
+  Mood currentMood_;
+  MoodTracker liveMood_;
+  uint16_t moodTransitions_[MOOD_COUNT][MOOD_COUNT];   // [from][to]
+  Reading current_;
+  bool logBinary_;
+
+  //  LOG (written by every task, drained by loop)
+  DeferredLog<LOG_RING_BYTES> log_;
+
+#ifdef LATENCY_PROFILE
+  LatencyHistogram latency_[PHASE_COUNT];   // each written by its phase's thread
+#endif
+#ifdef HEAP_PROFILE
+  PhaseAllocs allocs_[PHASE_COUNT];          // likewise
+  PhaseAllocs allocsPublished_[PHASE_COUNT]; // totals at the last health record
+#endif
+
+  //  STATE (owned by sensor task)
+  AdcDecimator<2> adcDecimator_;
+  SoilFilter soilFilter_;
+  LightFilter lightFilter_;
+  TempFilter tempFilter_;
+  HumFilter humFilter_;
+  float sensorTemp_;   // filtered last good values
+  float sensorHum_;
+  unsigned long climateFailuresSeen_;
+};
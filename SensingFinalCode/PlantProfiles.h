@@ -0,0 +1,16 @@
+// Generated by embed_profiles.py from the plantTypes node - do not edit.
+// Ranges: soil (water.soil_min/max), light, temp, humidity.
+
+#pragma once
+
+#include <stdint.h>
+#include "MoodRules.h"
+
+const PlantProfile PLANT_PROFILES[] = {
+  {"Succulent", "Succulent", {2000.0f, 3200.0f}, {2000.0f, 3500.0f}, {16.0f, 30.0f}, {20.0f, 50.0f}},
+  {"baby_banana", "Baby Banana (Musa)", {1300.0f, 2100.0f}, {2200.0f, 3800.0f}, {18.0f, 27.0f}, {55.0f, 80.0f}},
+  {"baby_polyscias_balfouriana_butterfly", "Baby Polyscias Balfouriana 'Butterfly'", {1500.0f, 2400.0f}, {1200.0f, 2600.0f}, {18.0f, 26.0f}, {45.0f, 70.0f}},
+  {"spider_plant", "spider plant", {2000.0f, 3200.0f}, {1200.0f, 2800.0f}, {18.0f, 27.0f}, {40.0f, 70.0f}},
+};
+
+const uint8_t PLANT_PROFILE_COUNT = 4;
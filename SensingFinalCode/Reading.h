@@ -0,0 +1,32 @@
+// Smart Plant Buddy - one sensor reading
+//
+// Plain value type so it can be copied through lock-free queues, stored in
+// fixed buffers and shared between the device and host builds.
+//
+// READING_FIELDS is the single schema for everything that leaves the device.
+// The struct members and the JSON, CSV and binary codecs (ReadingJson.h,
+// ReadingCodec.h) are all expanded from it at compile time, so adding a
+// sensor is one line here. Columns:
+//   C++ type, member, wire type (binary), Firebase key, live WebSocket key
+//   (nullptr = not sent live), CSV header, decimals for text output.
+
+#pragma once
+
+#include <stdint.h>
+
+#define READING_FIELDS(X) \
+  X(long long, timestampMs, int64_t, "timestamp", nullptr, "Timestamp",   0) \
+  X(int,       soil,        int16_t, "soil_raw",  "soil",  "Soil",        0) \
+  X(int,       light,       int16_t, "light_raw", "light", "Light",       0) \
+  X(float,     tempC,       float,   "temp_c",    "temp",  "Temperature", 1) \
+  X(float,     hum,         float,   "hum",       "hum",   "Humidity",    0)
+
+struct Reading {
+#define READING_MEMBER(type, name, wire, fbKey, wsKey, csv, dec) type name;
+  READING_FIELDS(READING_MEMBER)
+#undef READING_MEMBER
+  unsigned long uptimeMs;    // millis() when the ADC window closed; device-only
+};
+
+// Sentinels written when the DHT read fails: tempC = -100, hum = -1.
+// timestampMs is epoch ms, 0 until NTP has synced.
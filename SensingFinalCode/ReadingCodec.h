@@ -0,0 +1,79 @@
+// Smart Plant Buddy - CSV and packed binary codecs for readings
+//
+// Both are expanded from READING_FIELDS in Reading.h, like the JSON writer.
+// The binary layout is the fields' wire types back to back, little-endian
+// (native on the ESP32 and x86 hosts), with no padding. Mood is not stored
+// in binary since it is derived from the reading by the mood rules.
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+#include "Reading.h"
+#include "ReadingJson.h"
+
+//  CSV 
+
+// Header row matching writeReadingCsv(), e.g. "Timestamp,Soil,...,Mood"
+inline size_t writeReadingCsvHeader(char* buf, size_t cap) {
+  TextBuf out(buf, cap);
+#define READING_CSV_HEADER(type, name, wire, fbKey, wsKey, csv, dec) \
+  out.put(csv);                                                      \
+  out.put(',');
+  READING_FIELDS(READING_CSV_HEADER)
+#undef READING_CSV_HEADER
+  out.put("Mood\n");
+  return out.ok ? out.len : 0;
+}
+
+inline size_t writeReadingCsv(char* buf, size_t cap, const Reading& r, Mood mood) {
+  TextBuf out(buf, cap);
+#define READING_CSV_FIELD(type, name, wire, fbKey, wsKey, csv, dec) \
+  out.putValue(r.name, dec);                                        \
+  out.put(',');
+  READING_FIELDS(READING_CSV_FIELD)
+#undef READING_CSV_FIELD
+  out.put('"');
+  out.put(moodToken(mood));
+  out.put("\"\n");
+  return out.ok ? out.len : 0;
+}
+
+//  BINARY 
+
+#define READING_WIRE_SIZE(type, name, wire, fbKey, wsKey, csv, dec) + sizeof(wire)
+const size_t READING_BIN_SIZE = 0 READING_FIELDS(READING_WIRE_SIZE);
+#undef READING_WIRE_SIZE
+
+// Returns READING_BIN_SIZE, or 0 if cap is too small
+inline size_t encodeReading(uint8_t* buf, size_t cap, const Reading& r) {
+  if (cap < READING_BIN_SIZE) return 0;
+  uint8_t* p = buf;
+#define READING_ENCODE(type, name, wire, fbKey, wsKey, csv, dec) \
+  {                                                              \
+    wire v = (wire)r.name;                                       \
+    memcpy(p, &v, sizeof(wire));                                 \
+    p += sizeof(wire);                                           \
+  }
+  READING_FIELDS(READING_ENCODE)
+#undef READING_ENCODE
+  return READING_BIN_SIZE;
+}
+
+// Returns false if len is too short. uptimeMs is not on the wire and is
+// left at 0.
+inline bool decodeReading(const uint8_t* buf, size_t len, Reading& r) {
+  if (len < READING_BIN_SIZE) return false;
+  const uint8_t* p = buf;
+#define READING_DECODE(type, name, wire, fbKey, wsKey, csv, dec) \
+  {                                                              \
+    wire v;                                                      \
+    memcpy(&v, p, sizeof(wire));                                 \
+    r.name = (type)v;                                            \
+    p += sizeof(wire);                                           \
+  }
+  READING_FIELDS(READING_DECODE)
+#undef READING_DECODE
+  r.uptimeMs = 0;
+  return true;
+}
@@ -0,0 +1,113 @@
+// Smart Plant Buddy - zero-allocation JSON for readings
+//
+// Writes straight into a caller-provided buffer (normally on the stack), so
+// the Firebase and WebSocket paths no longer build String temporaries every
+// second. Number formatting matches the String(x, decimals) output that the
+// dashboard already parses. Keys come from READING_FIELDS in Reading.h.
+// plant_bench --filter serialize/json times it against the old String
+// concatenation (~21 heap allocations per Firebase body, none here).
+
+#pragma once
+
+#include <stddef.h>
+#include "Mood.h"
+#include "Reading.h"
+
+// Big enough for either key style with a worst-case reading
+const size_t READING_JSON_MAX = 160;
+
+// Firebase logs use soil_raw/light_raw/temp_c plus a timestamp; the live
+// WebSocket feed uses the short soil/light/temp keys.
+enum JsonKeys { JSON_FIREBASE, JSON_WEBSOCKET };
+
+// Appends text to a fixed buffer; once anything doesn't fit, ok goes false
+// and all further writes are ignored.
+struct TextBuf {
+  char* buf;
+  size_t cap;
+  size_t len;
+  bool ok;
+
+  TextBuf(char* b, size_t c) : buf(b), cap(c), len(0), ok(c > 0) {
+    if (ok) buf[0] = '\0';
+  }
+
+  void put(char c) {
+    if (!ok) return;
+    if (len + 1 >= cap) { ok = false; return; }
+    buf[len++] = c;
+    buf[len] = '\0';
+  }
+
+  void put(const char* s) {
+    while (ok && *s) put(*s++);
+  }
+
+  void putInt(long long v) {
+    char tmp[21];
+    int n = 0;
+    unsigned long long u = v < 0 ? 0ULL - (unsigned long long)v : (unsigned long long)v;
+    do {
+      tmp[n++] = '0' + (char)(u % 10);
+      u /= 10;
+    } while (u);
+    if (v < 0) put('-');
+    while (n) put(tmp[--n]);
+  }
+
+  // Fixed-point with round-half-away-from-zero, like String(float, decimals)
+  void putFixed(float v, int decimals) {
+    long long scale = 1;
+    for (int i = 0; i < decimals; i++) scale *= 10;
+    double scaled = (double)v * scale;
+    long long q = (long long)(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    if (q < 0) {
+      put('-');
+      q = -q;
+    }
+    putInt(q / scale);
+    if (decimals > 0) {
+      put('.');
+      long long frac = q % scale;
+      for (long long d = scale / 10; d > 0; d /= 10) {
+        put('0' + (char)((frac / d) % 10));
+      }
+    }
+  }
+
+  // Field values, picked by member type from READING_FIELDS
+  void putValue(long long v, int) { putInt(v); }
+  void putValue(int v, int) { putInt(v); }
+  void putValue(float v, int decimals) { putFixed(v, decimals); }
+
+  void jsonKey(const char* k) {
+    if (len > 1) put(',');
+    put('"');
+    put(k);
+    put("\":");
+  }
+};
+
+// Serialize one reading. Returns the length written (excluding the NUL),
+// or 0 if the buffer was too small.
+inline size_t writeReadingJson(char* buf, size_t cap, const Reading& r,
+                               Mood mood, JsonKeys keys) {
+  TextBuf out(buf, cap);
+  out.put('{');
+#define READING_JSON_FIELD(type, name, wire, fbKey, wsKey, csv, dec) \
+  {                                                                  \
+    const char* k = keys == JSON_FIREBASE ? fbKey : wsKey;           \
+    if (k) {                                                         \
+      out.jsonKey(k);                                                \
+      out.putValue(r.name, dec);                                     \
+    }                                                                \
+  }
+  READING_FIELDS(READING_JSON_FIELD)
+#undef READING_JSON_FIELD
+  out.jsonKey("mood");
+  out.put('"');
+  out.put(moodToken(mood));
+  out.put('"');
+  out.put('}');
+  return out.ok ? out.len : 0;
+}
@@ -0,0 +1,56 @@
+// Smart Plant Buddy - lock-free single-producer/single-consumer ring
+//
+// Used to hand readings from the sensing task to the main loop, and from the
+// main loop to the networking task, without a mutex. Exactly one thread may
+// push and exactly one may pop. Only <atomic> is needed, so the same ring is
+// used by the std::thread host build; plant_bench --check queue/ runs it
+// between two threads and checks order, loss and duplicates.
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+ public:
+  SpscQueue() : head_(0), tail_(0), dropped_(0) {}
+
+  // Producer side. Returns false (and counts a drop) when full.
+  bool push(const T& item) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == N) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    buf_[head & (N - 1)] = item;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. Returns false when empty.
+  bool pop(T& out) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) return false;
+    out = buf_[tail & (N - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate when called from a third thread
+  size_t size() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+  }
+  bool empty() const { return size() == 0; }
+  static constexpr size_t capacity() { return N; }
+  unsigned long dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  // head and tail on separate cache lines so the two cores don't share one
+  alignas(64) std::atomic<size_t> head_;
+  alignas(64) std::atomic<size_t> tail_;
+  std::atomic<unsigned long> dropped_;
+  T buf_[N];
+};
@@ -0,0 +1,104 @@
+// Smart Plant Buddy - cooperative task scheduler
+//
+// Deadline-based: every task has a period and a time budget. tick() runs at
+// most one due task per call, so the caller can service the WebSocket between
+// tasks instead of sleeping in delay(). No Arduino dependency; the clocks are
+// passed in so the same code runs on the host against a fake clock.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef void (*TaskFn)();
+typedef unsigned long (*ClockFn)();
+
+struct Task {
+  const char* name;
+  TaskFn fn;
+  unsigned long periodMs;
+  unsigned long budgetUs;
+  unsigned long nextRunMs;
+  unsigned long runs;
+  unsigned long overruns;   // runs that exceeded budgetUs
+  unsigned long maxUs;      // worst observed run time
+};
+
+class Scheduler {
+ public:
+  static const uint8_t MAX_TASKS = 12;
+
+  Scheduler(ClockFn msClock, ClockFn usClock)
+    : msClock_(msClock), usClock_(usClock), count_(0) {}
+
+  // Register a periodic task. First run is offsetMs from now, which lets
+  // tasks with the same period be staggered. Returns the task index or -1.
+  int add(const char* name, TaskFn fn, unsigned long periodMs,
+          unsigned long budgetUs, unsigned long offsetMs = 0) {
+    if (count_ >= MAX_TASKS || fn == nullptr) return -1;
+    Task& t = tasks_[count_];
+    t.name = name;
+    t.fn = fn;
+    t.periodMs = periodMs;
+    t.budgetUs = budgetUs;
+    t.nextRunMs = msClock_() + offsetMs;
+    t.runs = 0;
+    t.overruns = 0;
+    t.maxUs = 0;
+    return count_++;
+  }
+
+  // Run the most overdue task, if any. Returns true if a task ran.
+  bool tick() {
+    unsigned long now = msClock_();
+    int due = -1;
+    long worstLate = -1;
+    for (uint8_t i = 0; i < count_; i++) {
+      long late = (long)(now - tasks_[i].nextRunMs);
+      if (late >= 0 && late > worstLate) {
+        worstLate = late;
+        due = i;
+      }
+    }
+    if (due < 0) return false;
+
+    Task& t = tasks_[due];
+    unsigned long start = usClock_();
+    t.fn();
+    unsigned long took = usClock_() - start;
+
+    t.runs++;
+    if (took > t.maxUs) t.maxUs = took;
+    if (t.budgetUs && took > t.budgetUs) t.overruns++;
+
+    // Keep the original phase, but don't try to catch up on missed periods
+    t.nextRunMs += t.periodMs;
+    if ((long)(now - t.nextRunMs) >= 0) t.nextRunMs = now + t.periodMs;
+    return true;
+  }
+
+  // Milliseconds until the next task is due (0 if one is already due)
+  unsigned long msUntilNext() const {
+    if (count_ == 0) return 0;
+    unsigned long now = msClock_();
+    long soonest = (long)(tasks_[0].nextRunMs - now);
+    for (uint8_t i = 1; i < count_; i++) {
+      long d = (long)(tasks_[i].nextRunMs - now);
+      if (d < soonest) soonest = d;
+    }
+    return soonest > 0 ? (unsigned long)soonest : 0;
+  }
+
+  // Make a task due on the next tick (e.g. force an OLED refresh)
+  void trigger(int index) {
+    if (index >= 0 && index < count_) tasks_[index].nextRunMs = msClock_();
+  }
+
+  uint8_t count() const { return count_; }
+  const Task& task(uint8_t i) const { return tasks_[i]; }
+
+ private:
+  ClockFn msClock_;
+  ClockFn usClock_;
+  Task tasks_[MAX_TASKS];
+  uint8_t count_;
+};
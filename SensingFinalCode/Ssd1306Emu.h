@@ -0,0 +1,204 @@
+// Smart Plant Buddy - SSD1306 emulator for host builds
+//
+// Plays the controller's side of the I2C link: it decodes the command
+// stream (addressing mode, column/page windows, display on/off, invert,
+// contrast) and writes data bytes into its own 128x64 GDDRAM exactly as
+// the panel would, wrapping within the current window. Plug it into
+// pushDirty() as the OledBus, or feed raw transactions to i2c(). What the
+// panel would show can then be compared with the renderer's framebuffer
+// or dumped as a PBM image, e.g. to check each mood face off the device:
+//
+//   Ssd1306Emu panel;
+//   pushDirty(panel, fb, view.dirty());
+//   FILE* f = fopen("happy.pbm", "wb");
+//   panel.writePbm(f);    // pnmtopng happy.pbm > happy.png
+//   fclose(f);
+//
+// Traffic is counted per transaction the same way WireOledBus counts it
+// (address + control + payload), so byte counts match the device log.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "OledView.h"
+
+class Ssd1306Emu : public OledBus {
+ public:
+  enum AddressMode { HORIZONTAL = 0, VERTICAL = 1, PAGE = 2 };
+
+  Ssd1306Emu() { reset(); }
+
+  // Power-on state
+  void reset() {
+    memset(ram_, 0, sizeof(ram_));
+    mode_ = PAGE;
+    c0_ = 0;
+    c1_ = OLED_COLUMNS - 1;
+    p0_ = 0;
+    p1_ = OLED_PAGES - 1;
+    col_ = 0;
+    page_ = 0;
+    on_ = false;
+    inverted_ = false;
+    contrast_ = 0x7f;
+    op_ = 0;
+    argsLeft_ = 0;
+    argc_ = 0;
+    transactions_ = 0;
+    bytes_ = 0;
+    dataBytes_ = 0;
+  }
+
+  // One I2C write after the address byte: control byte, then payload
+  void i2c(const uint8_t* bytes, size_t len) {
+    if (len == 0) return;
+    transactions_++;
+    bytes_ += 1 + len;
+    if (bytes[0] & 0x40) {
+      for (size_t i = 1; i < len; i++) writeData(bytes[i]);
+    } else {
+      for (size_t i = 1; i < len; i++) writeCommand(bytes[i]);
+    }
+  }
+
+  void command(const uint8_t* cmd, size_t len) override {
+    transactions_++;
+    bytes_ += 2 + len;
+    for (size_t i = 0; i < len; i++) writeCommand(cmd[i]);
+  }
+
+  void data(const uint8_t* bytes, size_t len) override {
+    transactions_++;
+    bytes_ += 2 + len;
+    for (size_t i = 0; i < len; i++) writeData(bytes[i]);
+  }
+
+  // Pixel as seen on the glass (after invert)
+  bool pixel(uint8_t x, uint8_t y) const {
+    bool lit = ram_[(y / 8) * OLED_COLUMNS + x] & (1 << (y & 7));
+    return lit != inverted_;
+  }
+
+  // Raw GDDRAM, same layout as the Adafruit framebuffer
+  const uint8_t* ram() const { return ram_; }
+  bool matches(const uint8_t* fb) const { return memcmp(ram_, fb, sizeof(ram_)) == 0; }
+
+  // Binary PBM (P4), 1 = lit. A display that is off dumps blank.
+  bool writePbm(FILE* f) const {
+    if (!f) return false;
+    fprintf(f, "P4\n%u %u\n", (unsigned)OLED_COLUMNS, (unsigned)(OLED_PAGES * 8));
+    for (uint8_t y = 0; y < OLED_PAGES * 8; y++) {
+      for (uint8_t x = 0; x < OLED_COLUMNS; x += 8) {
+        uint8_t b = 0;
+        for (uint8_t i = 0; i < 8; i++) {
+          if (on_ && pixel(x + i, y)) b |= 0x80 >> i;
+        }
+        fputc(b, f);
+      }
+    }
+    return !ferror(f);
+  }
+
+  bool displayOn() const { return on_; }
+  bool inverted() const { return inverted_; }
+  uint8_t contrast() const { return contrast_; }
+  uint32_t transactions() const { return transactions_; }
+  uint32_t bytes() const { return bytes_; }
+  uint32_t dataBytes() const { return dataBytes_; }
+  void resetCounters() { transactions_ = bytes_ = dataBytes_ = 0; }
+
+ private:
+  // Parameter bytes that follow each multi-byte command
+  static uint8_t argCount(uint8_t op) {
+    switch (op) {
+      case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+      case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+      case 0x21: case 0x22: case 0xA3:
+        return 2;
+      case 0x29: case 0x2A:
+        return 5;
+      case 0x26: case 0x27:
+        return 6;
+    }
+    return 0;
+  }
+
+  void writeCommand(uint8_t b) {
+    if (argsLeft_ > 0) {
+      args_[argc_++] = b;
+      if (--argsLeft_ == 0) apply(op_);
+      return;
+    }
+    op_ = b;
+    argc_ = 0;
+    argsLeft_ = argCount(b);
+    if (argsLeft_ == 0) apply(b);
+  }
+
+  void apply(uint8_t op) {
+    switch (op) {
+      case 0x20: mode_ = (AddressMode)(args_[0] & 3); break;
+      case 0x21:
+        c0_ = col_ = args_[0] & 0x7f;
+        c1_ = args_[1] & 0x7f;
+        break;
+      case 0x22:
+        p0_ = page_ = args_[0] & 7;
+        p1_ = args_[1] & 7;
+        break;
+      case 0x81: contrast_ = args_[0]; break;
+      case 0xA6: inverted_ = false; break;
+      case 0xA7: inverted_ = true; break;
+      case 0xAE: on_ = false; break;
+      case 0xAF: on_ = true; break;
+      default:
+        // Page addressing mode: B0-B7 page, 00-0F / 10-1F column nibbles
+        if (op >= 0xB0 && op <= 0xB7) page_ = op & 7;
+        else if (op <= 0x0F) col_ = (col_ & 0xF0) | op;
+        else if (op >= 0x10 && op <= 0x1F) col_ = ((op & 0x0F) << 4) | (col_ & 0x0F);
+        break;
+    }
+  }
+
+  // Store at the cursor, then advance it the way the addressing mode does
+  void writeData(uint8_t b) {
+    dataBytes_++;
+    ram_[page_ * OLED_COLUMNS + (col_ & 0x7f)] = b;
+    switch (mode_) {
+      case HORIZONTAL:
+        if (col_++ >= c1_) {
+          col_ = c0_;
+          page_ = page_ >= p1_ ? p0_ : page_ + 1;
+        }
+        break;
+      case VERTICAL:
+        if (page_++ >= p1_) {
+          page_ = p0_;
+          col_ = col_ >= c1_ ? c0_ : col_ + 1;
+        }
+        break;
+      default:
+        if (col_ < OLED_COLUMNS - 1) col_++;
+        break;
+    }
+  }
+
+  uint8_t ram_[OLED_PAGES * OLED_COLUMNS];
+  AddressMode mode_;
+  uint8_t c0_, c1_, p0_, p1_;
+  uint8_t col_, page_;
+  bool on_;
+  bool inverted_;
+  uint8_t contrast_;
+  uint8_t op_;
+  uint8_t args_[6];
+  uint8_t argsLeft_;
+  uint8_t argc_;
+  uint32_t transactions_;
+  uint32_t bytes_;
+  uint32_t dataBytes_;
+};
@@ -0,0 +1,71 @@
+// Smart Plant Buddy - OLED status screen
+//
+// Layout and formatting of the main screen: a title and labels drawn once,
+// then five retained fields (face, caption, soil, temperature, humidity)
+// that are only redrawn when their text changes. Templated on the drawing
+// target, so the sketch renders into Adafruit_SSD1306 and a host build can
+// render into any Adafruit_GFX-compatible canvas and push the dirty
+// windows into Ssd1306Emu.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "Mood.h"
+#include "OledView.h"
+
+template <class Gfx>
+class StatusScreen {
+ public:
+  explicit StatusScreen(Gfx& gfx) : gfx_(gfx), framed_(false) {
+    face_ = view_.addField(20, 15, 2, 7);
+    text_ = view_.addField(20, 35, 1, 11);
+    soil_ = view_.addField(12, 48, 1, 4);
+    temp_ = view_.addField(54, 48, 1, 5);
+    hum_ = view_.addField(12, 56, 1, 4);
+  }
+
+  // Call after something else drew over the screen
+  void invalidate() { framed_ = false; }
+
+  // Compose into the framebuffer; view().dirty() then says what to push
+  void update(int soil, float temp, float hum, Mood mood) {
+    if (!framed_) drawFrame();
+
+    char buf[OLED_FIELD_CHARS + 1];
+    view_.set(face_, moodFace(mood));
+    view_.set(text_, moodText(mood));
+    snprintf(buf, sizeof(buf), "%d", soil);
+    view_.set(soil_, buf);
+    snprintf(buf, sizeof(buf), "%.0fC", temp);
+    view_.set(temp_, buf);
+    snprintf(buf, sizeof(buf), "%.0f%%", hum);
+    view_.set(hum_, buf);
+    view_.render(gfx_);
+  }
+
+  OledView& view() { return view_; }
+
+ private:
+  void drawFrame() {
+    gfx_.fillScreen(0);
+    gfx_.setTextColor(1);
+    gfx_.setTextSize(1);
+    gfx_.setCursor(0, 0);
+    gfx_.print("Smart Plant Buddy");
+    gfx_.drawLine(0, 10, 128, 10, 1);
+    gfx_.setCursor(0, 48);
+    gfx_.print("S:");
+    gfx_.setCursor(42, 48);
+    gfx_.print("T:");
+    gfx_.setCursor(0, 56);
+    gfx_.print("H:");
+    view_.invalidate();
+    framed_ = true;
+  }
+
+  Gfx& gfx_;
+  OledView view_;
+  bool framed_;
+  uint8_t face_, text_, soil_, temp_, hum_;
+};
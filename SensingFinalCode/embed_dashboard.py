@@ -0,0 +1,36 @@
+# Packs Dashboard.html into DashboardHtml.h so the ESP32 can serve it itself.
+# The page is gzipped once here (the browser inflates it), and the ETag is a
+# hash of the compressed bytes so browsers revalidate with a tiny 304.
+# Re-run after editing Dashboard.html:  python3 embed_dashboard.py
+import gzip
+import hashlib
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.join(HERE, 'Dashboard.html')
+OUT = os.path.join(HERE, 'DashboardHtml.h')
+
+with open(SRC, 'rb') as f:
+    html = f.read()
+
+# mtime=0 keeps the output identical between runs
+gz = gzip.compress(html, compresslevel=9, mtime=0)
+etag = hashlib.sha1(gz).hexdigest()[:16]
+
+lines = []
+for i in range(0, len(gz), 16):
+    lines.append('  ' + ', '.join('0x%02x' % b for b in gz[i:i + 16]) + ',')
+
+with open(OUT, 'w') as f:
+    f.write('// Generated by embed_dashboard.py from Dashboard.html - do not edit.\n')
+    f.write('// %d bytes of HTML, %d bytes gzipped.\n\n' % (len(html), len(gz)))
+    f.write('#pragma once\n\n')
+    f.write('#include <stddef.h>\n#include <stdint.h>\n\n')
+    f.write('#ifndef PROGMEM\n#define PROGMEM\n#endif\n\n')
+    f.write('#define DASHBOARD_ETAG "\\"%s\\""\n\n' % etag)
+    f.write('const size_t DASHBOARD_HTML_GZ_LEN = %d;\n\n' % len(gz))
+    f.write('const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {\n')
+    f.write('\n'.join(lines))
+    f.write('\n};\n')
+
+print('Dashboard: %d bytes -> %d gzipped, ETag %s' % (len(html), len(gz), etag))
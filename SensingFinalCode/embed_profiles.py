@@ -0,0 +1,47 @@
+# Packs the Firebase plantTypes node into PlantProfiles.h so the device can
+# pick a species' ranges without fetching them. Takes an RTDB export (the
+# whole database or just plantTypes) and writes one PlantProfile per entry.
+# Re-run after editing plantTypes:
+#   python3 embed_profiles.py ["../smartplantsensor-default-rtdb-export (2).json"]
+import json
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+    HERE, '..', 'smartplantsensor-default-rtdb-export (2).json')
+OUT = os.path.join(HERE, 'PlantProfiles.h')
+
+with open(SRC, encoding='utf-8') as f:
+    data = json.load(f)
+types = data.get('plantTypes', data)
+
+
+def num(v):
+    s = '%g' % float(v)
+    return s + ('f' if '.' in s or 'e' in s else '.0f')
+
+
+def rng(node, lo='min', hi='max'):
+    return '{%s, %s}' % (num(node[lo]), num(node[hi]))
+
+
+rows = []
+for pid in sorted(types):
+    p = types[pid]
+    rows.append('  {%s, %s, %s, %s, %s, %s},' % (
+        json.dumps(pid), json.dumps(p.get('name', pid)),
+        rng(p['water'], 'soil_min', 'soil_max'), rng(p['light']),
+        rng(p['temp']), rng(p['humidity'])))
+
+with open(OUT, 'w') as f:
+    f.write('// Generated by embed_profiles.py from the plantTypes node - do not edit.\n')
+    f.write('// Ranges: soil (water.soil_min/max), light, temp, humidity.\n\n')
+    f.write('#pragma once\n\n')
+    f.write('#include <stdint.h>\n#include "MoodRules.h"\n\n')
+    f.write('const PlantProfile PLANT_PROFILES[] = {\n')
+    f.write('\n'.join(rows))
+    f.write('\n};\n\n')
+    f.write('const uint8_t PLANT_PROFILE_COUNT = %d;\n' % len(rows))
+
+print('Plant profiles: %d written' % len(rows))
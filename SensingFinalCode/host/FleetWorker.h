@@ -0,0 +1,634 @@
+// Smart Plant Buddy - one thread of the device fleet
+//
+// A FleetWorker runs its share of plant_fleet's devices on one thread.
+// Each device is a PlantCore on a LinuxHal of its own, booted at its own
+// point in the ramp, with a virtual clock that runs `speed` times the
+// wall clock and moves in steps of at most stepMs. The sensor task and
+// loop() tick inline. The network task runs on a fiber, as it has a
+// FreeRTOS task of its own on the ESP32: httpSend() queues the request on
+// the device's socket and parks the fiber, and the worker's epoll loop
+// resumes it with the response, while that device's other tasks and every
+// other device carry on. A fiber stack is only held while a request is in
+// flight.
+//
+// Every device keeps one keep-alive connection like FirebaseClient,
+// reconnecting (and retrying once) when a reused one turns out closed, and
+// uploads to /plants/<device id>/ instead of plant1. Listeners hold an
+// event stream on a device's logs, as the dashboard does, and time each
+// batch from the PATCH being sent to its event arriving.
+//
+// Steps longer than ADC_BURST_MAX / 2 frames of ADC results overflow the
+// simulated DMA buffer, so stepMs should stay under ~300 ms at 100 Hz.
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "../PlantCore.h"
+#include "LinuxHal.h"
+
+const size_t FLEET_STACK_BYTES = 64 * 1024;
+const unsigned long FLEET_TIMEOUT_MS = 10000;   // HTTPClient's timeout on the device
+const uint8_t FLEET_ROUND_STEPS = 4;            // per device per round, so all progress evenly
+const uint8_t FLEET_LOOPBACK_SOURCES = 8;       // 127.0.0.1-8, ~28k ephemeral ports each
+const uint16_t FLEET_POLL_EVERY = 64;           // devices stepped between network checks
+const int FLEET_EPOLL_EVENTS = 256;
+const size_t FLEET_READ_CHUNK = 16384;
+const char FLEET_PLANT_PREFIX[] = "/plants/plant1/";
+
+struct FleetConfig {
+  sockaddr_in server;
+  bool loopback;          // spread connections over several source addresses
+  const char* host;       // for the Host header
+  double speed;           // virtual ms per wall ms
+  unsigned long stepMs;
+  const char* plant;      // plant profile id
+  uint32_t seed;
+  size_t batch;           // readings per upload, 0 = BATCH_SIZE
+};
+
+struct FleetStats {
+  FleetStats() { memset(counts, 0, sizeof(counts)); }
+
+  enum Count {
+    REQUESTS,      // httpSend calls
+    FAILURES,      // no 200 in the end
+    RECORDS,       // readings in successful log PATCHes
+    HEALTH,        // health records
+    BYTES,         // request bodies
+    CONNECTS,
+    RETRIES,       // reused connection was closed, sent again
+    TIMEOUTS,
+    EVENTS,        // stream events matched to a PATCH
+    COUNT_MAX
+  };
+
+  void merge(const FleetStats& o) {
+    for (uint8_t i = 0; i < COUNT_MAX; i++) counts[i] += o.counts[i];
+    ingestUs.merge(o.ingestUs);
+    endToEndUs.merge(o.endToEndUs);
+  }
+
+  unsigned long long counts[COUNT_MAX];
+  LatencyHistogram ingestUs;     // httpSend() called -> response read
+  LatencyHistogram endToEndUs;   // log PATCH sent -> stream event received
+};
+
+inline uint64_t fleetNowUs() { return monotonicNs() / 1000; }
+
+class FleetWorker;
+struct FleetDevice;
+
+//  DEVICE
+
+// LinuxHal with the upload going out through the worker
+class FleetHal : public LinuxHal {
+ public:
+  FleetHal(const LinuxHalConfig& config, SimSensors& sensors, FleetWorker& worker, FleetDevice& device)
+    : LinuxHal(config, sensors), worker_(worker), device_(device) {}
+
+  int httpSend(const char* method, const char* path, const char* body, size_t len,
+               PostTiming& t) override;
+  void httpStop() override;
+
+  // One process's malloc says nothing about a single device; report the
+  // heap as it is after boot rather than walk the arenas every sample
+  void heapInfo(HeapInfo& out) override {
+    out.freeBytes = out.largestFree = out.minFree = SIM_HEAP_BYTES;
+    out.counting = false;
+  }
+
+ private:
+  FleetWorker& worker_;
+  FleetDevice& device_;
+};
+
+struct FleetFiber {
+  ucontext_t ctx;
+  char* stack;
+  FleetDevice* device;
+  bool done;
+  bool ran;
+};
+
+struct FleetDevice {
+  FleetDevice(uint32_t index, uint32_t seed, FleetWorker& worker)
+    : index(index), slot(0), sensors(seed), hal(halConfig(seed), sensors, worker, *this), core(hal),
+      bootUs(0), booted(false), fiber(nullptr), fd(-1), connecting(false), inFlight(false),
+      retried(false), isLogs(false), timing(nullptr), startUs(0), sentUs(0), connectUs(0),
+      outSent(0), eventFromUs(0) {
+    snprintf(id, sizeof(id), "fleet%06u", (unsigned)index);
+  }
+
+  static LinuxHalConfig halConfig(uint32_t seed) {
+    LinuxHalConfig c = {seed, 0, 0, nullptr, true, nullptr, nullptr, 0, 0};
+    return c;
+  }
+
+  uint32_t index;
+  uint32_t slot;             // in the worker's devices
+  char id[16];
+  WaveformSensors sensors;
+  FleetHal hal;
+  PlantCore core;
+  uint64_t bootUs;          // wall time the device powers up
+  bool booted;
+  FleetFiber* fiber;        // network task, while it is running or parked
+
+  // Upload connection and the request in flight
+  int fd;
+  bool connecting;
+  bool inFlight;
+  bool retried;
+  bool isLogs;
+  PostTiming* timing;
+  uint64_t startUs;         // httpSend() called
+  uint64_t sentUs;          // this attempt's request written
+  uint64_t connectUs;
+  std::string request;      // kept for the retry
+  size_t outSent;
+  std::string in;
+
+  uint64_t eventFromUs;     // last log PATCH, until a listener sees it
+};
+
+struct FleetListener {
+  FleetDevice* device;
+  int fd;
+  bool open;                // response header seen
+  std::string in;
+};
+
+//  WORKER
+
+class FleetWorker {
+ public:
+  FleetWorker(const FleetConfig& config, uint32_t first, uint32_t stride, uint32_t total,
+              uint32_t listeners, uint64_t rampUs)
+    : config_(config), epollFd_(epoll_create1(0)), measureUs_(0) {
+    // Devices first, stride, first + 2 * stride, ...: boot order interleaves threads
+    for (uint32_t i = first; i < total; i += stride) {
+      FleetDevice* d = new FleetDevice(i, config.seed + i * 7919, *this);
+      d->slot = (uint32_t)devices_.size();
+      d->bootUs = rampUs * (uint64_t)((i * 2654435761u) % total) / total;
+      devices_.push_back(d);
+      if (i < listeners) listeners_.push_back(FleetListener{d, -1, false, std::string()});
+    }
+  }
+
+  ~FleetWorker() {
+    for (FleetDevice* d : devices_) {
+      if (d->fd >= 0) ::close(d->fd);
+      delete d;
+    }
+    for (FleetListener& l : listeners_) {
+      if (l.fd >= 0) ::close(l.fd);
+    }
+    for (FleetFiber* f : fibers_) {
+      delete[] f->stack;
+      delete f;
+    }
+    if (epollFd_ >= 0) ::close(epollFd_);
+  }
+
+  // Runs the devices from startUs to endUs; only what starts after
+  // measureUs is counted
+  void run(uint64_t startUs, uint64_t measureUs, uint64_t endUs, const volatile bool& stop) {
+    measureUs_ = measureUs;
+    for (FleetDevice* d : devices_) d->bootUs += startUs;
+    for (size_t i = 0; i < listeners_.size(); i++) openListener(i);
+
+    // Wall time one step takes; rounds come no faster than that once caught up
+    int idleMs = (int)(config_.stepMs / config_.speed);
+    if (idleMs > 50) idleMs = 50;
+    for (uint64_t now = fleetNowUs(); now < endUs && !stop; now = fleetNowUs()) {
+      bool behind = false;
+      for (size_t i = 0; i < devices_.size(); i++) {
+        behind |= advance(*devices_[i], now);
+        // Responses don't wait for the whole round, or it would be timed too
+        if (i % FLEET_POLL_EVERY == FLEET_POLL_EVERY - 1) poll(0);
+      }
+      expire(fleetNowUs());
+      poll(behind ? 0 : idleMs);
+    }
+  }
+
+  const FleetStats& stats() const { return stats_; }
+  size_t devices() const { return devices_.size(); }
+
+  // Virtual time the booted devices ran against what the speed asked for
+  void virtualTime(uint64_t nowUs, double& ranMs, double& targetMs) {
+    for (FleetDevice* d : devices_) {
+      if (!d->booted) continue;
+      ranMs += d->hal.millis();
+      targetMs += (nowUs - d->bootUs) / 1000.0 * config_.speed;
+    }
+  }
+
+  size_t connections() const {
+    size_t n = 0;
+    for (const FleetDevice* d : devices_) n += d->fd >= 0;
+    return n;
+  }
+
+  //  FROM THE NETWORK TASK (on the device's fiber)
+
+  int send(FleetDevice& d, const char* method, const char* path, const char* body, size_t len,
+           PostTiming& t) {
+    memset(&t, 0, sizeof(t));
+    d.isLogs = strcmp(path, FIREBASE_LOGS_PATH) == 0;
+    char mapped[128];
+    if (strncmp(path, FLEET_PLANT_PREFIX, sizeof(FLEET_PLANT_PREFIX) - 1) == 0) {
+      snprintf(mapped, sizeof(mapped), "/plants/%s/%s", d.id, path + sizeof(FLEET_PLANT_PREFIX) - 1);
+      path = mapped;
+    }
+    char head[256];
+    int n = snprintf(head, sizeof(head),
+                     "%s %s HTTP/1.1\r\nHost: %s\r\nContent-Type: application/json\r\n"
+                     "Content-Length: %zu\r\n\r\n", method, path, config_.host, len);
+    d.request.assign(head, n);
+    d.request.append(body, len);
+    d.timing = &t;
+    d.retried = false;
+    d.startUs = fleetNowUs();
+    d.inFlight = true;
+    if (d.isLogs) d.eventFromUs = d.startUs;
+    attempt(d);
+    if (d.inFlight) park(d);
+
+    if (d.startUs >= measureUs_) {
+      stats_.counts[FleetStats::REQUESTS]++;
+      stats_.counts[FleetStats::BYTES] += len;
+      if (t.code == 200) {
+        unsigned long records = HttpStandIn::countRecords(body, len);
+        stats_.counts[d.isLogs ? FleetStats::RECORDS : FleetStats::HEALTH] += records;
+        stats_.ingestUs.record((uint32_t)(fleetNowUs() - d.startUs));
+      } else {
+        stats_.counts[FleetStats::FAILURES]++;
+      }
+    }
+    return t.code;
+  }
+
+  void stop(FleetDevice& d) { closeDevice(d); }
+
+ private:
+  //  STEPPING
+
+  // Moves a device's clock towards where the wall clock says it should be;
+  // true if it is still behind after this round's steps
+  bool advance(FleetDevice& d, uint64_t now) {
+    if (now < d.bootUs) return false;
+    d.core.makeCurrent();
+    if (!d.booted) {
+      d.core.setLogLevel(LOG_LVL_OFF);
+      d.core.begin(config_.plant);
+      if (config_.batch) d.core.setBatching(config_.batch, config_.batch * POST_INTERVAL_MS);
+      d.core.beginNet();
+      d.booted = true;
+    }
+    uint64_t target = (uint64_t)((now - d.bootUs) / 1000.0 * config_.speed);
+    for (uint8_t i = 0; i < FLEET_ROUND_STEPS; i++) {
+      unsigned long at = d.hal.millis();
+      if (at >= target) return false;
+      d.hal.advance(target - at < config_.stepMs ? (unsigned long)(target - at) : config_.stepMs);
+      tick(d);
+    }
+    return d.hal.millis() < target;
+  }
+
+  // Runs whatever is due, as plant_sim's loop does; the network task only
+  // when it isn't waiting on a response
+  void tick(FleetDevice& d) {
+    bool ran;
+    do {
+      ran = d.core.sensorTick();
+      ran |= d.core.loopTick();
+      if (!d.fiber && d.core.netScheduler().msUntilNext() == 0) ran |= startNet(d);
+    } while (ran);
+  }
+
+  //  FIBERS
+
+  static void fiberMain(uint32_t lo, uint32_t hi) {
+    FleetFiber* f = (FleetFiber*)(((uintptr_t)hi << 32) | lo);
+    f->ran = f->device->core.netTick();
+    f->done = true;   // returns to the worker through uc_link
+  }
+
+  bool startNet(FleetDevice& d) {
+    FleetFiber* f;
+    if (spare_.empty()) {
+      f = new FleetFiber();
+      f->stack = new char[FLEET_STACK_BYTES];
+      fibers_.push_back(f);
+    } else {
+      f = spare_.back();
+      spare_.pop_back();
+    }
+    f->device = &d;
+    f->done = false;
+    f->ran = false;
+    getcontext(&f->ctx);
+    f->ctx.uc_stack.ss_sp = f->stack;
+    f->ctx.uc_stack.ss_size = FLEET_STACK_BYTES;
+    f->ctx.uc_link = &main_;
+    uintptr_t p = (uintptr_t)f;
+    makecontext(&f->ctx, (void (*)())fiberMain, 2, (uint32_t)p, (uint32_t)((uint64_t)p >> 32));
+    d.fiber = f;
+    running_ = f;
+    swapcontext(&main_, &f->ctx);
+    running_ = nullptr;
+    return finish(d);
+  }
+
+  // Back on the worker: hand the stack back if the task is done
+  bool finish(FleetDevice& d) {
+    FleetFiber* f = d.fiber;
+    if (!f->done) return false;
+    d.fiber = nullptr;
+    spare_.push_back(f);
+    return f->ran;
+  }
+
+  void park(FleetDevice& d) { swapcontext(&d.fiber->ctx, &main_); }
+
+  void resume(FleetDevice& d) {
+    d.core.makeCurrent();
+    running_ = d.fiber;
+    swapcontext(&main_, &d.fiber->ctx);
+    running_ = nullptr;
+    finish(d);
+  }
+
+  //  UPLOAD CONNECTION
+
+  // Sends the request, connecting first if there is no connection
+  void attempt(FleetDevice& d) {
+    d.timing->reused = d.fd >= 0;
+    if (d.fd >= 0) {
+      write(d);
+      return;
+    }
+    d.connectUs = fleetNowUs();
+    d.fd = openSocket(d.index);
+    if (d.fd < 0) {
+      complete(d, -1);   // HTTPC_ERROR_CONNECTION_REFUSED
+      return;
+    }
+    if (isMeasured(d)) stats_.counts[FleetStats::CONNECTS]++;
+    int rc = ::connect(d.fd, (const sockaddr*)&config_.server, sizeof(config_.server));
+    if (rc != 0 && errno != EINPROGRESS) {
+      closeDevice(d);
+      complete(d, -1);
+      return;
+    }
+    d.connecting = true;
+    watch(d.fd, deviceTag(d), EPOLLOUT);
+  }
+
+  int openSocket(uint32_t index) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (fd < 0) return -1;
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    if (config_.loopback) {
+      sockaddr_in src;
+      memset(&src, 0, sizeof(src));
+      src.sin_family = AF_INET;
+      src.sin_addr.s_addr = htonl(0x7f000001 + index % FLEET_LOOPBACK_SOURCES);
+      bind(fd, (sockaddr*)&src, sizeof(src));
+    }
+    return fd;
+  }
+
+  void write(FleetDevice& d) {
+    d.sentUs = fleetNowUs();
+    d.outSent = 0;
+    d.in.clear();
+    flush(d);
+  }
+
+  void flush(FleetDevice& d) {
+    while (d.outSent < d.request.size()) {
+      ssize_t n = ::send(d.fd, d.request.data() + d.outSent, d.request.size() - d.outSent,
+                         MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        failed(d);
+        return;
+      }
+      d.outSent += n;
+    }
+    watch(d.fd, deviceTag(d), d.outSent < d.request.size() ? EPOLLIN | EPOLLOUT : EPOLLIN);
+  }
+
+  // A reused connection that fails is retried once on a fresh one
+  void failed(FleetDevice& d) {
+    bool reused = d.timing->reused;
+    closeDevice(d);
+    if (reused && !d.retried) {
+      d.retried = true;
+      if (isMeasured(d)) stats_.counts[FleetStats::RETRIES]++;
+      attempt(d);
+      return;
+    }
+    complete(d, -4);   // HTTPC_ERROR_NOT_CONNECTED
+  }
+
+  void complete(FleetDevice& d, int code) {
+    d.timing->code = code;
+    d.inFlight = false;
+    // Straight from send() when it failed without waiting
+    if (d.fiber && d.fiber != running_) resume(d);
+  }
+
+  void closeDevice(FleetDevice& d) {
+    if (d.fd < 0) return;
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, d.fd, nullptr);
+    ::close(d.fd);
+    d.fd = -1;
+    d.connecting = false;
+  }
+
+  void onDevice(FleetDevice& d, uint32_t events) {
+    if (d.connecting) {
+      if (!(events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) return;   // left over from a closed socket
+      int err = 0;
+      socklen_t len = sizeof(err);
+      getsockopt(d.fd, SOL_SOCKET, SO_ERROR, &err, &len);
+      if (err != 0 || (events & (EPOLLERR | EPOLLHUP))) {
+        closeDevice(d);
+        complete(d, -1);
+        return;
+      }
+      d.connecting = false;
+      d.timing->connectUs = fleetNowUs() - d.connectUs;
+      write(d);
+      return;
+    }
+    if ((events & EPOLLOUT) && d.inFlight) flush(d);
+    if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR)) || d.fd < 0) return;
+
+    char buf[FLEET_READ_CHUNK];
+    ssize_t got = recv(d.fd, buf, sizeof(buf), 0);
+    if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+    if (got <= 0) {
+      // Closed while idle is the server dropping a keep-alive connection
+      if (d.inFlight) failed(d);
+      else closeDevice(d);
+      return;
+    }
+    if (!d.inFlight) return;   // nothing was asked
+    d.in.append(buf, got);
+    size_t headEnd = d.in.find("\r\n\r\n");
+    if (headEnd == std::string::npos) return;
+    int code = 0;
+    if (sscanf(d.in.c_str(), "HTTP/1.%*d %d", &code) != 1) {
+      closeDevice(d);
+      complete(d, -7);   // HTTPC_ERROR_NO_HTTP_SERVER
+      return;
+    }
+    size_t length = 0;
+    bool close = false;
+    for (size_t at = d.in.find("\r\n") + 2; at < headEnd;) {
+      size_t end = d.in.find("\r\n", at);
+      const char* h = d.in.c_str() + at;
+      if (strncasecmp(h, "Content-Length:", 15) == 0) length = strtoul(h + 15, nullptr, 10);
+      else if (strncasecmp(h, "Connection: close", 17) == 0) close = true;
+      at = end + 2;
+    }
+    if (d.in.size() < headEnd + 4 + length) return;
+    d.timing->transferUs = fleetNowUs() - d.sentUs;
+    if (close) closeDevice(d);
+    complete(d, code);
+  }
+
+  // HTTPClient gives up after its timeout; so does the device here
+  void expire(uint64_t now) {
+    for (FleetDevice* d : devices_) {
+      if (!d->inFlight || now - d->startUs < FLEET_TIMEOUT_MS * 1000ULL) continue;
+      if (isMeasured(*d)) stats_.counts[FleetStats::TIMEOUTS]++;
+      closeDevice(*d);
+      complete(*d, -11);   // HTTPC_ERROR_READ_TIMEOUT
+    }
+  }
+
+  bool isMeasured(const FleetDevice& d) const { return d.startUs >= measureUs_; }
+
+  //  LISTENERS
+
+  void openListener(size_t i) {
+    FleetListener& l = listeners_[i];
+    l.fd = openSocket(l.device->index);
+    if (l.fd < 0) return;
+    int rc = ::connect(l.fd, (const sockaddr*)&config_.server, sizeof(config_.server));
+    if (rc != 0 && errno != EINPROGRESS) {
+      ::close(l.fd);
+      l.fd = -1;
+      return;
+    }
+    char req[256];
+    int n = snprintf(req, sizeof(req),
+                     "GET /plants/%s/logs.json HTTP/1.1\r\nHost: %s\r\n"
+                     "Accept: text/event-stream\r\n\r\n", l.device->id, config_.host);
+    l.in.assign(req, n);   // sent once connected
+    watch(l.fd, listenerTag(i), EPOLLOUT);
+  }
+
+  void onListener(size_t i, uint32_t events) {
+    FleetListener& l = listeners_[i];
+    if (events & EPOLLOUT) {
+      // Connected: the request is small enough to go in one send
+      ::send(l.fd, l.in.data(), l.in.size(), MSG_NOSIGNAL);
+      l.in.clear();
+      watch(l.fd, listenerTag(i), EPOLLIN);
+      return;
+    }
+    char buf[FLEET_READ_CHUNK];
+    ssize_t got = recv(l.fd, buf, sizeof(buf), 0);
+    if (got <= 0) {
+      if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+      epoll_ctl(epollFd_, EPOLL_CTL_DEL, l.fd, nullptr);
+      ::close(l.fd);
+      l.fd = -1;
+      return;
+    }
+    l.in.append(buf, got);
+    if (!l.open) {
+      size_t headEnd = l.in.find("\r\n\r\n");
+      if (headEnd == std::string::npos) return;
+      l.in.erase(0, headEnd + 4);
+      l.open = true;
+    }
+    // A patch event is a batch arriving; put events are the snapshot
+    size_t end;
+    while ((end = l.in.find("\n\n")) != std::string::npos) {
+      uint64_t from = l.device->eventFromUs;
+      if (l.in.compare(0, 12, "event: patch") == 0 && from) {
+        l.device->eventFromUs = 0;
+        if (from >= measureUs_) {
+          stats_.counts[FleetStats::EVENTS]++;
+          stats_.endToEndUs.record((uint32_t)(fleetNowUs() - from));
+        }
+      }
+      l.in.erase(0, end + 2);
+    }
+  }
+
+  //  EPOLL
+
+  // Tags: device slot * 2, listener index * 2 + 1
+  uint64_t deviceTag(const FleetDevice& d) const { return (uint64_t)d.slot << 1; }
+  uint64_t listenerTag(size_t i) const { return ((uint64_t)i << 1) | 1; }
+
+  void watch(int fd, uint64_t tag, uint32_t events) {
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.u64 = tag;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_MOD, fd, &ev) != 0) epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev);
+  }
+
+  void poll(int timeoutMs) {
+    epoll_event events[FLEET_EPOLL_EVENTS];
+    int n = epoll_wait(epollFd_, events, FLEET_EPOLL_EVENTS, timeoutMs);
+    for (int i = 0; i < n; i++) {
+      uint64_t tag = events[i].data.u64;
+      if (tag & 1) {
+        onListener(tag >> 1, events[i].events);
+      } else {
+        FleetDevice& d = *devices_[tag >> 1];
+        if (d.fd >= 0) onDevice(d, events[i].events);
+      }
+    }
+  }
+
+  FleetConfig config_;
+  int epollFd_;
+  uint64_t measureUs_;
+  std::vector<FleetDevice*> devices_;
+  std::vector<FleetListener> listeners_;
+  std::vector<FleetFiber*> fibers_;   // all, for cleanup
+  std::vector<FleetFiber*> spare_;
+  ucontext_t main_;
+  FleetFiber* running_ = nullptr;   // fiber on the CPU, if any
+  FleetStats stats_;
+};
+
+inline int FleetHal::httpSend(const char* method, const char* path, const char* body, size_t len,
+                              PostTiming& t) {
+  return worker_.send(device_, method, path, body, len, t);
+}
+
+inline void FleetHal::httpStop() { worker_.stop(device_); }
@@ -0,0 +1,199 @@
+// Smart Plant Buddy - 128x64 drawing target for host builds
+//
+// The subset of the Adafruit_GFX API that StatusScreen and OledView use,
+// drawing into an SSD1306-layout framebuffer (8 pages of 128 column
+// bytes) that pushDirty() can send to Ssd1306Emu. Text uses the classic
+// 6x8 cell, size scaling and the glcdfont.c glyphs, so a framebuffer
+// matches the panel pixel for pixel (plant_bench --check oled/ holds each
+// status screen against a golden PBM in host/golden). Only printable
+// ASCII is kept; the status screen prints nothing else, and other codes
+// draw blank.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "../OledView.h"
+
+// Adafruit glcdfont.c (classic 5x7), printable ASCII 0x20-0x7E: five
+// column bytes per glyph, bit 0 at the top, bit 7 for descenders
+const uint8_t HOST_FONT_FIRST = 0x20;
+const uint8_t HOST_FONT_LAST = 0x7e;
+
+static const uint8_t HOST_FONT[(HOST_FONT_LAST - HOST_FONT_FIRST + 1) * 5] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,   // ' '
+  0x00, 0x00, 0x5F, 0x00, 0x00,   // '!'
+  0x00, 0x07, 0x00, 0x07, 0x00,   // '"'
+  0x14, 0x7F, 0x14, 0x7F, 0x14,   // '#'
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,   // '$'
+  0x23, 0x13, 0x08, 0x64, 0x62,   // '%'
+  0x36, 0x49, 0x56, 0x20, 0x50,   // '&'
+  0x00, 0x08, 0x07, 0x03, 0x00,   // "'"
+  0x00, 0x1C, 0x22, 0x41, 0x00,   // '('
+  0x00, 0x41, 0x22, 0x1C, 0x00,   // ')'
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,   // '*'
+  0x08, 0x08, 0x3E, 0x08, 0x08,   // '+'
+  0x00, 0x80, 0x70, 0x30, 0x00,   // ','
+  0x08, 0x08, 0x08, 0x08, 0x08,   // '-'
+  0x00, 0x00, 0x60, 0x60, 0x00,   // '.'
+  0x20, 0x10, 0x08, 0x04, 0x02,   // '/'
+  0x3E, 0x51, 0x49, 0x45, 0x3E,   // '0'
+  0x00, 0x42, 0x7F, 0x40, 0x00,   // '1'
+  0x72, 0x49, 0x49, 0x49, 0x46,   // '2'
+  0x21, 0x41, 0x49, 0x4D, 0x33,   // '3'
+  0x18, 0x14, 0x12, 0x7F, 0x10,   // '4'
+  0x27, 0x45, 0x45, 0x45, 0x39,   // '5'
+  0x3C, 0x4A, 0x49, 0x49, 0x31,   // '6'
+  0x41, 0x21, 0x11, 0x09, 0x07,   // '7'
+  0x36, 0x49, 0x49, 0x49, 0x36,   // '8'
+  0x46, 0x49, 0x49, 0x29, 0x1E,   // '9'
+  0x00, 0x00, 0x14, 0x00, 0x00,   // ':'
+  0x00, 0x40, 0x34, 0x00, 0x00,   // ';'
+  0x00, 0x08, 0x14, 0x22, 0x41,   // '<'
+  0x14, 0x14, 0x14, 0x14, 0x14,   // '='
+  0x00, 0x41, 0x22, 0x14, 0x08,   // '>'
+  0x02, 0x01, 0x59, 0x09, 0x06,   // '?'
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,   // '@'
+  0x7C, 0x12, 0x11, 0x12, 0x7C,   // 'A'
+  0x7F, 0x49, 0x49, 0x49, 0x36,   // 'B'
+  0x3E, 0x41, 0x41, 0x41, 0x22,   // 'C'
+  0x7F, 0x41, 0x41, 0x41, 0x3E,   // 'D'
+  0x7F, 0x49, 0x49, 0x49, 0x41,   // 'E'
+  0x7F, 0x09, 0x09, 0x09, 0x01,   // 'F'
+  0x3E, 0x41, 0x41, 0x51, 0x73,   // 'G'
+  0x7F, 0x08, 0x08, 0x08, 0x7F,   // 'H'
+  0x00, 0x41, 0x7F, 0x41, 0x00,   // 'I'
+  0x20, 0x40, 0x41, 0x3F, 0x01,   // 'J'
+  0x7F, 0x08, 0x14, 0x22, 0x41,   // 'K'
+  0x7F, 0x40, 0x40, 0x40, 0x40,   // 'L'
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,   // 'M'
+  0x7F, 0x04, 0x08, 0x10, 0x7F,   // 'N'
+  0x3E, 0x41, 0x41, 0x41, 0x3E,   // 'O'
+  0x7F, 0x09, 0x09, 0x09, 0x06,   // 'P'
+  0x3E, 0x41, 0x51, 0x21, 0x5E,   // 'Q'
+  0x7F, 0x09, 0x19, 0x29, 0x46,   // 'R'
+  0x26, 0x49, 0x49, 0x49, 0x32,   // 'S'
+  0x03, 0x01, 0x7F, 0x01, 0x03,   // 'T'
+  0x3F, 0x40, 0x40, 0x40, 0x3F,   // 'U'
+  0x1F, 0x20, 0x40, 0x20, 0x1F,   // 'V'
+  0x3F, 0x40, 0x38, 0x40, 0x3F,   // 'W'
+  0x63, 0x14, 0x08, 0x14, 0x63,   // 'X'
+  0x03, 0x04, 0x78, 0x04, 0x03,   // 'Y'
+  0x61, 0x59, 0x49, 0x4D, 0x43,   // 'Z'
+  0x00, 0x7F, 0x41, 0x41, 0x41,   // '['
+  0x02, 0x04, 0x08, 0x10, 0x20,   // '\\'
+  0x00, 0x41, 0x41, 0x41, 0x7F,   // ']'
+  0x04, 0x02, 0x01, 0x02, 0x04,   // '^'
+  0x40, 0x40, 0x40, 0x40, 0x40,   // '_'
+  0x00, 0x03, 0x07, 0x08, 0x00,   // '`'
+  0x20, 0x54, 0x54, 0x78, 0x40,   // 'a'
+  0x7F, 0x28, 0x44, 0x44, 0x38,   // 'b'
+  0x38, 0x44, 0x44, 0x44, 0x28,   // 'c'
+  0x38, 0x44, 0x44, 0x28, 0x7F,   // 'd'
+  0x38, 0x54, 0x54, 0x54, 0x18,   // 'e'
+  0x00, 0x08, 0x7E, 0x09, 0x02,   // 'f'
+  0x18, 0xA4, 0xA4, 0x9C, 0x78,   // 'g'
+  0x7F, 0x08, 0x04, 0x04, 0x78,   // 'h'
+  0x00, 0x44, 0x7D, 0x40, 0x00,   // 'i'
+  0x20, 0x40, 0x40, 0x3D, 0x00,   // 'j'
+  0x7F, 0x10, 0x28, 0x44, 0x00,   // 'k'
+  0x00, 0x41, 0x7F, 0x40, 0x00,   // 'l'
+  0x7C, 0x04, 0x78, 0x04, 0x78,   // 'm'
+  0x7C, 0x08, 0x04, 0x04, 0x78,   // 'n'
+  0x38, 0x44, 0x44, 0x44, 0x38,   // 'o'
+  0xFC, 0x18, 0x24, 0x24, 0x18,   // 'p'
+  0x18, 0x24, 0x24, 0x18, 0xFC,   // 'q'
+  0x7C, 0x08, 0x04, 0x04, 0x08,   // 'r'
+  0x48, 0x54, 0x54, 0x54, 0x24,   // 's'
+  0x04, 0x04, 0x3F, 0x44, 0x24,   // 't'
+  0x3C, 0x40, 0x40, 0x20, 0x7C,   // 'u'
+  0x1C, 0x20, 0x40, 0x20, 0x1C,   // 'v'
+  0x3C, 0x40, 0x30, 0x40, 0x3C,   // 'w'
+  0x44, 0x28, 0x10, 0x28, 0x44,   // 'x'
+  0x4C, 0x90, 0x90, 0x90, 0x7C,   // 'y'
+  0x44, 0x64, 0x54, 0x4C, 0x44,   // 'z'
+  0x00, 0x08, 0x36, 0x41, 0x00,   // '{'
+  0x00, 0x00, 0x77, 0x00, 0x00,   // '|'
+  0x00, 0x41, 0x36, 0x08, 0x00,   // '}'
+  0x02, 0x01, 0x02, 0x04, 0x02,   // '~'
+};
+
+class HostCanvas {
+ public:
+  HostCanvas() : cursorX_(0), cursorY_(0), textSize_(1), textColor_(1) { fillScreen(0); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= OLED_COLUMNS || y >= OLED_PAGES * 8) return;
+    uint8_t& b = buffer_[(y / 8) * OLED_COLUMNS + x];
+    if (color) b |= 1 << (y & 7);
+    else b &= ~(1 << (y & 7));
+  }
+
+  void fillScreen(uint16_t color) { memset(buffer_, color ? 0xff : 0x00, sizeof(buffer_)); }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t j = y; j < y + h; j++) {
+      for (int16_t i = x; i < x + w; i++) drawPixel(i, j, color);
+    }
+  }
+
+  // Bresenham
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int16_t dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int16_t sx = x0 < x1 ? 1 : -1;
+    int16_t sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy;
+    while (true) {
+      drawPixel(x0, y0, color);
+      if (x0 == x1 && y0 == y1) break;
+      int16_t e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+
+  void setCursor(int16_t x, int16_t y) {
+    cursorX_ = x;
+    cursorY_ = y;
+  }
+
+  void setTextSize(uint8_t s) { textSize_ = s ? s : 1; }
+  void setTextColor(uint16_t c) { textColor_ = c; }
+
+  void print(const char* s) {
+    for (; *s; s++) {
+      if (*s == '\n') {
+        cursorX_ = 0;
+        cursorY_ += 8 * textSize_;
+        continue;
+      }
+      drawChar(cursorX_, cursorY_, (uint8_t)*s);
+      cursorX_ += 6 * textSize_;
+    }
+  }
+
+  uint8_t* getBuffer() { return buffer_; }
+
+ private:
+  static uint8_t glyphColumn(uint8_t c, uint8_t col) {
+    if (c < HOST_FONT_FIRST || c > HOST_FONT_LAST) return 0;
+    return HOST_FONT[(c - HOST_FONT_FIRST) * 5 + col];
+  }
+
+  void drawChar(int16_t x, int16_t y, uint8_t c) {
+    for (uint8_t col = 0; col < 5; col++) {
+      uint8_t bits = glyphColumn(c, col);
+      for (uint8_t row = 0; row < 8; row++) {
+        if (!(bits & (1 << row))) continue;
+        if (textSize_ == 1) drawPixel(x + col, y + row, textColor_);
+        else fillRect(x + col * textSize_, y + row * textSize_, textSize_, textSize_, textColor_);
+      }
+    }
+  }
+
+  uint8_t buffer_[OLED_PAGES * OLED_COLUMNS];
+  int16_t cursorX_, cursorY_;
+  uint8_t textSize_;
+  uint16_t textColor_;
+};
@@ -0,0 +1,522 @@
+// Smart Plant Buddy - Linux backend
+//
+// Runs PlantCore off the device against a simulated plant:
+//
+//   clock     virtual milliseconds, moved on by advance(); micros() is the
+//             real monotonic clock so task run times are still measured
+//   ADC       adcResultHz() conversions per channel per simulated second
+//             from a SimSensors model (WaveformSensors by default)
+//   DHT       a conversion every SIM_DHT_READ_MS, encoded to edge
+//             timestamps and decoded by decodeDhtEdges() like the device
+//             does, with optional corrupted frames
+//   link/NTP  come up a fixed delay after they are started; an association
+//             can fail (never comes up, so the attempt times out) and a
+//             link that is up can drop, at random (LinuxHalConfig) or on
+//             demand (failAssociations(), dropLink())
+//   HTTP      HttpStandIn accepts the Firebase PATCHes in process, with an
+//             optional failure rate, or forwards them to an rtdb_server
+//             (LinuxHalConfig::rtdb) with real timings and no injected
+//             failures
+//   flash     the offline log goes to a plain directory (StdioStorage)
+//   heap      glibc's arena: bytes in use come out of a device-sized
+//             SIM_HEAP_BYTES, free chunks stranded below the top count
+//             as fragmentation; plant_sim counts malloc for HEAP_PROFILE
+//   UI        status changes are logged; live frames go to a WsServer
+//   console   log lines to stdout, binary log frames to a file or stdout
+//
+// Everything random comes from one seed, so a run is reproducible.
+
+#pragma once
+
+#include <malloc.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../Hal.h"
+#include "../PlantConfig.h"
+#include "../AdcDecimator.h"
+#include "RtdbClient.h"
+#include "WsServer.h"
+
+const unsigned long SIM_DHT_READ_MS = 2000;
+const unsigned long SIM_DHT_MAX_AGE_MS = 60000;
+const uint32_t SIM_ADC_RESULT_HZ = 100;          // per channel, as on the device
+const uint32_t SIM_ADC_BACKLOG_MAX = 256;        // frames the DMA buffer holds
+const unsigned long SIM_LINK_UP_MS = 1200;       // association
+const unsigned long SIM_NTP_MS = 300;            // first SNTP reply
+const long long SIM_EPOCH_MS = 1760000000000LL;  // wall clock at millis() = 0
+const unsigned long SIM_DAY_MS = 86400000;
+const uint32_t SIM_HEAP_BYTES = 300000;          // free after boot on a WiFi ESP32
+
+//  SENSOR MODEL
+
+// What the simulated sensors see. adc() is called once per conversion,
+// in time order; climate() once per DHT conversion.
+class SimSensors {
+ public:
+  virtual ~SimSensors() {}
+  virtual uint16_t adc(uint8_t channel, unsigned long ms) = 0;
+  virtual void climate(unsigned long ms, float& tempC, float& hum) = 0;
+};
+
+// Daily sines with ADC noise; enough to exercise the pipeline
+class WaveformSensors : public SimSensors {
+ public:
+  explicit WaveformSensors(uint32_t seed)
+    : soil_(2000, 250, (float)SIM_DAY_MS * SIM_ADC_RESULT_HZ / 1000, 40, seed),
+      light_(1800, 1700, (float)SIM_DAY_MS * SIM_ADC_RESULT_HZ / 1000, 25, seed * 7 + 1) {}
+
+  uint16_t adc(uint8_t channel, unsigned long) override {
+    return channel == ADC_SOIL ? soil_.next() : light_.next();
+  }
+
+  void climate(unsigned long ms, float& tempC, float& hum) override {
+    float phase = 6.2831853f * (float)(ms % SIM_DAY_MS) / SIM_DAY_MS;
+    tempC = 22 + 4 * sinf(phase);
+    hum = 55 - 12 * sinf(phase);
+  }
+
+ private:
+  WaveformSource soil_;
+  WaveformSource light_;
+};
+
+//  DHT FRAMES
+
+// Edge timestamps (us) and levels of one DHT11 or DHT22 answer, as the
+// edge ISR would capture them. Returns the edge count.
+inline uint8_t encodeDhtEdges(DhtType type, float tempC, float hum, uint32_t* times,
+                              uint8_t* levels) {
+  uint8_t data[5];
+  float t = fabsf(tempC);
+  if (type == DHT_TYPE_11) {
+    data[0] = (uint8_t)(hum + 0.5f);
+    data[1] = 0;
+    data[2] = (uint8_t)t;
+    data[3] = (uint8_t)((t - data[2]) * 10 + 0.5f);
+    if (data[3] > 9) data[3] = 9;
+    if (tempC < 0) data[3] |= 0x80;
+  } else {
+    // Tenths, big-endian; the top bit of the temperature is its sign
+    uint16_t h10 = (uint16_t)(hum * 10 + 0.5f);
+    uint16_t t10 = (uint16_t)(t * 10 + 0.5f);
+    data[0] = (uint8_t)(h10 >> 8);
+    data[1] = (uint8_t)h10;
+    data[2] = (uint8_t)(t10 >> 8 & 0x7f);
+    data[3] = (uint8_t)t10;
+    if (tempC < 0) data[2] |= 0x80;
+  }
+  data[4] = (uint8_t)(data[0] + data[1] + data[2] + data[3]);
+
+  uint32_t now = 0;
+  uint8_t n = 0;
+  // Response: 80 us low, 80 us high
+  times[n] = now; levels[n++] = 0; now += 80;
+  times[n] = now; levels[n++] = 1; now += 80;
+  // Each bit: 50 us low, then high for 27 us (0) or 70 us (1)
+  for (uint8_t i = 0; i < 40; i++) {
+    times[n] = now; levels[n++] = 0; now += 50;
+    times[n] = now; levels[n++] = 1;
+    now += (data[i / 8] & (0x80 >> (i % 8))) ? 70 : 27;
+  }
+  times[n] = now; levels[n++] = 0; now += 50;
+  times[n] = now; levels[n++] = 1;
+  return n;
+}
+
+//  HTTP
+
+// Answers the Firebase PATCHes in process, or passes them to a server,
+// and counts what arrived
+class HttpStandIn {
+ public:
+  HttpStandIn() : failRate_(0), connected_(false), remote_(nullptr), requests_(0), failures_(0),
+                  bytes_(0), records_(0), healthRecords_(0) {}
+
+  void setFailRate(float rate) { failRate_ = rate; }
+  void setRemote(RtdbClient* remote) { remote_ = remote; }
+
+  // roll is uniform in [0, 1)
+  int handle(const char* method, const char* path, const char* body, size_t len,
+             float roll, PostTiming& t) {
+    requests_++;
+    if (remote_) {
+      if (remote_->send(method, path, body, len, t) != 200) {
+        failures_++;
+        return t.code;
+      }
+      count(path, body, len);
+      return t.code;
+    }
+    t.reused = connected_;
+    t.dnsUs = connected_ ? 0 : 15000;
+    t.connectUs = connected_ ? 0 : 40000;
+    t.handshakeUs = connected_ ? 0 : 220000;
+    t.transferUs = 30000 + len * 8;
+    if (roll < failRate_) {
+      failures_++;
+      connected_ = false;
+      t.transferUs = 0;
+      return t.code = -1;   // HTTPC_ERROR_CONNECTION_REFUSED
+    }
+    connected_ = true;
+    if (strcmp(method, "PATCH") != 0) return t.code = 405;
+    count(path, body, len);
+    return t.code = 200;
+  }
+
+  void stop() {
+    connected_ = false;
+    if (remote_) remote_->stop();
+  }
+
+  unsigned long requests() const { return requests_; }
+  unsigned long failures() const { return failures_; }
+  unsigned long long bytes() const { return bytes_; }
+  unsigned long records() const { return records_; }
+  unsigned long healthRecords() const { return healthRecords_; }
+
+  // Objects directly under the top level, i.e. one per push ID
+  static unsigned long countRecords(const char* body, size_t len) {
+    unsigned long n = 0;
+    int depth = 0;
+    bool inString = false;
+    for (size_t i = 0; i < len; i++) {
+      char ch = body[i];
+      if (inString) {
+        if (ch == '\\') i++;
+        else if (ch == '"') inString = false;
+      } else if (ch == '"') {
+        inString = true;
+      } else if (ch == '{') {
+        if (++depth == 2) n++;
+      } else if (ch == '}') {
+        depth--;
+      }
+    }
+    return n;
+  }
+
+ private:
+  void count(const char* path, const char* body, size_t len) {
+    bytes_ += len;
+    if (strcmp(path, FIREBASE_HEALTH_PATH) == 0) healthRecords_ += countRecords(body, len);
+    else records_ += countRecords(body, len);
+  }
+
+  float failRate_;
+  bool connected_;
+  RtdbClient* remote_;
+  unsigned long requests_;
+  unsigned long failures_;
+  unsigned long long bytes_;
+  unsigned long records_;
+  unsigned long healthRecords_;
+};
+
+//  BACKEND
+
+struct LinuxHalConfig {
+  uint32_t seed;
+  float httpFailRate;        // share of uploads that fail
+  float dhtFailRate;         // share of DHT frames that arrive corrupted
+  const char* offlineLog;    // directory for the offline log, nullptr = no flash
+  bool quiet;                // drop log lines (status is still counted)
+  const char* binaryLog;     // file for binary log frames, nullptr = stdout
+  const char* rtdb;          // "host:port" of an rtdb_server, nullptr = in process
+  float assocFailRate;       // share of association attempts that never come up
+  unsigned long linkUpMeanMs;  // mean time a link stays up, 0 = never drops
+};
+
+class LinuxHal : public Hal {
+ public:
+  LinuxHal(const LinuxHalConfig& config, SimSensors& sensors)
+    : config_(config), sensors_(sensors), ws_(nullptr), nowMs_(0),
+      rng_(config.seed ? config.seed : 1), adcFrames_(0), adcOverruns_(0),
+      dhtNextMs_(1000), dhtHaveGood_(false), dhtLastOk_(false), dhtFresh_(false),
+      dhtTemp_(0), dhtHum_(0), dhtGoodAtMs_(0), dhtReads_(0), dhtFailures_(0),
+      connecting_(false), assocFails_(false), linkAtMs_(0), linkDownAtMs_(0), failNext_(0),
+      assocFailures_(0), linkDrops_(0), syncing_(false), syncAtMs_(0),
+      binaryLog_(nullptr), heapMinFree_(SIM_HEAP_BYTES), statusUpdates_(0), liveFrames_(0) {
+    http_.setFailRate(config.httpFailRate);
+    if (config.rtdb && rtdb_.begin(config.rtdb)) http_.setRemote(&rtdb_);
+    status_[0] = '\0';
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    startNs_ = (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+  }
+
+  ~LinuxHal() {
+    if (binaryLog_) fclose(binaryLog_);
+  }
+
+  // Move the virtual clock on
+  void advance(unsigned long ms) { nowMs_ += ms; }
+  void setWebSocket(WsServer* ws) { ws_ = ws; }
+  void setQuiet(bool quiet) { config_.quiet = quiet; }
+
+  const HttpStandIn& http() const { return http_; }
+  unsigned long adcOverruns() const { return adcOverruns_; }
+  unsigned long statusUpdates() const { return statusUpdates_; }
+  unsigned long liveFrames() const { return liveFrames_; }
+  unsigned long assocFailures() const { return assocFailures_; }
+  unsigned long linkDrops() const { return linkDrops_; }
+
+  // The next n association attempts fail, whatever assocFailRate says
+  void failAssociations(uint8_t n) { failNext_ = n; }
+
+  // Takes the link down now if it is up; it stays down until the next
+  // startConnect()
+  void dropLink() {
+    if (linkUp()) linkDownAtMs_ = nowMs_ ? nowMs_ : 1;
+  }
+
+  //  CLOCK, LOG & HEAP
+
+  unsigned long millis() override { return nowMs_; }
+
+  unsigned long micros() override {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    long long ns = (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec - startNs_;
+    return (unsigned long)(ns / 1000);
+  }
+
+  long long epochMillis() override { return timeValid() ? SIM_EPOCH_MS + nowMs_ : 0; }
+
+  // xorshift32
+  uint32_t random() override {
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return rng_;
+  }
+
+  void log(const char* line) override {
+    if (config_.quiet) return;
+    unsigned long s = nowMs_ / 1000;
+    printf("[%3lud %02lu:%02lu:%02lu.%03lu] %s\n", s / 86400, s / 3600 % 24, s / 60 % 60,
+           s % 60, nowMs_ % 1000, line);
+  }
+
+  void logFrame(const uint8_t* frame, size_t len) override {
+    if (config_.binaryLog && !binaryLog_) binaryLog_ = fopen(config_.binaryLog, "wb");
+    if (binaryLog_) fwrite(frame, 1, len, binaryLog_);
+    else if (!config_.quiet) fwrite(frame, 1, len, stdout);
+  }
+
+  size_t logRoom() override { return SIZE_MAX; }
+
+  void heapInfo(HeapInfo& out) override {
+    struct mallinfo2 m = mallinfo2();
+    out.freeBytes = m.uordblks < SIM_HEAP_BYTES ? SIM_HEAP_BYTES - (uint32_t)m.uordblks : 0;
+    uint32_t stranded = (uint32_t)(m.fordblks - m.keepcost);
+    out.largestFree = out.freeBytes > stranded ? out.freeBytes - stranded : 0;
+    if (out.freeBytes < heapMinFree_) heapMinFree_ = out.freeBytes;
+    out.minFree = heapMinFree_;
+#ifdef HEAP_PROFILE
+    out.counting = true;
+#else
+    out.counting = false;
+#endif
+  }
+
+  //  SENSORS
+
+  uint32_t adcResultHz() override { return SIM_ADC_RESULT_HZ; }
+
+  // Conversions due since the last call, one frame (soil, light) at a time
+  size_t readAdc(AdcSample* out, size_t max) override {
+    uint64_t due = (uint64_t)nowMs_ * SIM_ADC_RESULT_HZ / 1000;
+    if (due - adcFrames_ > SIM_ADC_BACKLOG_MAX) {
+      adcOverruns_ += due - adcFrames_ - SIM_ADC_BACKLOG_MAX;
+      adcFrames_ = due - SIM_ADC_BACKLOG_MAX;
+    }
+    size_t n = 0;
+    while (adcFrames_ < due && n + 2 <= max) {
+      unsigned long ms = (unsigned long)(adcFrames_ * 1000 / SIM_ADC_RESULT_HZ);
+      out[n].channel = ADC_SOIL;
+      out[n++].raw = sensors_.adc(ADC_SOIL, ms);
+      out[n].channel = ADC_LIGHT;
+      out[n++].raw = sensors_.adc(ADC_LIGHT, ms);
+      adcFrames_++;
+    }
+    return n;
+  }
+
+  void pollClimate() override {
+    if ((long)(nowMs_ - dhtNextMs_) < 0) return;
+    dhtNextMs_ = nowMs_ + SIM_DHT_READ_MS;
+    dhtReads_++;
+
+    float t, h;
+    sensors_.climate(nowMs_, t, h);
+    uint32_t times[DHT_MAX_EDGES];
+    uint8_t levels[DHT_MAX_EDGES];
+    uint8_t n = encodeDhtEdges(DHT_TYPE_11, t, h, times, levels);
+    if (uniform() < config_.dhtFailRate) {
+      // Either a stretched pulse flips a bit or the ISR misses the tail
+      if (random() & 1) {
+        uint8_t k = 4 + 2 * (random() % 40);   // falling edge ending a bit
+        if (times[k] - times[k - 1] > 48) times[k] -= 45;
+        else times[k] += 45;
+      } else {
+        n = 60;
+      }
+    }
+    dhtLastOk_ = decodeDhtEdges(times, levels, n, DHT_TYPE_11, t, h);
+    if (!dhtLastOk_) {
+      dhtFailures_++;
+      return;
+    }
+    dhtTemp_ = t;
+    dhtHum_ = h;
+    dhtGoodAtMs_ = nowMs_;
+    dhtHaveGood_ = true;
+    dhtFresh_ = true;
+  }
+
+  bool takeFreshClimate() override {
+    bool f = dhtFresh_;
+    dhtFresh_ = false;
+    return f;
+  }
+
+  DhtSample climate() override {
+    DhtSample s;
+    s.tempC = dhtTemp_;
+    s.hum = dhtHum_;
+    s.ageMs = dhtHaveGood_ ? nowMs_ - dhtGoodAtMs_ : 0;
+    if (!dhtHaveGood_) s.quality = DHT_NO_DATA;
+    else if (s.ageMs > SIM_DHT_MAX_AGE_MS) s.quality = DHT_EXPIRED;
+    else s.quality = dhtLastOk_ ? DHT_FRESH : DHT_CACHED;
+    return s;
+  }
+
+  unsigned long climateReads() override { return dhtReads_; }
+  unsigned long climateFailures() override { return dhtFailures_; }
+
+  //  LINK
+
+  bool linkUp() override {
+    if (!connecting_ || assocFails_ || (long)(nowMs_ - linkAtMs_) < 0) return false;
+    if (linkDownAtMs_ && (long)(nowMs_ - linkDownAtMs_) >= 0) {
+      linkDrops_++;
+      connecting_ = false;
+      return false;
+    }
+    return true;
+  }
+
+  void startConnect() override {
+    connecting_ = true;
+    linkAtMs_ = nowMs_ + SIM_LINK_UP_MS;
+    linkDownAtMs_ = 0;
+    // Random draws only when asked for, so other runs keep their sequence
+    if (failNext_) {
+      failNext_--;
+      assocFails_ = true;
+    } else {
+      assocFails_ = config_.assocFailRate > 0 && uniform() < config_.assocFailRate;
+    }
+    if (assocFails_) {
+      assocFailures_++;
+    } else if (config_.linkUpMeanMs) {
+      // Exponential time to the drop, at least a second up
+      float up = -logf(1.0f - uniform()) * config_.linkUpMeanMs;
+      linkDownAtMs_ = linkAtMs_ + 1000 + (unsigned long)up;
+      if (linkDownAtMs_ == 0) linkDownAtMs_ = 1;
+    }
+  }
+
+  void startTimeSync() override {
+    if (syncing_) return;
+    syncing_ = true;
+    syncAtMs_ = nowMs_ + SIM_NTP_MS;
+  }
+
+  bool timeValid() override { return syncing_ && (long)(nowMs_ - syncAtMs_) >= 0; }
+
+  void linkChanged(ConnState, ConnState to) override {
+    if (to == CONN_CONNECTED) log("Connected! IP: 127.0.0.1");
+  }
+
+  //  UPLOAD
+
+  int httpSend(const char* method, const char* path, const char* body, size_t len,
+               PostTiming& t) override {
+    return http_.handle(method, path, body, len, uniform(), t);
+  }
+
+  void httpStop() override { http_.stop(); }
+
+  LogStorage* openLogStorage() override {
+    if (!config_.offlineLog || !offlineDir_.open(config_.offlineLog)) return nullptr;
+    return &offlineDir_;
+  }
+
+  //  UI
+
+  // Stands in for the OLED: logs the screen's fields when they change
+  bool showStatus(const Reading& r, Mood mood) override {
+    char line[sizeof(status_)];
+    snprintf(line, sizeof(line), "Soil %d  %.1fC  %.0f%%  %s %s",
+             r.soil, r.tempC, r.hum, moodFace(mood), moodText(mood));
+    if (strcmp(line, status_) == 0) return true;
+    memcpy(status_, line, sizeof(line));
+    statusUpdates_++;
+    char msg[sizeof(status_) + 8];
+    snprintf(msg, sizeof(msg), "OLED: %s", status_);
+    log(msg);
+    return true;
+  }
+
+  void liveSend(uint8_t client, const uint8_t* data, size_t len, bool binary) override {
+    liveFrames_++;
+    if (ws_) ws_->send(client, data, len, binary);
+  }
+
+ private:
+  float uniform() { return (random() >> 8) * (1.0f / 16777216.0f); }
+
+  LinuxHalConfig config_;
+  SimSensors& sensors_;
+  WsServer* ws_;
+  HttpStandIn http_;
+  RtdbClient rtdb_;
+  StdioStorage offlineDir_;
+  unsigned long nowMs_;
+  long long startNs_;
+  uint32_t rng_;
+
+  uint64_t adcFrames_;
+  unsigned long adcOverruns_;
+
+  unsigned long dhtNextMs_;
+  bool dhtHaveGood_;
+  bool dhtLastOk_;
+  bool dhtFresh_;
+  float dhtTemp_;
+  float dhtHum_;
+  unsigned long dhtGoodAtMs_;
+  unsigned long dhtReads_;
+  unsigned long dhtFailures_;
+
+  bool connecting_;            // associating or associated
+  bool assocFails_;            // this attempt never comes up
+  unsigned long linkAtMs_;
+  unsigned long linkDownAtMs_;  // 0 = stays up
+  uint8_t failNext_;
+  unsigned long assocFailures_;
+  unsigned long linkDrops_;
+  bool syncing_;
+  unsigned long syncAtMs_;
+
+  FILE* binaryLog_;
+  uint32_t heapMinFree_;
+
+  char status_[64];
+  unsigned long statusUpdates_;
+  unsigned long liveFrames_;
+};
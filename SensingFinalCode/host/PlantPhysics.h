@@ -0,0 +1,187 @@
+// Smart Plant Buddy - simulated plant for host builds
+//
+// A potted plant on a windowsill, integrated in PHYSICS_STEP_MS steps of
+// simulated time and sampled by LinuxHal's ADC and DHT models:
+//
+//   light   hour-of-day profile scaled by a random factor per day (cloud)
+//   temp    daily cosine plus a slowly wandering daily offset
+//   hum     the room's vapour pressure (wandering daily, raised while the
+//           pot is wet) over the saturation pressure at the current temp
+//   soil    raw falls as the pot dries, faster the drier it is and in the
+//           light; a caretaker waters it some hours after it drops below
+//           soilWaterAt, occasionally a day late
+//
+// The constants come from the RTDB export (fit_physics.py writes them to
+// PlantPhysicsFit.h). Raw soil follows the firmware: higher = wetter, so
+// the mood table reads it as the device would (the export's sensor reads
+// the other way; fit_physics.py flips it).
+// Deterministic for a given seed and start time.
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include "LinuxHal.h"
+
+struct PhysicsParams {
+  float lightByHour[24];   // mean light_raw per hour of day
+  float lightDayStd;       // day-to-day spread of light, relative
+  float tempMean;          // C
+  float tempAmp;
+  float tempPeakHour;
+  float tempDayStd;
+  float vapourMean;        // hPa
+  float vapourDayStd;
+  float soilWet;           // raw just after watering
+  float soilWaterAt;       // caretaker waters once raw drops below this
+  float dryRate0;          // counts/h at soilWet
+  float dryGain;           // extra counts/h per count below soilWet
+};
+
+const unsigned long PHYSICS_STEP_MS = 60000;
+const unsigned long PHYSICS_HOUR_MS = 3600000;
+// Not resolvable from the export; typical indoor values
+const float SOIL_LIGHT_GAIN = 0.5f;      // drying rate swing with light, relative
+const float VAPOUR_WET_HPA = 0.8f;       // extra vapour pressure from a wet pot
+const float WATER_DELAY_MAX_H = 18;      // caretaker reacts within this
+const float WATER_LATE_CHANCE = 0.15f;   // ...or is a day late
+const float WATER_SPREAD = 80;           // raw spread of a watering
+const uint16_t SOIL_ADC_NOISE = 12;
+const uint16_t LIGHT_ADC_NOISE = 20;
+
+class PlantPhysics : public SimSensors {
+ public:
+  PlantPhysics(const PhysicsParams& p, uint32_t seed, long long epochMs)
+    : p_(p), rng_(seed ? seed : 1), epochMs_(epochMs), stepMs_(0), day_(-1),
+      lightFactor_(1), waterDueMs_(NONE), waterings_(0) {
+    lightPeak_ = 1;
+    float sum = 0;
+    for (uint8_t h = 0; h < 24; h++) {
+      if (p_.lightByHour[h] > lightPeak_) lightPeak_ = p_.lightByHour[h];
+      sum += p_.lightByHour[h];
+    }
+    lightMeanFrac_ = sum / 24 / lightPeak_;
+    tempOffset_[0] = tempOffset_[1] = gaussian() * p_.tempDayStd;
+    vapourOffset_[0] = vapourOffset_[1] = gaussian() * p_.vapourDayStd;
+    soil_ = p_.soilWet + uniform() * (p_.soilWaterAt - p_.soilWet);
+    step();
+  }
+
+  uint16_t adc(uint8_t channel, unsigned long ms) override {
+    advanceTo(ms);
+    float v = channel == ADC_SOIL ? soil_ + noise(SOIL_ADC_NOISE) : light_ + noise(LIGHT_ADC_NOISE);
+    if (v < 0) v = 0;
+    if (v > 4095) v = 4095;
+    return (uint16_t)v;
+  }
+
+  void climate(unsigned long ms, float& tempC, float& hum) override {
+    advanceTo(ms);
+    tempC = temp_;
+    hum = hum_;
+  }
+
+  float soil() const { return soil_; }
+  float light() const { return light_; }
+  unsigned long waterings() const { return waterings_; }
+
+ private:
+  static const unsigned long NONE = 0xffffffff;
+
+  void advanceTo(unsigned long ms) {
+    while ((long)(ms - stepMs_) >= (long)PHYSICS_STEP_MS) {
+      stepMs_ += PHYSICS_STEP_MS;
+      step();
+    }
+  }
+
+  void step() {
+    long long wall = epochMs_ + stepMs_;
+    long day = (long)(wall / 86400000LL);
+    float hour = (float)(wall % 86400000LL) / PHYSICS_HOUR_MS;
+    if (day != day_) newDay(day);
+    float dayFrac = hour / 24;
+
+    // Light: profile between hour centres, times today's sky
+    uint8_t h0 = (uint8_t)hour;
+    float f = hour - h0;
+    float profile = p_.lightByHour[h0] * (1 - f) + p_.lightByHour[(h0 + 1) % 24] * f;
+    light_ = profile * lightFactor_;
+    if (light_ > 4095) light_ = 4095;
+
+    // Offsets drift from yesterday's to today's over the day
+    temp_ = p_.tempMean + p_.tempAmp * cosf(6.2831853f * (hour - p_.tempPeakHour) / 24) +
+            tempOffset_[0] + (tempOffset_[1] - tempOffset_[0]) * dayFrac;
+
+    // Drying, then the caretaker
+    float rate = (p_.dryRate0 + p_.dryGain * (p_.soilWet - soil_)) *
+                 (1 + SOIL_LIGHT_GAIN * (light_ / lightPeak_ - lightMeanFrac_));
+    if (rate > 0) soil_ -= rate * PHYSICS_STEP_MS / PHYSICS_HOUR_MS;
+    if (soil_ < 0) soil_ = 0;
+    if (waterDueMs_ == NONE && soil_ < p_.soilWaterAt) {
+      float delayH = uniform() * WATER_DELAY_MAX_H;
+      if (uniform() < WATER_LATE_CHANCE) delayH += 24;
+      waterDueMs_ = stepMs_ + (unsigned long)(delayH * PHYSICS_HOUR_MS);
+    }
+    if (waterDueMs_ != NONE && (long)(stepMs_ - waterDueMs_) >= 0) {
+      soil_ = p_.soilWet + gaussian() * WATER_SPREAD;
+      waterDueMs_ = NONE;
+      waterings_++;
+    }
+
+    // A wet pot raises the room's vapour pressure a little
+    float wet = (soil_ - p_.soilWaterAt) / (p_.soilWet - p_.soilWaterAt);
+    if (wet < 0) wet = 0;
+    if (wet > 1) wet = 1;
+    float vapour = p_.vapourMean + vapourOffset_[0] +
+                   (vapourOffset_[1] - vapourOffset_[0]) * dayFrac + VAPOUR_WET_HPA * wet;
+    float saturation = 6.112f * expf(17.62f * temp_ / (243.12f + temp_));   // Magnus
+    hum_ = 100 * vapour / saturation;
+    if (hum_ < 5) hum_ = 5;
+    if (hum_ > 95) hum_ = 95;
+  }
+
+  void newDay(long day) {
+    day_ = day;
+    lightFactor_ = 1 + gaussian() * p_.lightDayStd;
+    if (lightFactor_ < 0.2f) lightFactor_ = 0.2f;
+    tempOffset_[0] = tempOffset_[1];
+    tempOffset_[1] = gaussian() * p_.tempDayStd;
+    vapourOffset_[0] = vapourOffset_[1];
+    vapourOffset_[1] = gaussian() * p_.vapourDayStd;
+  }
+
+  // xorshift32
+  uint32_t next() {
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 17;
+    rng_ ^= rng_ << 5;
+    return rng_;
+  }
+
+  float uniform() { return (next() >> 8) * (1.0f / 16777216.0f); }
+
+  // Irwin-Hall, close enough to normal for this
+  float gaussian() { return (uniform() + uniform() + uniform() + uniform() - 2) * 1.7320508f; }
+
+  float noise(uint16_t amplitude) { return (float)((int32_t)(next() % (2 * amplitude + 1)) - amplitude); }
+
+  PhysicsParams p_;
+  uint32_t rng_;
+  long long epochMs_;
+  unsigned long stepMs_;
+  long day_;
+  float lightPeak_;
+  float lightMeanFrac_;
+
+  float lightFactor_;
+  float tempOffset_[2];     // yesterday, today
+  float vapourOffset_[2];
+  unsigned long waterDueMs_;
+  unsigned long waterings_;
+
+  float light_;
+  float temp_;
+  float hum_;
+  float soil_;
+};
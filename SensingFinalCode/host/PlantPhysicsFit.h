@@ -0,0 +1,14 @@
+// Generated by fit_physics.py from 734 logged readings - do not edit.
+
+#pragma once
+
+#include "PlantPhysics.h"
+
+const PhysicsParams FITTED_PHYSICS = {
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 9.0f, 477.9f, 1345.0f, 1729.0f, 1485.0f, 1221.0f, 1080.0f, 894.2f, 833.1f, 889.2f, 874.5f, 1163.0f, 1309.0f, 1243.0f, 1206.0f, 290.8f, 0.0f},
+  0.3366f,   // lightDayStd
+  22.86f, 0.2697f, 17.24f, 0.3368f,   // temp mean, amp, peak hour, day std
+  10.2f, 0.6584f,   // vapour mean, day std (hPa)
+  1102.0f, 798.0f,   // soil after watering, watered below
+  8.994f, 0.04025f   // drying r0 (counts/h), gain (1/h)
+};
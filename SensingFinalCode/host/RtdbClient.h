@@ -0,0 +1,165 @@
+// Smart Plant Buddy - blocking REST client for rtdb_server
+//
+// What FirebaseClient does on the device, over a plain socket: one
+// keep-alive connection, reopened (and the request retried once) when a
+// reused socket turns out to be closed, with DNS, connect and transfer
+// times filled into PostTiming. handshakeUs stays 0, there is no TLS.
+
+#pragma once
+
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include "../Hal.h"
+
+const int RTDB_CLIENT_TIMEOUT_S = 10;
+
+class RtdbClient {
+ public:
+  RtdbClient() : fd_(-1), port_(0), requests_(0), reconnects_(0) { host_[0] = '\0'; }
+  ~RtdbClient() { stop(); }
+
+  // hostPort like "localhost:9000"
+  bool begin(const char* hostPort) {
+    const char* colon = strrchr(hostPort, ':');
+    size_t n = colon ? (size_t)(colon - hostPort) : strlen(hostPort);
+    if (n == 0 || n >= sizeof(host_)) return false;
+    memcpy(host_, hostPort, n);
+    host_[n] = '\0';
+    port_ = colon ? atoi(colon + 1) : 80;
+    return port_ > 0;
+  }
+
+  int send(const char* method, const char* path, const char* json, size_t len, PostTiming& t) {
+    memset(&t, 0, sizeof(t));
+    t.code = request(method, path, json, len, t);
+    if (t.code < 0 && t.reused) {
+      // Server closed the idle connection; start over once
+      reconnects_++;
+      stop();
+      t.code = request(method, path, json, len, t);
+    }
+    requests_++;
+    return t.code;
+  }
+
+  void stop() {
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+  }
+
+  unsigned long requests() const { return requests_; }
+  unsigned long reconnects() const { return reconnects_; }
+
+ private:
+  static unsigned long nowUs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+  }
+
+  bool connect(PostTiming& t) {
+    unsigned long start = nowUs();
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* res = nullptr;
+    char port[8];
+    snprintf(port, sizeof(port), "%d", port_);
+    if (getaddrinfo(host_, port, &hints, &res) != 0 || !res) return false;
+    t.dnsUs = nowUs() - start;
+
+    start = nowUs();
+    fd_ = socket(res->ai_family, SOCK_STREAM, 0);
+    bool ok = fd_ >= 0 && ::connect(fd_, res->ai_addr, res->ai_addrlen) == 0;
+    freeaddrinfo(res);
+    if (!ok) {
+      stop();
+      return false;
+    }
+    int one = 1;
+    setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    timeval tv = {RTDB_CLIENT_TIMEOUT_S, 0};
+    setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    t.connectUs = nowUs() - start;
+    return true;
+  }
+
+  bool sendAll(const char* p, size_t n) {
+    while (n > 0) {
+      ssize_t sent = ::send(fd_, p, n, MSG_NOSIGNAL);
+      if (sent <= 0) return false;
+      p += sent;
+      n -= sent;
+    }
+    return true;
+  }
+
+  int request(const char* method, const char* path, const char* json, size_t len, PostTiming& t) {
+    t.reused = fd_ >= 0;
+    if (!t.reused && !connect(t)) return -1;   // HTTPC_ERROR_CONNECTION_REFUSED
+
+    unsigned long start = nowUs();
+    char head[512];
+    int n = snprintf(head, sizeof(head),
+                     "%s %s HTTP/1.1\r\nHost: %s\r\nContent-Type: application/json\r\n"
+                     "Content-Length: %zu\r\n\r\n", method, path, host_, len);
+    if (n <= 0 || (size_t)n >= sizeof(head) || !sendAll(head, n) || !sendAll(json, len)) {
+      stop();
+      return -3;   // HTTPC_ERROR_SEND_PAYLOAD_FAILED
+    }
+    int code = readResponse();
+    if (code < 0) stop();
+    t.transferUs = nowUs() - start;
+    return code;
+  }
+
+  // Status code of the response, body read and discarded
+  int readResponse() {
+    std::string rx;
+    char buf[4096];
+    size_t headEnd;
+    while ((headEnd = rx.find("\r\n\r\n")) == std::string::npos) {
+      ssize_t got = recv(fd_, buf, sizeof(buf), 0);
+      if (got <= 0) return -4;   // HTTPC_ERROR_NOT_CONNECTED
+      rx.append(buf, got);
+    }
+    int code = 0;
+    if (sscanf(rx.c_str(), "HTTP/1.%*d %d", &code) != 1) return -7;   // HTTPC_ERROR_NO_HTTP_SERVER
+    size_t length = 0;
+    bool close = false;
+    for (size_t at = rx.find("\r\n") + 2; at < headEnd;) {
+      size_t end = rx.find("\r\n", at);
+      const char* h = rx.c_str() + at;
+      if (strncasecmp(h, "Content-Length:", 15) == 0) length = strtoul(h + 15, nullptr, 10);
+      else if (strncasecmp(h, "Connection: close", 17) == 0) close = true;
+      at = end + 2;
+    }
+    size_t have = rx.size() - headEnd - 4;
+    while (have < length) {
+      ssize_t got = recv(fd_, buf, sizeof(buf), 0);
+      if (got <= 0) return -4;
+      have += got;
+    }
+    if (close) stop();
+    return code;
+  }
+
+  int fd_;
+  char host_[128];
+  int port_;
+  unsigned long requests_;
+  unsigned long reconnects_;
+};
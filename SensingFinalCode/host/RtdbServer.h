@@ -0,0 +1,762 @@
+// Smart Plant Buddy - local Realtime Database REST server
+//
+// Enough of the Firebase RTDB REST API for the firmware and the dashboard
+// to run against a local process: GET / PUT / POST / PATCH / DELETE on
+// ".json" paths, the orderBy / startAt / endAt / equalTo / limitToFirst /
+// limitToLast / shallow / print=silent parameters, and server-sent event
+// streams (Accept: text/event-stream) with put, patch and keep-alive
+// events. Auth parameters are accepted and ignored.
+//
+// One thread, one epoll set, non-blocking sockets with HTTP/1.1
+// keep-alive and pipelining; responses are queued per connection and
+// sent as the socket takes them. Data lives in an RtdbTree. With a log
+// file every write is appended to it as "PUT|PATCH <tab> path <tab> json"
+// (a POST is logged as the PUT of its new child) and flushed once per
+// poll() pass; begin() replays the file, so a restarted server comes back
+// with the same data.
+//
+// GET /.stats.json is not part of Firebase: request counts, open
+// connections and the server's own CPU time, for load tests.
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "../FirebaseBatch.h"
+#include "RtdbTree.h"
+
+const size_t RTDB_HEADER_MAX = 16384;
+const size_t RTDB_BODY_MAX = 16u << 20;
+const size_t RTDB_STREAM_BACKLOG_MAX = 8u << 20;   // unsent event bytes before a listener is dropped
+const size_t RTDB_READ_CHUNK = 65536;
+const unsigned long RTDB_KEEPALIVE_MS = 30000;
+const int RTDB_EPOLL_EVENTS = 256;
+
+struct RtdbStats {
+  unsigned long long accepted;
+  unsigned long long requests;
+  unsigned long long reads;      // GET
+  unsigned long long writes;     // PUT, POST, PATCH, DELETE
+  unsigned long long errors;     // 4xx / 5xx answers
+  unsigned long long events;     // stream events sent
+  unsigned long long bytesIn;
+  unsigned long long bytesOut;
+};
+
+inline unsigned long long rtdbMonotonicMs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+}
+
+inline long long rtdbEpochMs() {
+  timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000;
+}
+
+// xorshift32 for the push IDs, seeded by begin()
+inline uint32_t& rtdbRandomState() {
+  static uint32_t state = 1;
+  return state;
+}
+
+inline uint32_t rtdbRandom() {
+  uint32_t& x = rtdbRandomState();
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+// %XX and '+' decoding for paths and query values
+inline std::string rtdbUrlDecode(const char* s, size_t n, bool plusIsSpace) {
+  std::string out;
+  out.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    if (s[i] == '%' && i + 2 < n && isxdigit((unsigned char)s[i + 1]) &&
+        isxdigit((unsigned char)s[i + 2])) {
+      char hex[3] = {s[i + 1], s[i + 2], '\0'};
+      out += (char)strtoul(hex, nullptr, 16);
+      i += 2;
+    } else if (s[i] == '+' && plusIsSpace) {
+      out += ' ';
+    } else {
+      out += s[i];
+    }
+  }
+  return out;
+}
+
+class RtdbServer {
+ public:
+  RtdbServer() : listenFd_(-1), epollFd_(-1), log_(nullptr), logDirty_(false), replayed_(0),
+                 skipped_(0), lastKeepAliveMs_(0), pushIds_(rtdbRandom) {
+    memset(&stats_, 0, sizeof(stats_));
+  }
+
+  ~RtdbServer() { end(); }
+
+  // Replays logPath (if given) and starts listening
+  bool begin(uint16_t port, const char* logPath) {
+    rtdbRandomState() = (uint32_t)rtdbEpochMs() | 1;
+    if (logPath && !openLog(logPath)) return false;
+
+    listenFd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (listenFd_ < 0) return false;
+    int one = 1;
+    setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(listenFd_, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd_, SOMAXCONN) != 0) {
+      end();
+      return false;
+    }
+    epollFd_ = epoll_create1(0);
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = listenFd_;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, listenFd_, &ev);
+    lastKeepAliveMs_ = rtdbMonotonicMs();
+    return true;
+  }
+
+  void end() {
+    for (size_t fd = 0; fd < conns_.size(); fd++) {
+      if (conns_[fd]) drop((int)fd);
+    }
+    if (epollFd_ >= 0) ::close(epollFd_);
+    if (listenFd_ >= 0) ::close(listenFd_);
+    if (log_) fclose(log_);
+    epollFd_ = listenFd_ = -1;
+    log_ = nullptr;
+  }
+
+  // Accept, read, answer and write; waits up to timeoutMs for activity
+  void poll(int timeoutMs) {
+    if (epollFd_ < 0) return;
+    epoll_event events[RTDB_EPOLL_EVENTS];
+    int n = epoll_wait(epollFd_, events, RTDB_EPOLL_EVENTS, timeoutMs);
+    for (int i = 0; i < n; i++) {
+      int fd = events[i].data.fd;
+      if (fd == listenFd_) {
+        accept();
+        continue;
+      }
+      if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) receive(fd);
+      if (fd < (int)conns_.size() && conns_[fd] && (events[i].events & EPOLLOUT)) flush(fd);
+    }
+    if (logDirty_) {
+      fflush(log_);
+      logDirty_ = false;
+    }
+    unsigned long long now = rtdbMonotonicMs();
+    if (now - lastKeepAliveMs_ >= RTDB_KEEPALIVE_MS) {
+      lastKeepAliveMs_ = now;
+      for (int fd : streams_) sendEvent(fd, "keep-alive", nullptr, "null");
+      flushStreams();
+    }
+  }
+
+  const RtdbTree& tree() const { return tree_; }
+  const RtdbStats& stats() const { return stats_; }
+  size_t streams() const { return streams_.size(); }
+  unsigned long replayed() const { return replayed_; }
+  unsigned long skipped() const { return skipped_; }   // unreadable log lines
+
+  size_t connections() const {
+    size_t n = 0;
+    for (const Conn* c : conns_) n += c != nullptr;
+    return n;
+  }
+
+ private:
+  struct Conn {
+    std::string in;
+    std::string out;
+    size_t outSent;
+    bool closeAfter;      // close once out is sent
+    bool writeArmed;      // EPOLLOUT is on
+    bool stream;
+    RtdbPath streamPath;
+    RtdbQuery streamQuery;
+  };
+
+  struct Request {
+    std::string method;
+    std::string target;
+    bool http10;
+    bool keepAlive;
+    bool wantsStream;
+    size_t contentLength;
+  };
+
+  //  LOG
+
+  bool openLog(const char* path) {
+    bool torn = false;
+    FILE* in = fopen(path, "r");
+    if (in) {
+      std::string line;
+      char buf[RTDB_READ_CHUNK];
+      while (fgets(buf, sizeof(buf), in)) {
+        line += buf;
+        if (line.back() != '\n' && !feof(in)) continue;
+        torn = line.back() != '\n';
+        replay(line);
+        line.clear();
+      }
+      fclose(in);
+    }
+    log_ = fopen(path, "a");
+    if (log_ && torn) fputc('\n', log_);   // don't glue the next write onto it
+    return log_ != nullptr;
+  }
+
+  void replay(const std::string& line) {
+    size_t tab1 = line.find('\t');
+    size_t tab2 = tab1 == std::string::npos ? tab1 : line.find('\t', tab1 + 1);
+    size_t end = line.size();
+    while (end > 0 && (line[end - 1] == '\n' || line[end - 1] == '\r')) end--;
+    if (tab2 == std::string::npos || tab2 >= end) {
+      skipped_++;
+      return;
+    }
+    bool patch = line.compare(0, tab1, "PATCH") == 0;
+    RtdbPath path;
+    rtdbSplitPath(line.substr(tab1 + 1, tab2 - tab1 - 1), path);
+    RtdbNode value;
+    if (!RtdbParser(line.data() + tab2 + 1, end - tab2 - 1).parse(value, patch)) {
+      skipped_++;   // a torn last line after a crash
+      return;
+    }
+    if (patch) tree_.update(path, std::move(value));
+    else tree_.set(path, std::move(value));
+    replayed_++;
+  }
+
+  void logWrite(const char* method, const RtdbPath& path, const std::string& json) {
+    if (!log_) return;
+    std::string p = rtdbPathString(path);
+    fprintf(log_, "%s\t%s\t%s\n", method, p.c_str(), json.c_str());
+    logDirty_ = true;
+  }
+
+  //  CONNECTIONS
+
+  void accept() {
+    while (true) {
+      int fd = accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK);
+      if (fd < 0) return;   // EAGAIN, or out of descriptors until something closes
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      if ((size_t)fd >= conns_.size()) conns_.resize(fd + 1, nullptr);
+      Conn* c = new Conn();
+      c->outSent = 0;
+      c->closeAfter = c->writeArmed = c->stream = false;
+      conns_[fd] = c;
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      ev.data.fd = fd;
+      epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev);
+      stats_.accepted++;
+    }
+  }
+
+  void drop(int fd) {
+    Conn* c = conns_[fd];
+    if (c->stream) {
+      for (size_t i = 0; i < streams_.size(); i++) {
+        if (streams_[i] == fd) {
+          streams_[i] = streams_.back();
+          streams_.pop_back();
+          break;
+        }
+      }
+    }
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    delete c;
+    conns_[fd] = nullptr;
+  }
+
+  void receive(int fd) {
+    Conn* c = conns_[fd];
+    char buf[RTDB_READ_CHUNK];
+    ssize_t got = recv(fd, buf, sizeof(buf), 0);
+    if (got <= 0) {
+      if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return;
+      drop(fd);
+      return;
+    }
+    stats_.bytesIn += got;
+    if (c->stream) return;   // listeners have nothing more to say
+    c->in.append(buf, got);
+
+    size_t used = 0;
+    while (!c->closeAfter && !c->stream) {
+      size_t n = handleOne(fd, *c, used);
+      if (n == 0) break;
+      used += n;
+    }
+    c->in.erase(0, used);
+    flush(fd);
+  }
+
+  // Sends what the socket takes; arms EPOLLOUT for the rest
+  void flush(int fd) {
+    Conn* c = conns_[fd];
+    while (c->outSent < c->out.size()) {
+      ssize_t n = ::send(fd, c->out.data() + c->outSent, c->out.size() - c->outSent, MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        drop(fd);
+        return;
+      }
+      c->outSent += n;
+      stats_.bytesOut += n;
+    }
+    if (c->outSent == c->out.size()) {
+      c->out.clear();
+      c->outSent = 0;
+      if (c->closeAfter) {
+        drop(fd);
+        return;
+      }
+    } else if (c->outSent > RTDB_READ_CHUNK) {
+      c->out.erase(0, c->outSent);
+      c->outSent = 0;
+    }
+    bool wantWrite = !c->out.empty();
+    if (wantWrite != c->writeArmed) {
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = wantWrite ? EPOLLIN | EPOLLOUT : EPOLLIN;
+      ev.data.fd = fd;
+      epoll_ctl(epollFd_, EPOLL_CTL_MOD, fd, &ev);
+      c->writeArmed = wantWrite;
+    }
+  }
+
+  //  HTTP
+
+  // Parses and answers the request at in[at]; returns the bytes it took,
+  // 0 if it isn't all there yet
+  size_t handleOne(int fd, Conn& c, size_t at) {
+    size_t headEnd = c.in.find("\r\n\r\n", at);
+    if (headEnd == std::string::npos) {
+      if (c.in.size() - at > RTDB_HEADER_MAX) fatal(c, 431, "Request header too large");
+      return 0;
+    }
+    Request r;
+    if (!parseHead(c.in.data() + at, headEnd - at, r)) {
+      fatal(c, 400, "Malformed request");
+      return 0;
+    }
+    if (r.contentLength > RTDB_BODY_MAX) {
+      fatal(c, 413, "Request too large");
+      return 0;
+    }
+    size_t bodyAt = headEnd + 4;
+    if (c.in.size() - bodyAt < r.contentLength) return 0;
+    c.closeAfter = !r.keepAlive;
+    stats_.requests++;
+    handle(fd, c, r, c.in.data() + bodyAt, r.contentLength);
+    return bodyAt + r.contentLength - at;
+  }
+
+  static bool parseHead(const char* p, size_t n, Request& r) {
+    std::string head(p, n);
+    size_t lineEnd = head.find("\r\n");
+    std::string line = head.substr(0, lineEnd);
+    size_t sp1 = line.find(' ');
+    size_t sp2 = sp1 == std::string::npos ? sp1 : line.find(' ', sp1 + 1);
+    if (sp2 == std::string::npos) return false;
+    r.method = line.substr(0, sp1);
+    r.target = line.substr(sp1 + 1, sp2 - sp1 - 1);
+    r.http10 = line.compare(sp2 + 1, std::string::npos, "HTTP/1.0") == 0;
+    r.keepAlive = !r.http10;
+    r.wantsStream = false;
+    r.contentLength = 0;
+
+    size_t at = lineEnd == std::string::npos ? head.size() : lineEnd + 2;
+    while (at < head.size()) {
+      size_t end = head.find("\r\n", at);
+      if (end == std::string::npos) end = head.size();
+      const char* h = head.c_str() + at;
+      const char* colon = (const char*)memchr(h, ':', end - at);
+      if (colon) {
+        size_t nameLen = colon - h;
+        std::string value = head.substr(colon + 1 - head.c_str(), end - (colon + 1 - head.c_str()));
+        size_t skip = value.find_first_not_of(' ');
+        value.erase(0, skip == std::string::npos ? value.size() : skip);
+        if (nameLen == 14 && strncasecmp(h, "Content-Length", 14) == 0) {
+          r.contentLength = strtoul(value.c_str(), nullptr, 10);
+        } else if (nameLen == 10 && strncasecmp(h, "Connection", 10) == 0) {
+          if (strcasestr(value.c_str(), "close")) r.keepAlive = false;
+          else if (strcasestr(value.c_str(), "keep-alive")) r.keepAlive = true;
+        } else if (nameLen == 6 && strncasecmp(h, "Accept", 6) == 0) {
+          r.wantsStream = strcasestr(value.c_str(), "text/event-stream") != nullptr;
+        } else if (nameLen == 17 && strncasecmp(h, "Transfer-Encoding", 17) == 0) {
+          return false;   // chunked uploads aren't supported
+        } else if (nameLen == 22 && strncasecmp(h, "X-HTTP-Method-Override", 22) == 0) {
+          r.method = value;
+        }
+      }
+      at = end + 2;
+    }
+    return true;
+  }
+
+  static const char* statusText(int code) {
+    switch (code) {
+      case 200: return "OK";
+      case 204: return "No Content";
+      case 400: return "Bad Request";
+      case 404: return "Not Found";
+      case 405: return "Method Not Allowed";
+      case 413: return "Payload Too Large";
+      case 431: return "Request Header Fields Too Large";
+      default: return "Error";
+    }
+  }
+
+  void respond(Conn& c, int code, const std::string& body) {
+    if (code >= 400) stats_.errors++;
+    char head[256];
+    int n = snprintf(head, sizeof(head),
+                     "HTTP/1.1 %d %s\r\nContent-Type: application/json; charset=utf-8\r\n"
+                     "Content-Length: %zu\r\nAccess-Control-Allow-Origin: *\r\n%s\r\n",
+                     code, statusText(code), body.size(),
+                     c.closeAfter ? "Connection: close\r\n" : "");
+    c.out.append(head, n);
+    c.out += body;
+  }
+
+  void respondError(Conn& c, int code, const char* message) {
+    std::string body = "{\"error\":";
+    rtdbWriteKey(message, body);
+    body += '}';
+    respond(c, code, body);
+  }
+
+  // Answers and closes; for requests that can't be framed
+  void fatal(Conn& c, int code, const char* message) {
+    c.closeAfter = true;
+    respondError(c, code, message);
+  }
+
+  void handle(int fd, Conn& c, const Request& r, const char* body, size_t len) {
+    if (r.method == "OPTIONS") {   // CORS preflight from a browser dashboard
+      static const char PREFLIGHT[] =
+        "HTTP/1.1 204 No Content\r\nAccess-Control-Allow-Origin: *\r\n"
+        "Access-Control-Allow-Methods: GET, PUT, POST, PATCH, DELETE\r\n"
+        "Access-Control-Allow-Headers: Content-Type, X-HTTP-Method-Override\r\n"
+        "Access-Control-Max-Age: 86400\r\n\r\n";
+      c.out.append(PREFLIGHT, sizeof(PREFLIGHT) - 1);
+      return;
+    }
+
+    size_t q = r.target.find('?');
+    std::string rawPath = r.target.substr(0, q);
+    std::string path = rtdbUrlDecode(rawPath.data(), rawPath.size(), false);
+    if (path.size() < 5 || path.compare(path.size() - 5, 5, ".json") != 0) {
+      respondError(c, 404, "Paths must end in .json");
+      return;
+    }
+    path.resize(path.size() - 5);
+    if (path == "/.stats" && r.method == "GET") {
+      respond(c, 200, statsJson());
+      return;
+    }
+    RtdbPath at;
+    rtdbSplitPath(path, at);
+    for (const std::string& key : at) {
+      if (key.find_first_of(".$#[]") != std::string::npos) {
+        respondError(c, 400, "Invalid path: keys must not contain '.', '$', '#', '[' or ']'");
+        return;
+      }
+    }
+
+    RtdbQuery query;
+    bool silent = false;
+    const char* why = q == std::string::npos ? nullptr
+                      : parseQuery(r.target.c_str() + q + 1, query, silent);
+    if (why) {
+      respondError(c, 400, why);
+      return;
+    }
+
+    if (r.method == "GET") {
+      stats_.reads++;
+      if (r.wantsStream) startStream(fd, c, at, query);
+      else get(c, at, query);
+      return;
+    }
+    if (query.order != RtdbQuery::NONE || query.filtered() || query.shallow) {
+      respondError(c, 400, "Query parameters are only supported on reads");
+      return;
+    }
+    RtdbNode value;
+    bool isPatch = r.method == "PATCH";
+    if (r.method == "PUT" || r.method == "POST" || isPatch) {
+      RtdbParser parser(body, len);
+      if (!parser.parse(value, isPatch) || (isPatch && !value.leaf.empty())) {
+        respondError(c, 400, "Invalid data; couldn't parse JSON object, array, or value.");
+        return;
+      }
+    } else if (r.method != "DELETE") {
+      respondError(c, 405, "Method not supported");
+      return;
+    }
+    stats_.writes++;
+
+    std::string json;
+    std::string reply;
+    if (r.method == "POST") {
+      char id[PUSH_ID_LEN + 1];
+      pushIds_.next(rtdbEpochMs(), id);
+      at.push_back(id);
+      rtdbWrite(value, json);
+      reply = "{\"name\":\"" + std::string(id) + "\"}";
+      tree_.set(at, std::move(value));
+      logWrite("PUT", at, json);
+      notifyPut(at, json);
+    } else if (isPatch) {
+      rtdbWrite(value, json);
+      reply = json;
+      std::vector<RtdbPath> touched;
+      for (const auto& kv : value.children) {
+        touched.push_back(at);
+        rtdbSplitPath(kv.first, touched.back());
+      }
+      tree_.update(at, std::move(value));
+      logWrite("PATCH", at, json);
+      notifyPatch(at, touched, json);
+    } else {   // PUT, DELETE
+      rtdbWrite(value, json);
+      reply = json;
+      tree_.set(at, std::move(value));
+      logWrite("PUT", at, json);
+      notifyPut(at, json);
+    }
+    if (silent) {
+      char head[160];
+      int n = snprintf(head, sizeof(head), "HTTP/1.1 204 No Content\r\n"
+                       "Access-Control-Allow-Origin: *\r\n%s\r\n",
+                       c.closeAfter ? "Connection: close\r\n" : "");
+      c.out.append(head, n);
+    } else {
+      respond(c, 200, reply);
+    }
+  }
+
+  // Returns an error message, or nullptr when the parameters are usable
+  static const char* parseQuery(const char* s, RtdbQuery& q, bool& silent) {
+    bool any = false;
+    while (*s) {
+      const char* amp = strchr(s, '&');
+      size_t n = amp ? (size_t)(amp - s) : strlen(s);
+      const char* eq = (const char*)memchr(s, '=', n);
+      std::string name(s, eq ? eq - s : n);
+      std::string value = eq ? rtdbUrlDecode(eq + 1, s + n - eq - 1, true) : "";
+      s += n + (amp ? 1 : 0);
+
+      if (name == "orderBy") {
+        RtdbNode v;
+        if (!RtdbParser(value.data(), value.size()).parse(v) || v.leaf.empty() || v.leaf[0] != '"') {
+          return "orderBy must be a valid JSON encoded path";
+        }
+        std::string by = RtdbParser::unquote(v.leaf);
+        if (by == "$key" || by == "$priority") {
+          q.order = RtdbQuery::BY_KEY;
+        } else if (by == "$value") {
+          q.order = RtdbQuery::BY_VALUE;
+        } else {
+          q.order = RtdbQuery::BY_CHILD;
+          rtdbSplitPath(by, q.child);
+        }
+      } else if (name == "startAt" || name == "endAt" || name == "equalTo") {
+        RtdbNode v;
+        if (!RtdbParser(value.data(), value.size()).parse(v) || !v.children.empty()) {
+          return "Constraint index field must be a JSON primitive";
+        }
+        if (name != "endAt") {
+          q.start = v;
+          q.hasStart = true;
+        }
+        if (name != "startAt") {
+          q.end = v;
+          q.hasEnd = true;
+        }
+        any = true;
+      } else if (name == "limitToFirst" || name == "limitToLast") {
+        long limit = strtol(value.c_str(), nullptr, 10);
+        if (limit <= 0) return "Limit must be a positive integer";
+        (name == "limitToFirst" ? q.limitFirst : q.limitLast) = limit;
+        any = true;
+      } else if (name == "shallow") {
+        q.shallow = value == "true";
+      } else if (name == "print") {
+        silent = value == "silent";
+      }
+      // auth, access_token, format, timeout, ...: accepted and ignored
+    }
+    if (any && q.order == RtdbQuery::NONE) {
+      return "orderBy must be defined when other query parameters are defined";
+    }
+    if (q.shallow && (any || q.order != RtdbQuery::NONE)) {
+      return "Mixing 'shallow' and querying parameters is not supported";
+    }
+    return nullptr;
+  }
+
+  void get(Conn& c, const RtdbPath& at, const RtdbQuery& q) {
+    std::string body;
+    rtdbWriteQuery(tree_.find(at), q, body);
+    respond(c, 200, body);
+  }
+
+  std::string statsJson() const {
+    rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    unsigned long long cpuUs = (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000ULL +
+                               ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+    char buf[512];
+    snprintf(buf, sizeof(buf),
+             "{\"accepted\":%llu,\"requests\":%llu,\"reads\":%llu,\"writes\":%llu,"
+             "\"errors\":%llu,\"events\":%llu,\"bytesIn\":%llu,\"bytesOut\":%llu,"
+             "\"connections\":%zu,\"streams\":%zu,\"cpuUs\":%llu,\"maxRssKb\":%ld}",
+             stats_.accepted, stats_.requests, stats_.reads, stats_.writes, stats_.errors,
+             stats_.events, stats_.bytesIn, stats_.bytesOut, connections(), streams_.size(),
+             cpuUs, ru.ru_maxrss);
+    return buf;
+  }
+
+  //  STREAMS
+
+  void startStream(int fd, Conn& c, const RtdbPath& at, const RtdbQuery& q) {
+    static const char HEAD[] =
+      "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+      "Access-Control-Allow-Origin: *\r\n\r\n";
+    c.out.append(HEAD, sizeof(HEAD) - 1);
+    c.stream = true;
+    c.streamPath = at;
+    c.streamQuery = q;
+    c.closeAfter = false;
+    streams_.push_back(fd);
+    std::string data;
+    rtdbWriteQuery(tree_.find(at), q, data);
+    sendEvent(fd, "put", "/", data);
+  }
+
+  // "event: put\ndata: {"path":"/x","data":...}\n\n"; path nullptr sends
+  // data as it is
+  void sendEvent(int fd, const char* event, const char* path, const std::string& data) {
+    Conn* c = conns_[fd];
+    c->out += "event: ";
+    c->out += event;
+    c->out += "\ndata: ";
+    if (path) {
+      c->out += "{\"path\":";
+      rtdbWriteKey(path, c->out);
+      c->out += ",\"data\":";
+      c->out += data;
+      c->out += '}';
+    } else {
+      c->out += data;
+    }
+    c->out += "\n\n";
+    stats_.events++;
+    if (!c->writeArmed) pendingFlush_.push_back(fd);
+  }
+
+  // Written value at (PUT, POST, DELETE)
+  void notifyPut(const RtdbPath& at, const std::string& json) {
+    for (int fd : streams_) {
+      const Conn& c = *conns_[fd];
+      if (rtdbIsPrefix(c.streamPath, at)) {
+        sendEvent(fd, "put", rtdbPathString(at, c.streamPath.size()).c_str(), json);
+      } else if (rtdbIsPrefix(at, c.streamPath)) {
+        resend(fd);
+      }
+    }
+    flushStreams();
+  }
+
+  // PATCH at with the given children: listeners at or above it get the
+  // patch, listeners below one of the children get their new value
+  void notifyPatch(const RtdbPath& at, const std::vector<RtdbPath>& touched, const std::string& json) {
+    for (int fd : streams_) {
+      const Conn& c = *conns_[fd];
+      if (rtdbIsPrefix(c.streamPath, at)) {
+        sendEvent(fd, "patch", rtdbPathString(at, c.streamPath.size()).c_str(), json);
+        continue;
+      }
+      for (const RtdbPath& t : touched) {
+        if (rtdbIsPrefix(t, c.streamPath) || rtdbIsPrefix(c.streamPath, t)) {
+          resend(fd);
+          break;
+        }
+      }
+    }
+    flushStreams();
+  }
+
+  void resend(int fd) {
+    const Conn& c = *conns_[fd];
+    std::string data;
+    rtdbWriteQuery(tree_.find(c.streamPath), c.streamQuery, data);
+    sendEvent(fd, "put", "/", data);
+  }
+
+  // Writes queued events, dropping listeners too far behind
+  void flushStreams() {
+    std::vector<int> fds;
+    fds.swap(pendingFlush_);
+    for (int fd : fds) {
+      if (fd < (int)conns_.size() && conns_[fd]) flush(fd);
+    }
+    dropStalledStreams();
+  }
+
+  void dropStalledStreams() {
+    for (size_t i = streams_.size(); i-- > 0;) {
+      int fd = streams_[i];
+      const Conn& c = *conns_[fd];
+      if (c.out.size() - c.outSent > RTDB_STREAM_BACKLOG_MAX) drop(fd);
+    }
+  }
+
+  int listenFd_;
+  int epollFd_;
+  FILE* log_;
+  bool logDirty_;
+  unsigned long replayed_;
+  unsigned long skipped_;
+  unsigned long long lastKeepAliveMs_;
+  std::vector<Conn*> conns_;     // by descriptor
+  std::vector<int> streams_;
+  std::vector<int> pendingFlush_;
+  RtdbTree tree_;
+  RtdbStats stats_;
+  PushIdGenerator pushIds_;
+};
@@ -0,0 +1,543 @@
+// Smart Plant Buddy - in-memory Realtime Database tree
+//
+// The data model behind rtdb_server: a tree of named children whose
+// leaves keep their JSON text as it arrived (numbers are never
+// reformatted, strings stay escaped), so serializing is copying. Same
+// rules as Firebase: arrays become objects keyed "0", "1", ..., writing
+// null or {} deletes, and a parent left with no children goes with it.
+//
+// Queries follow the REST API's orderBy / startAt / endAt / equalTo /
+// limitToFirst / limitToLast. Ordering by a value sorts nulls, false,
+// true, numbers, strings, then objects, with ties broken by key; keys
+// that are 32-bit integers sort numerically before all other keys.
+
+#pragma once
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+const int RTDB_DEPTH_MAX = 32;
+
+//  TREE
+
+struct RtdbNode {
+  std::string leaf;                          // JSON text of a scalar, empty for an object
+  std::map<std::string, RtdbNode> children;
+
+  bool isNull() const { return leaf.empty() && children.empty(); }
+
+  void clear() {
+    leaf.clear();
+    children.clear();
+  }
+};
+
+typedef std::vector<std::string> RtdbPath;
+
+inline std::string rtdbPathString(const RtdbPath& path, size_t from = 0) {
+  std::string s;
+  for (size_t i = from; i < path.size(); i++) s += "/" + path[i];
+  return s.empty() ? "/" : s;
+}
+
+// "a/b//c" -> {a, b, c}, appended to path
+inline void rtdbSplitPath(const std::string& s, RtdbPath& path) {
+  size_t at = 0;
+  while (at <= s.size()) {
+    size_t slash = s.find('/', at);
+    if (slash == std::string::npos) slash = s.size();
+    if (slash > at) path.push_back(s.substr(at, slash - at));
+    at = slash + 1;
+  }
+}
+
+inline bool rtdbIsPrefix(const RtdbPath& prefix, const RtdbPath& path) {
+  return prefix.size() <= path.size() && std::equal(prefix.begin(), prefix.end(), path.begin());
+}
+
+//  JSON
+
+// Parses a JSON value into a node. Keys must be valid database keys;
+// slashKeys lets the top level use '/' for PATCH's multi-path updates.
+class RtdbParser {
+ public:
+  RtdbParser(const char* p, size_t n) : p_(p), end_(p + n), error_(nullptr) {}
+
+  bool parse(RtdbNode& out, bool slashKeys = false) {
+    out.clear();
+    if (!value(out, 0, slashKeys)) return false;
+    skipSpace();
+    if (p_ != end_) return fail("trailing characters");
+    return true;
+  }
+
+  const char* error() const { return error_ ? error_ : "ok"; }
+
+  // Decodes a string literal such as a leaf's text
+  static std::string unquote(const std::string& literal) {
+    std::string out;
+    RtdbParser p(literal.data(), literal.size());
+    p.string(out);
+    return out;
+  }
+
+ private:
+  bool fail(const char* why) {
+    if (!error_) error_ = why;
+    return false;
+  }
+
+  void skipSpace() {
+    while (p_ < end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) p_++;
+  }
+
+  bool literal(const char* word) {
+    size_t n = strlen(word);
+    if ((size_t)(end_ - p_) < n || memcmp(p_, word, n) != 0) return fail("invalid literal");
+    p_ += n;
+    return true;
+  }
+
+  bool value(RtdbNode& out, int depth, bool slashKeys) {
+    if (depth > RTDB_DEPTH_MAX) return fail("nested too deep");
+    skipSpace();
+    if (p_ == end_) return fail("unexpected end");
+    const char* start = p_;
+    switch (*p_) {
+      case '{': return object(out, depth, slashKeys);
+      case '[': return array(out, depth);
+      case '"': {
+        std::string ignored;
+        if (!string(ignored)) return false;
+        out.leaf.assign(start, p_ - start);
+        return true;
+      }
+      case 't':
+        if (!literal("true")) return false;
+        out.leaf = "true";
+        return true;
+      case 'f':
+        if (!literal("false")) return false;
+        out.leaf = "false";
+        return true;
+      case 'n': return literal("null");
+      default:
+        if (!number()) return false;
+        out.leaf.assign(start, p_ - start);
+        return true;
+    }
+  }
+
+  bool object(RtdbNode& out, int depth, bool slashKeys) {
+    p_++;
+    skipSpace();
+    if (p_ < end_ && *p_ == '}') {
+      p_++;
+      return true;
+    }
+    while (true) {
+      skipSpace();
+      std::string key;
+      if (p_ == end_ || *p_ != '"' || !string(key)) return fail("expected a key");
+      if (!validKey(key, slashKeys)) return fail("invalid key");
+      skipSpace();
+      if (p_ == end_ || *p_++ != ':') return fail("expected ':'");
+      RtdbNode& child = out.children[key];
+      child.clear();
+      if (!value(child, depth + 1, false)) return false;
+      if (child.isNull() && !slashKeys) out.children.erase(key);
+      skipSpace();
+      if (p_ == end_) return fail("unexpected end");
+      char ch = *p_++;
+      if (ch == '}') return true;
+      if (ch != ',') return fail("expected ',' or '}'");
+    }
+  }
+
+  bool array(RtdbNode& out, int depth) {
+    p_++;
+    skipSpace();
+    if (p_ < end_ && *p_ == ']') {
+      p_++;
+      return true;
+    }
+    for (unsigned i = 0;; i++) {
+      char key[12];
+      snprintf(key, sizeof(key), "%u", i);
+      RtdbNode& child = out.children[key];
+      if (!value(child, depth + 1, false)) return false;
+      if (child.isNull()) out.children.erase(key);
+      skipSpace();
+      if (p_ == end_) return fail("unexpected end");
+      char ch = *p_++;
+      if (ch == ']') return true;
+      if (ch != ',') return fail("expected ',' or ']'");
+    }
+  }
+
+  // Consumes a string literal, decoding it into out (\u escapes outside
+  // ASCII are kept as written; keys only need them for comparison)
+  bool string(std::string& out) {
+    p_++;
+    while (p_ < end_) {
+      char ch = *p_++;
+      if (ch == '"') return true;
+      if ((uint8_t)ch < 0x20) return fail("control character in string");
+      if (ch != '\\') {
+        out += ch;
+        continue;
+      }
+      if (p_ == end_) break;
+      char esc = *p_++;
+      switch (esc) {
+        case '"': case '\\': case '/': out += esc; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'n': out += '\n'; break;
+        case 'r': out += '\r'; break;
+        case 't': out += '\t'; break;
+        case 'u': {
+          if (end_ - p_ < 4) return fail("bad escape");
+          for (int i = 0; i < 4; i++) {
+            if (!isxdigit((unsigned char)p_[i])) return fail("bad escape");
+          }
+          unsigned code = strtoul(std::string(p_, 4).c_str(), nullptr, 16);
+          if (code < 0x80) out += (char)code;
+          else out.append(p_ - 2, 6);
+          p_ += 4;
+          break;
+        }
+        default: return fail("bad escape");
+      }
+    }
+    return fail("unterminated string");
+  }
+
+  bool number() {
+    const char* start = p_;
+    if (p_ < end_ && *p_ == '-') p_++;
+    const char* digits = p_;
+    while (p_ < end_ && isdigit((unsigned char)*p_)) p_++;
+    if (p_ == digits) return fail("invalid value");
+    if (p_ < end_ && *p_ == '.') {
+      const char* frac = ++p_;
+      while (p_ < end_ && isdigit((unsigned char)*p_)) p_++;
+      if (p_ == frac) return fail("invalid number");
+    }
+    if (p_ < end_ && (*p_ == 'e' || *p_ == 'E')) {
+      p_++;
+      if (p_ < end_ && (*p_ == '+' || *p_ == '-')) p_++;
+      const char* exp = p_;
+      while (p_ < end_ && isdigit((unsigned char)*p_)) p_++;
+      if (p_ == exp) return fail("invalid number");
+    }
+    return p_ > start;
+  }
+
+  // Firebase keys: no . $ # [ ] / or control characters
+  static bool validKey(const std::string& key, bool slashKeys) {
+    if (key.empty() || key.size() > 768) return false;
+    for (char ch : key) {
+      if ((uint8_t)ch < 0x20 || ch == 0x7f || strchr(".$#[]", ch)) return false;
+      if (ch == '/' && !slashKeys) return false;
+    }
+    return true;
+  }
+
+  const char* p_;
+  const char* end_;
+  const char* error_;
+};
+
+inline void rtdbWriteKey(const std::string& key, std::string& out) {
+  out += '"';
+  for (char ch : key) {
+    if (ch == '"' || ch == '\\') out += '\\';
+    out += ch;
+  }
+  out += '"';
+}
+
+inline void rtdbWrite(const RtdbNode& node, std::string& out) {
+  if (!node.leaf.empty()) {
+    out += node.leaf;
+    return;
+  }
+  if (node.children.empty()) {
+    out += "null";
+    return;
+  }
+  char sep = '{';
+  for (const auto& kv : node.children) {
+    out += sep;
+    sep = ',';
+    rtdbWriteKey(kv.first, out);
+    out += ':';
+    rtdbWrite(kv.second, out);
+  }
+  out += '}';
+}
+
+inline void rtdbWrite(const RtdbNode* node, std::string& out) {
+  if (node) rtdbWrite(*node, out);
+  else out += "null";
+}
+
+//  ORDERING
+
+// A key that is a 32-bit integer sorts as that integer
+inline bool rtdbIntKey(const std::string& key, long long& v) {
+  const char* s = key.c_str();
+  if (*s == '-') s++;
+  if (!*s || (s[0] == '0' && s[1]) || strlen(s) > 10) return false;
+  for (const char* c = s; *c; c++) {
+    if (!isdigit((unsigned char)*c)) return false;
+  }
+  v = atoll(key.c_str());
+  return v >= INT32_MIN && v <= INT32_MAX && !(v == 0 && key[0] == '-');
+}
+
+inline int rtdbCompareKeys(const std::string& a, const std::string& b) {
+  long long ia = 0, ib = 0;
+  bool na = rtdbIntKey(a, ia), nb = rtdbIntKey(b, ib);
+  if (na && nb) return ia < ib ? -1 : ia > ib;
+  if (na != nb) return na ? -1 : 1;
+  return a.compare(b) < 0 ? -1 : a.compare(b) > 0;
+}
+
+// A value reduced to what ordering needs
+struct RtdbOrderValue {
+  enum Rank { RANK_NULL, RANK_FALSE, RANK_TRUE, RANK_NUMBER, RANK_STRING, RANK_OBJECT };
+  Rank rank;
+  double number;
+  std::string text;    // decoded string, or the object's JSON
+
+  static RtdbOrderValue of(const RtdbNode* node) {
+    RtdbOrderValue v;
+    v.rank = RANK_NULL;
+    v.number = 0;
+    if (!node || node->isNull()) return v;
+    const std::string& s = node->leaf;
+    if (s.empty()) {
+      v.rank = RANK_OBJECT;
+    } else if (s == "false") {
+      v.rank = RANK_FALSE;
+    } else if (s == "true") {
+      v.rank = RANK_TRUE;
+    } else if (s[0] == '"') {
+      v.rank = RANK_STRING;
+      v.text = RtdbParser::unquote(s);
+    } else {
+      v.rank = RANK_NUMBER;
+      v.number = strtod(s.c_str(), nullptr);
+    }
+    return v;
+  }
+
+  int compare(const RtdbOrderValue& o) const {
+    if (rank != o.rank) return rank < o.rank ? -1 : 1;
+    if (rank == RANK_NUMBER) return number < o.number ? -1 : number > o.number;
+    if (rank == RANK_STRING) return text.compare(o.text) < 0 ? -1 : text.compare(o.text) > 0;
+    return 0;
+  }
+};
+
+//  QUERIES
+
+struct RtdbQuery {
+  enum Order { NONE, BY_KEY, BY_VALUE, BY_CHILD };
+  Order order;
+  RtdbPath child;            // BY_CHILD
+  bool hasStart, hasEnd;
+  RtdbNode start, end;       // startAt / endAt as JSON (equalTo sets both)
+  long limitFirst;           // 0 = none
+  long limitLast;
+  bool shallow;
+
+  RtdbQuery() : order(NONE), hasStart(false), hasEnd(false), limitFirst(0), limitLast(0),
+                shallow(false) {}
+
+  bool filtered() const { return hasStart || hasEnd || limitFirst || limitLast; }
+};
+
+inline const RtdbNode* rtdbChild(const RtdbNode& node, const RtdbPath& path) {
+  const RtdbNode* n = &node;
+  for (const std::string& k : path) {
+    auto it = n->children.find(k);
+    if (it == n->children.end()) return nullptr;
+    n = &it->second;
+  }
+  return n;
+}
+
+// Key text of a startAt / endAt given with orderBy="$key"
+inline std::string rtdbBoundKey(const RtdbNode& bound) {
+  return bound.leaf.size() > 1 && bound.leaf[0] == '"' ? RtdbParser::unquote(bound.leaf) : bound.leaf;
+}
+
+// shallow=true: children with objects replaced by true
+inline void rtdbWriteShallow(const RtdbNode* node, std::string& out) {
+  if (!node || !node->leaf.empty() || node->children.empty()) {
+    rtdbWrite(node, out);
+    return;
+  }
+  char sep = '{';
+  for (const auto& kv : node->children) {
+    out += sep;
+    sep = ',';
+    rtdbWriteKey(kv.first, out);
+    out += ':';
+    out += kv.second.leaf.empty() ? "true" : kv.second.leaf;
+  }
+  out += '}';
+}
+
+// Writes node's children that pass the query, in query order
+inline void rtdbWriteQuery(const RtdbNode* node, const RtdbQuery& q, std::string& out) {
+  if (q.shallow) {
+    rtdbWriteShallow(node, out);
+    return;
+  }
+  if (!node || !node->leaf.empty() || q.order == RtdbQuery::NONE) {
+    rtdbWrite(node, out);
+    return;
+  }
+
+  struct Entry {
+    const std::string* key;
+    const RtdbNode* node;
+    RtdbOrderValue value;
+  };
+  std::vector<Entry> entries;
+  entries.reserve(node->children.size());
+  std::string startKey = rtdbBoundKey(q.start), endKey = rtdbBoundKey(q.end);
+  RtdbOrderValue startValue = RtdbOrderValue::of(&q.start);
+  RtdbOrderValue endValue = RtdbOrderValue::of(&q.end);
+  bool intKeys = false;
+  for (const auto& kv : node->children) {
+    Entry e = {&kv.first, &kv.second, RtdbOrderValue()};
+    if (q.order == RtdbQuery::BY_VALUE) {
+      e.value = RtdbOrderValue::of(&kv.second);
+    } else if (q.order == RtdbQuery::BY_CHILD) {
+      e.value = RtdbOrderValue::of(rtdbChild(kv.second, q.child));
+    } else {
+      // The map is in string order already; only integer keys move
+      long long v = 0;
+      bool isInt = rtdbIntKey(kv.first, v);
+      e.value.rank = isInt ? RtdbOrderValue::RANK_NUMBER : RtdbOrderValue::RANK_STRING;
+      e.value.number = (double)v;
+      intKeys |= isInt;
+    }
+    entries.push_back(std::move(e));
+  }
+  if (q.order != RtdbQuery::BY_KEY || intKeys) {
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+      return a.value.compare(b.value) < 0;
+    });
+  }
+
+  // startAt / endAt compare the ordered value, or the key with $key
+  auto inRange = [&](const Entry& e) {
+    if (q.order == RtdbQuery::BY_KEY) {
+      if (q.hasStart && rtdbCompareKeys(*e.key, startKey) < 0) return false;
+      if (q.hasEnd && rtdbCompareKeys(*e.key, endKey) > 0) return false;
+      return true;
+    }
+    if (q.hasStart && e.value.compare(startValue) < 0) return false;
+    if (q.hasEnd && e.value.compare(endValue) > 0) return false;
+    return true;
+  };
+  size_t first = 0, last = entries.size();
+  while (first < last && !inRange(entries[first])) first++;
+  while (last > first && !inRange(entries[last - 1])) last--;
+  if (q.limitFirst > 0 && last - first > (size_t)q.limitFirst) last = first + q.limitFirst;
+  if (q.limitLast > 0 && last - first > (size_t)q.limitLast) first = last - q.limitLast;
+
+  if (first == last) {
+    out += "{}";
+    return;
+  }
+  char sep = '{';
+  for (size_t i = first; i < last; i++) {
+    out += sep;
+    sep = ',';
+    rtdbWriteKey(*entries[i].key, out);
+    out += ':';
+    rtdbWrite(*entries[i].node, out);
+  }
+  out += '}';
+}
+
+//  WRITES
+
+class RtdbTree {
+ public:
+  const RtdbNode& root() const { return root_; }
+  const RtdbNode* find(const RtdbPath& path) const { return rtdbChild(root_, path); }
+
+  // Replaces the value at path; a null value deletes it
+  void set(const RtdbPath& path, RtdbNode&& value) {
+    if (value.isNull()) {
+      remove(path);
+      return;
+    }
+    RtdbNode* n = &root_;
+    for (const std::string& k : path) {
+      n->leaf.clear();
+      n = &n->children[k];
+    }
+    *n = std::move(value);
+  }
+
+  // PATCH: each child of update (a relative path) is set in turn
+  void update(const RtdbPath& path, RtdbNode&& update) {
+    for (auto& kv : update.children) {
+      RtdbPath full = path;
+      rtdbSplitPath(kv.first, full);
+      set(full, std::move(kv.second));
+    }
+  }
+
+  void remove(const RtdbPath& path) {
+    if (path.empty()) {
+      root_.clear();
+      return;
+    }
+    // Walk down, then prune parents the delete leaves empty
+    std::vector<RtdbNode*> trail;
+    RtdbNode* n = &root_;
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+      auto it = n->children.find(path[i]);
+      if (it == n->children.end()) return;
+      trail.push_back(n);
+      n = &it->second;
+    }
+    n->children.erase(path.back());
+    for (size_t i = trail.size(); i-- > 0 && n->isNull();) {
+      trail[i]->children.erase(path[i]);
+      n = trail[i];
+    }
+  }
+
+  // Nodes and leaves under the root, for stats
+  void count(size_t& nodes, size_t& leaves) const {
+    nodes = leaves = 0;
+    countFrom(root_, nodes, leaves);
+  }
+
+ private:
+  static void countFrom(const RtdbNode& n, size_t& nodes, size_t& leaves) {
+    nodes++;
+    if (!n.leaf.empty()) leaves++;
+    for (const auto& kv : n.children) countFrom(kv.second, nodes, leaves);
+  }
+
+  RtdbNode root_;
+};
@@ -0,0 +1,333 @@
+// Smart Plant Buddy - minimal WebSocket server for host builds
+//
+// Stands in for arduinoWebSockets' WebSocketsServer when the firmware core
+// runs on Linux: RFC 6455 handshake, unfragmented text/binary frames,
+// ping/pong and close, on non-blocking sockets driven by poll(). Events are
+// delivered through one function pointer with the same shape as the
+// device's webSocketEvent(), so the sketch and the simulator wire it up
+// the same way. A client that can't take a frame right away is dropped
+// rather than buffered, as the live feed only cares about the newest value.
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum WsEvent { WS_CONNECTED, WS_DISCONNECTED, WS_TEXT, WS_BIN };
+
+typedef void (*WsEventFn)(uint8_t client, WsEvent type, const uint8_t* payload, size_t len);
+
+const uint8_t WS_CLIENTS_MAX = 8;
+const size_t WS_RX_MAX = 2048;   // handshake or one client frame
+
+//  HANDSHAKE HELPERS
+
+// SHA-1 of a short message (the key + GUID is 60 bytes)
+inline void sha1(const uint8_t* msg, size_t len, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  uint64_t bits = (uint64_t)len * 8;
+  size_t total = ((len + 8) / 64 + 1) * 64;
+  for (size_t block = 0; block < total; block += 64) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+      uint32_t v = 0;
+      for (int j = 0; j < 4; j++) {
+        size_t k = block + i * 4 + j;
+        uint8_t b;
+        if (k < len) b = msg[k];
+        else if (k == len) b = 0x80;
+        else if (k >= total - 8) b = (uint8_t)(bits >> ((total - 1 - k) * 8));
+        else b = 0;
+        v = (v << 8) | b;
+      }
+      w[i] = v;
+    }
+    for (int i = 16; i < 80; i++) {
+      uint32_t v = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+      w[i] = (v << 1) | (v >> 31);
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+      uint32_t f, k;
+      if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+      else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+      else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+      uint32_t t = ((a << 5) | (a >> 27)) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = (b << 30) | (b >> 2);
+      b = a;
+      a = t;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+  for (int i = 0; i < 20; i++) out[i] = (uint8_t)(h[i / 4] >> (24 - (i % 4) * 8));
+}
+
+// out needs 4 * ceil(len / 3) + 1 bytes
+inline void base64(const uint8_t* in, size_t len, char* out) {
+  static const char ALPHABET[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t o = 0;
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t v = (uint32_t)in[i] << 16;
+    if (i + 1 < len) v |= (uint32_t)in[i + 1] << 8;
+    if (i + 2 < len) v |= in[i + 2];
+    out[o++] = ALPHABET[(v >> 18) & 63];
+    out[o++] = ALPHABET[(v >> 12) & 63];
+    out[o++] = i + 1 < len ? ALPHABET[(v >> 6) & 63] : '=';
+    out[o++] = i + 2 < len ? ALPHABET[v & 63] : '=';
+  }
+  out[o] = '\0';
+}
+
+//  SERVER
+
+class WsServer {
+ public:
+  explicit WsServer(WsEventFn onEvent) : onEvent_(onEvent), listenFd_(-1) {
+    for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) clients_[i].fd = -1;
+  }
+
+  ~WsServer() { end(); }
+
+  bool begin(uint16_t port) {
+    listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) return false;
+    int one = 1;
+    setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(listenFd_, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd_, 4) != 0) {
+      ::close(listenFd_);
+      listenFd_ = -1;
+      return false;
+    }
+    fcntl(listenFd_, F_SETFL, O_NONBLOCK);
+    return true;
+  }
+
+  void end() {
+    for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) drop(i);
+    if (listenFd_ >= 0) ::close(listenFd_);
+    listenFd_ = -1;
+  }
+
+  // Accept, read and dispatch; waits up to timeoutMs for activity
+  void poll(int timeoutMs) {
+    if (listenFd_ < 0) return;
+    pollfd fds[WS_CLIENTS_MAX + 1];
+    uint8_t ids[WS_CLIENTS_MAX + 1];
+    nfds_t n = 0;
+    fds[n].fd = listenFd_;
+    fds[n].events = POLLIN;
+    n++;
+    for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) {
+      if (clients_[i].fd < 0) continue;
+      fds[n].fd = clients_[i].fd;
+      fds[n].events = POLLIN;
+      ids[n] = i;
+      n++;
+    }
+    if (::poll(fds, n, timeoutMs) <= 0) return;
+    if (fds[0].revents & POLLIN) accept();
+    for (nfds_t k = 1; k < n; k++) {
+      if (fds[k].revents & (POLLIN | POLLHUP | POLLERR)) receive(ids[k]);
+    }
+  }
+
+  bool send(uint8_t client, const uint8_t* data, size_t len, bool binary) {
+    if (client >= WS_CLIENTS_MAX || !clients_[client].open) return false;
+    return sendFrame(client, binary ? 0x2 : 0x1, data, len);
+  }
+
+  uint8_t connected() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) n += clients_[i].open;
+    return n;
+  }
+
+ private:
+  struct Client {
+    int fd;
+    bool open;   // handshake done
+    size_t rxLen;
+    uint8_t rx[WS_RX_MAX];
+  };
+
+  void accept() {
+    int fd = ::accept(listenFd_, nullptr, nullptr);
+    if (fd < 0) return;
+    for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) {
+      if (clients_[i].fd >= 0) continue;
+      fcntl(fd, F_SETFL, O_NONBLOCK);
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      clients_[i].fd = fd;
+      clients_[i].open = false;
+      clients_[i].rxLen = 0;
+      return;
+    }
+    ::close(fd);   // full
+  }
+
+  void drop(uint8_t i) {
+    Client& c = clients_[i];
+    if (c.fd < 0) return;
+    ::close(c.fd);
+    c.fd = -1;
+    if (c.open) {
+      c.open = false;
+      onEvent_(i, WS_DISCONNECTED, nullptr, 0);
+    }
+  }
+
+  void receive(uint8_t i) {
+    Client& c = clients_[i];
+    ssize_t got = recv(c.fd, c.rx + c.rxLen, WS_RX_MAX - c.rxLen, 0);
+    if (got <= 0) {
+      if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+      drop(i);
+      return;
+    }
+    c.rxLen += got;
+    if (!c.open) {
+      handshake(i);
+    } else {
+      while (c.fd >= 0 && parseFrame(i)) {}
+    }
+    if (c.fd >= 0 && c.rxLen == WS_RX_MAX) drop(i);   // oversized request or frame
+  }
+
+  void handshake(uint8_t i) {
+    Client& c = clients_[i];
+    c.rx[c.rxLen < WS_RX_MAX ? c.rxLen : WS_RX_MAX - 1] = '\0';
+    char* end = strstr((char*)c.rx, "\r\n\r\n");
+    if (!end) return;
+    *end = '\0';
+
+    const char* key = nullptr;
+    for (char* line = strstr((char*)c.rx, "\r\n"); line; line = strstr(line, "\r\n")) {
+      line += 2;
+      if (strncasecmp(line, "Sec-WebSocket-Key:", 18) == 0) {
+        key = line + 18;
+        while (*key == ' ') key++;
+        break;
+      }
+    }
+    if (!key) {
+      static const char BAD[] = "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n";
+      ::send(c.fd, BAD, sizeof(BAD) - 1, MSG_NOSIGNAL);
+      drop(i);
+      return;
+    }
+
+    char keyGuid[128];
+    size_t keyLen = strcspn(key, "\r");
+    snprintf(keyGuid, sizeof(keyGuid), "%.*s258EAFA5-E914-47DA-95CA-C5AB0DC85B11", (int)keyLen, key);
+    uint8_t digest[20];
+    sha1((const uint8_t*)keyGuid, strlen(keyGuid), digest);
+    char accept[29];
+    base64(digest, sizeof(digest), accept);
+
+    char reply[160];
+    int n = snprintf(reply, sizeof(reply),
+                     "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                     "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+    if (::send(c.fd, reply, n, MSG_NOSIGNAL) != n) {
+      drop(i);
+      return;
+    }
+    size_t used = (end + 4) - (char*)c.rx;
+    memmove(c.rx, c.rx + used, c.rxLen - used);
+    c.rxLen -= used;
+    c.open = true;
+    onEvent_(i, WS_CONNECTED, nullptr, 0);
+  }
+
+  // Handle one complete frame at the front of rx; false if there is none
+  bool parseFrame(uint8_t i) {
+    Client& c = clients_[i];
+    if (c.rxLen < 2) return false;
+    uint8_t opcode = c.rx[0] & 0x0f;
+    bool masked = c.rx[1] & 0x80;
+    uint64_t len = c.rx[1] & 0x7f;
+    size_t head = 2;
+    if (len == 126) {
+      if (c.rxLen < 4) return false;
+      len = ((uint64_t)c.rx[2] << 8) | c.rx[3];
+      head = 4;
+    } else if (len == 127) {
+      if (c.rxLen < 10) return false;
+      len = 0;
+      for (int k = 0; k < 8; k++) len = (len << 8) | c.rx[2 + k];
+      head = 10;
+    }
+    if (!masked || len > WS_RX_MAX) {   // clients must mask
+      drop(i);
+      return false;
+    }
+    if (c.rxLen < head + 4 + len) return false;
+
+    const uint8_t* mask = c.rx + head;
+    uint8_t* payload = c.rx + head + 4;
+    for (size_t k = 0; k < len; k++) payload[k] ^= mask[k & 3];
+
+    switch (opcode) {
+      case 0x1: onEvent_(i, WS_TEXT, payload, len); break;
+      case 0x2: onEvent_(i, WS_BIN, payload, len); break;
+      case 0x8:
+        sendFrame(i, 0x8, nullptr, 0);
+        drop(i);
+        return false;
+      case 0x9: sendFrame(i, 0xA, payload, len); break;
+      default: break;   // pong, continuation
+    }
+    if (c.fd < 0) return false;
+    size_t used = head + 4 + len;
+    memmove(c.rx, c.rx + used, c.rxLen - used);
+    c.rxLen -= used;
+    return true;
+  }
+
+  // Server frames are unmasked; a short write drops the client
+  bool sendFrame(uint8_t i, uint8_t opcode, const uint8_t* data, size_t len) {
+    uint8_t head[10];
+    size_t h = 0;
+    head[h++] = 0x80 | opcode;
+    if (len < 126) {
+      head[h++] = (uint8_t)len;
+    } else if (len <= 0xffff) {
+      head[h++] = 126;
+      head[h++] = (uint8_t)(len >> 8);
+      head[h++] = (uint8_t)len;
+    } else {
+      head[h++] = 127;
+      for (int k = 7; k >= 0; k--) head[h++] = (uint8_t)((uint64_t)len >> (k * 8));
+    }
+    int fd = clients_[i].fd;
+    bool ok = ::send(fd, head, h, MSG_NOSIGNAL | (len ? MSG_MORE : 0)) == (ssize_t)h &&
+              (len == 0 || ::send(fd, data, len, MSG_NOSIGNAL) == (ssize_t)len);
+    if (!ok && opcode != 0x8) drop(i);
+    return ok;
+  }
+
+  WsEventFn onEvent_;
+  int listenFd_;
+  Client clients_[WS_CLIENTS_MAX];
+};
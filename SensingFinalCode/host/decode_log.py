@@ -0,0 +1,154 @@
+# Turns the firmware's binary log frames (DeferredLog.h) back into text
+# with the format strings in LogMessages.h. Bytes outside frames (boot
+# messages, command replies) are passed through as they are. Reads a
+# capture file or stdin, so it can sit on a serial port:
+#   python3 decode_log.py sim.bin
+#   python3 decode_log.py < /dev/ttyUSB0
+import codecs
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TABLE = os.path.join(HERE, '..', 'LogMessages.h')
+SYNC = b'\xa5\x5a'
+HEADER_LEN = 7
+
+
+def unescape(s):
+    return re.sub(r'\\(.)', lambda m: {'n': '\n', 't': '\t'}.get(m.group(1), m.group(1)), s)
+
+
+def load_table(path):
+    with open(path, encoding='utf-8') as f:
+        src = f.read()
+    modules = re.findall(r'X\((LOG_MOD_\w+),\s*"([^"]*)"\)', src)
+    module_names = {m: name for m, name in modules}
+    messages = []
+    for m in re.finditer(r'X\((LOG_\w+),\s*(LOG_MOD_\w+),\s*LOG_LVL_(\w+),\s*"((?:[^"\\]|\\.)*)"\)', src):
+        messages.append((m.group(1), module_names[m.group(2)], m.group(3).lower(),
+                         unescape(m.group(4))))
+    return messages
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+def table_hash(messages):
+    h = 0
+    for i, msg in enumerate(messages):
+        h ^= (fnv1a(msg[3].encode('utf-8')) + i) & 0xffffffff
+    return h
+
+
+def parse_args(rec):
+    args = []
+    i = HEADER_LEN
+    while i < len(rec):
+        tag = chr(rec[i])
+        if tag == 'i':
+            args.append(('i', struct.unpack_from('<i', rec, i + 1)[0]))
+            i += 5
+        elif tag == 'u':
+            args.append(('u', struct.unpack_from('<I', rec, i + 1)[0]))
+            i += 5
+        elif tag == 'q':
+            args.append(('q', struct.unpack_from('<q', rec, i + 1)[0]))
+            i += 9
+        elif tag == 'f':
+            args.append(('f', struct.unpack_from('<f', rec, i + 1)[0]))
+            i += 5
+        elif tag == 's':
+            n = rec[i + 1]
+            args.append(('s', rec[i + 2:i + 2 + n].decode('utf-8', 'replace')))
+            i += 2 + n
+        else:
+            break
+    return args
+
+
+SPEC = re.compile(r'%(%|([-+ #0]*\d*(?:\.\d+)?)[hlzjt]*([diuxXcfFeEgGs]))')
+
+
+# Same rules as formatLogRecord(): the argument's tag decides the type
+def render(fmt, args):
+    it = iter(args)
+
+    def one(m):
+        if m.group(1) == '%':
+            return '%'
+        flags, conv = m.group(2), m.group(3)
+        tag, value = next(it, (None, None))
+        if tag == 's' and conv == 's':
+            return ('%' + flags + 's') % value
+        if tag == 'f' and conv in 'fFeEgG':
+            return ('%' + flags + conv) % value
+        if tag in ('i', 'u', 'q') and conv in 'diuxXc':
+            return ('%' + flags + ('d' if conv in 'iu' else conv)) % value
+        return '?'
+    return SPEC.sub(one, fmt)
+
+
+# CRC-8, polynomial 0x07, as logCrc8()
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xff if crc & 0x80 else (crc << 1) & 0xff
+    return crc
+
+
+def decode(stream, out, messages):
+    expected = table_hash(messages)
+    text = codecs.getincrementaldecoder('utf-8')('replace')
+    buf = b''
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, 'read1') else stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            at = buf.find(SYNC)
+            if at < 0:
+                # Keep a trailing A5 in case the sync is split across reads
+                keep = 1 if buf.endswith(SYNC[:1]) else 0
+                out.write(text.decode(buf[:len(buf) - keep]))
+                buf = buf[len(buf) - keep:]
+                break
+            out.write(text.decode(buf[:at]))
+            buf = buf[at:]
+            if len(buf) < 3 or len(buf) < 3 + buf[2]:
+                break
+            n = buf[2]
+            rec = buf[2:2 + n]
+            if n < HEADER_LEN or crc8(rec) != buf[2 + n]:
+                out.write(text.decode(buf[:1]))
+                buf = buf[1:]
+                continue
+            buf = buf[3 + n:]
+            ident, ms = struct.unpack_from('<HI', rec, 1)
+            args = parse_args(rec)
+            if ident >= len(messages):
+                out.write('[%10.3f] <unknown log id %d>\n' % (ms / 1000, ident))
+                continue
+            name, module, level, fmt = messages[ident]
+            out.write('[%10.3f] %-5s %-6s %s\n' % (ms / 1000, level, module, render(fmt, args)))
+            if name == 'LOG_STARTED' and args and args[0][1] != expected:
+                sys.stderr.write('warning: firmware log table %08x, LogMessages.h is %08x\n'
+                                 % (args[0][1], expected))
+    out.write(text.decode(buf, final=True))
+
+
+if __name__ == '__main__':
+    messages = load_table(TABLE)
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], 'rb') as f:
+            decode(f, sys.stdout, messages)
+    else:
+        decode(sys.stdin.buffer, sys.stdout, messages)
@@ -0,0 +1,125 @@
+# Fits the plant simulator (PlantPhysics.h) to the logs in an RTDB export
+# and writes the parameters to PlantPhysicsFit.h. Uses only rows with a
+# real epoch timestamp and a good DHT read. Hours are as logged (UTC).
+# The export's soil sensor reads higher when drier; the firmware's mood
+# rules take higher as wetter, so soil is flipped (4095 - raw) to match.
+# Re-run after collecting more data:
+#   python3 fit_physics.py ["../../smartplantsensor-default-rtdb-export (2).json"]
+import json
+import math
+import os
+import statistics as st
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+    HERE, '..', '..', 'smartplantsensor-default-rtdb-export (2).json')
+OUT = os.path.join(HERE, 'PlantPhysicsFit.h')
+ADC_MAX = 4095
+HOUR_MS = 3600000
+DAY_MS = 24 * HOUR_MS
+
+with open(SRC, encoding='utf-8') as f:
+    data = json.load(f)
+logs = [l for l in data['plants']['plant1']['logs'].values()
+        if l.get('timestamp', 0) > 1e12 and l.get('temp_c', -100) > -50 and l.get('hum', -1) >= 0]
+logs.sort(key=lambda l: l['timestamp'])
+if len(logs) < 48:
+    sys.exit('only %d usable rows in %s' % (len(logs), SRC))
+
+
+def hour(l):
+    return (l['timestamp'] % DAY_MS) / HOUR_MS
+
+
+def by_day(rows):
+    days = {}
+    for l in rows:
+        days.setdefault(l['timestamp'] // DAY_MS, []).append(l)
+    return [v for v in days.values() if len(v) >= 12]
+
+
+def soil(l):
+    return ADC_MAX - l['soil_raw']
+
+
+def vapour(l):
+    # Magnus formula, hPa
+    t = l['temp_c']
+    return l['hum'] / 100 * 6.112 * math.exp(17.62 * t / (243.12 + t))
+
+
+# Light: mean per hour of day, and how much whole days vary around it
+light = []
+for h in range(24):
+    v = [l['light_raw'] for l in logs if int(hour(l)) == h]
+    light.append(st.mean(v) if v else 0.0)
+day_ratio = []
+for rows in by_day(logs):
+    expected = st.mean(light[int(hour(l))] for l in rows)
+    if expected > 100:
+        day_ratio.append(st.mean(l['light_raw'] for l in rows) / expected)
+light_day_std = st.pstdev(day_ratio) if len(day_ratio) > 1 else 0.2
+
+# Temperature: first harmonic of the hourly means, spread of daily means
+# (the mean is over hours, so evenings with dense logging don't skew it)
+temp_h = [st.mean([l['temp_c'] for l in logs if int(hour(l)) == h] or [0]) for h in range(24)]
+temp_mean = st.mean(temp_h)
+a = sum((temp_h[h] - temp_mean) * math.cos(2 * math.pi * h / 24) for h in range(24)) / 12
+b = sum((temp_h[h] - temp_mean) * math.sin(2 * math.pi * h / 24) for h in range(24)) / 12
+temp_amp = math.hypot(a, b)
+temp_peak = (math.atan2(b, a) * 24 / (2 * math.pi)) % 24
+temp_day_std = st.pstdev(st.mean(l['temp_c'] for l in rows) for rows in by_day(logs))
+
+# Humidity: vapour pressure is what the room holds; RH follows temperature
+vap = [vapour(l) for l in logs]
+vap_mean = st.mean(vap)
+vap_day_std = st.pstdev(st.mean(vapour(l) for l in rows) for rows in by_day(logs))
+
+# Soil: consecutive rows. Big rises are waterings; the rest give the drying
+# rate, which grows as the soil dries (rate = r0 + gain * (wet - raw)).
+waterings = []
+drying = []
+for p, q in zip(logs, logs[1:]):
+    if not (0 < p['soil_raw'] < ADC_MAX and 0 < q['soil_raw'] < ADC_MAX):
+        continue
+    dt = (q['timestamp'] - p['timestamp']) / HOUR_MS
+    if dt < 5 / 60 or dt > 4:
+        continue
+    dr = soil(q) - soil(p)
+    if dr > 150:
+        waterings.append((soil(p), soil(q)))
+    elif -120 < dr / dt < 60:
+        drying.append(((soil(p) + soil(q)) / 2, -dr / dt, dt))
+soil_wet = st.median(w[1] for w in waterings) if waterings else 1200.0
+soil_water_at = st.median(w[0] for w in waterings) if waterings else 800.0
+W = sum(d[2] for d in drying)
+mx = sum((soil_wet - d[0]) * d[2] for d in drying) / W
+my = sum(d[1] * d[2] for d in drying) / W
+gain = (sum(d[2] * (soil_wet - d[0] - mx) * (d[1] - my) for d in drying) /
+        sum(d[2] * (soil_wet - d[0] - mx) ** 2 for d in drying))
+r0 = my - gain * mx
+
+
+def num(v):
+    s = '%.4g' % v
+    return s + ('f' if '.' in s or 'e' in s else '.0f')
+
+
+with open(OUT, 'w') as f:
+    f.write('// Generated by fit_physics.py from %d logged readings - do not edit.\n\n'
+            % len(logs))
+    f.write('#pragma once\n\n#include "PlantPhysics.h"\n\n')
+    f.write('const PhysicsParams FITTED_PHYSICS = {\n')
+    f.write('  {%s},\n' % ', '.join(num(v) for v in light))
+    f.write('  %s,   // lightDayStd\n' % num(light_day_std))
+    f.write('  %s, %s, %s, %s,   // temp mean, amp, peak hour, day std\n'
+            % (num(temp_mean), num(temp_amp), num(temp_peak), num(temp_day_std)))
+    f.write('  %s, %s,   // vapour mean, day std (hPa)\n' % (num(vap_mean), num(vap_day_std)))
+    f.write('  %s, %s,   // soil after watering, watered below\n'
+            % (num(soil_wet), num(soil_water_at)))
+    f.write('  %s, %s   // drying r0 (counts/h), gain (1/h)\n' % (num(r0), num(gain)))
+    f.write('};\n')
+
+print('Physics fit: %d rows, %d waterings, %d drying spans' %
+      (len(logs), len(waterings), len(drying)))
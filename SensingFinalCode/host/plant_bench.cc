@@ -0,0 +1,2078 @@
+// Smart Plant Buddy - microbenchmarks for the firmware hot paths
+//
+// Times the code that runs every reading or every frame on the device:
+// the JSON/CSV/binary serializers (and the old Arduino String JSON next to
+// them), mood classification and the mood face/text lookups, ADC
+// decimation and the filters, composing and pushing an OLED frame, the
+// status log line (formatted at once, as a deferred record, and formatted
+// later from the record), the reading queue, and the scheduler's own
+// overhead per tick. Each benchmark is scaled until one run takes at
+// least --min-time seconds, run --repetitions times, and the median is
+// reported, with heap allocations per iteration. Inputs cycle through a
+// fixed set of readings so nothing can be folded away at compile time.
+//
+//   g++ -std=gnu++17 -O2 -DNDEBUG -pthread host/plant_bench.cc -o plant_bench
+//   ./plant_bench --json bench.json
+//   ./plant_bench --filter mood/
+//
+// --json writes the Google Benchmark JSON layout, so two runs can be
+// diffed with its tools/compare.py (compare.py benchmarks old.json new.json).
+// Host numbers only show relative change; the ESP32 is ~10-20x slower.
+//
+// --check runs the behaviour checks instead: scenarios played through
+// PlantCore on LinuxHal's virtual clock, each printing what it saw and
+// ok or FAIL. The exit status is 1 if any failed.
+//
+//   ./plant_bench --check
+//   ./plant_bench --check --filter conn/
+//
+// The mood and filter checks replay the readings in the RTDB export
+// (--export, relative to SensingFinalCode by default); the mood ones add a
+// threshold sweep. The OLED check compares each status screen with the
+// images in --golden (host/golden); --update-golden rewrites them.
+
+#include <stdarg.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <math.h>
+#include <atomic>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include "../Reading.h"
+#include "../ReadingJson.h"
+#include "../ReadingCodec.h"
+#include "../LiveFrame.h"
+#include "../FirebaseBatch.h"
+#include "../MoodRules.h"
+#include "../PlantProfiles.h"
+#include "../AdcDecimator.h"
+#include "../Hal.h"
+#include "../Filters.h"
+#include "../PlantConfig.h"
+#include "../OledView.h"
+#include "../StatusScreen.h"
+#include "../Ssd1306Emu.h"
+#include "../DeferredLog.h"
+#include "../PlantCore.h"
+#include "../ReadingQueue.h"
+#include "HostCanvas.h"
+#include "LinuxHal.h"
+#include "PlantPhysicsFit.h"
+#include "RtdbTree.h"
+
+//  HARNESS
+
+typedef void (*BenchFn)(uint64_t iterations);
+
+struct Bench {
+  const char* name;
+  BenchFn fn;
+};
+
+struct BenchResult {
+  uint64_t iterations;
+  double realNs;   // per iteration
+  double cpuNs;
+  double allocs;
+};
+
+// Every operator new in the process, plus the String model's mallocs.
+// Kept out of line, or GCC takes the free() in delete for a mismatch.
+static std::atomic<uint64_t> heapAllocs(0);
+
+__attribute__((noinline)) void* operator new(size_t size) {
+  heapAllocs.fetch_add(1, std::memory_order_relaxed);
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { free(p); }
+
+// Keeps a value alive without storing it anywhere
+template <class T>
+inline void keep(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+static double nowNs(clockid_t clock) {
+  timespec ts;
+  clock_gettime(clock, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static BenchResult runOnce(BenchFn fn, uint64_t iterations) {
+  double real0 = nowNs(CLOCK_MONOTONIC);
+  double cpu0 = nowNs(CLOCK_PROCESS_CPUTIME_ID);
+  uint64_t allocs0 = heapAllocs.load();
+  fn(iterations);
+  BenchResult r;
+  r.iterations = iterations;
+  r.allocs = (double)(heapAllocs.load() - allocs0) / iterations;
+  r.realNs = (nowNs(CLOCK_MONOTONIC) - real0) / iterations;
+  r.cpuNs = (nowNs(CLOCK_PROCESS_CPUTIME_ID) - cpu0) / iterations;
+  return r;
+}
+
+// Grow the iteration count until a run lasts minTime, then take the
+// median of the repetitions
+static BenchResult measure(BenchFn fn, double minTimeS, int repetitions) {
+  uint64_t n = 1;
+  BenchResult r = runOnce(fn, n);
+  while (r.realNs * n < minTimeS * 1e9 && n < (1ull << 40)) {
+    double want = minTimeS * 1e9 / (r.realNs > 0.1 ? r.realNs : 0.1) * 1.2;
+    n = want > n * 10.0 ? n * 10 : (uint64_t)want + 1;
+    r = runOnce(fn, n);
+  }
+  BenchResult runs[16];
+  if (repetitions > 16) repetitions = 16;
+  for (int i = 0; i < repetitions; i++) runs[i] = runOnce(fn, n);
+  for (int i = 1; i < repetitions; i++) {
+    for (int j = i; j > 0 && runs[j].realNs < runs[j - 1].realNs; j--) {
+      BenchResult t = runs[j];
+      runs[j] = runs[j - 1];
+      runs[j - 1] = t;
+    }
+  }
+  return runs[repetitions / 2];
+}
+
+//  INPUTS
+
+const size_t INPUTS = 64;   // power of two
+static Reading readings[INPUTS];
+static Mood moods[INPUTS];
+static uint16_t adcRaw[INPUTS];
+static MoodTable moodTable;      // inferMood()'s limits
+static MoodTable profileTable;   // spider_plant
+
+static void makeInputs() {
+  WaveformSource soil(2600, 900, 23, 60, 1);
+  WaveformSource light(1500, 1400, 17, 80, 2);
+  WaveformSource temp(220, 80, 29, 5, 3);
+  WaveformSource hum(450, 200, 31, 20, 4);
+  for (size_t i = 0; i < INPUTS; i++) {
+    Reading& r = readings[i];
+    r.timestampMs = 1765394865000LL + i * 60000;
+    r.soil = soil.next();
+    r.light = light.next();
+    r.tempC = temp.next() / 10.0f;
+    r.hum = hum.next() / 10.0f;
+    r.uptimeMs = i * 1000;
+    moods[i] = (Mood)(i % MOOD_COUNT);
+    adcRaw[i] = soil.next();
+  }
+  moodTable.compileDefault();
+  profileTable.compile(*findPlantProfile(PLANT_PROFILES, PLANT_PROFILE_COUNT, "spider_plant"));
+}
+
+//  SERIALIZERS
+
+static void benchJsonFirebase(uint64_t n) {
+  char buf[READING_JSON_MAX];
+  for (uint64_t i = 0; i < n; i++) {
+    size_t len = writeReadingJson(buf, sizeof(buf), readings[i % INPUTS], moods[i % INPUTS], JSON_FIREBASE);
+    keep(len);
+    keep(buf);
+  }
+}
+
+static void benchJsonWebSocket(uint64_t n) {
+  char buf[READING_JSON_MAX];
+  for (uint64_t i = 0; i < n; i++) {
+    size_t len = writeReadingJson(buf, sizeof(buf), readings[i % INPUTS], moods[i % INPUTS], JSON_WEBSOCKET);
+    keep(len);
+    keep(buf);
+  }
+}
+
+// The old firmware's Arduino String, the way arduino-esp32's WString does
+// it: up to STRING_SSO_CHARS inline, past that a heap buffer realloc'd to
+// the exact new length on every concat. Every malloc/realloc counts.
+const size_t STRING_SSO_CHARS = 10;
+
+class ArduinoString {
+ public:
+  ArduinoString(const char* s = "") : heap_(nullptr), len_(0) { append(s, strlen(s)); }
+  explicit ArduinoString(long long v) : heap_(nullptr), len_(0) {
+    char t[24];
+    append(t, snprintf(t, sizeof(t), "%lld", v));
+  }
+  explicit ArduinoString(int v) : ArduinoString((long long)v) {}
+  ArduinoString(float v, int decimals) : heap_(nullptr), len_(0) {   // dtostrf()
+    char t[48];
+    append(t, snprintf(t, sizeof(t), "%.*f", decimals, v));
+  }
+  ArduinoString(const ArduinoString& o) : heap_(nullptr), len_(0) { append(o.c_str(), o.len_); }
+  ArduinoString(ArduinoString&& o) : heap_(o.heap_), len_(o.len_) {
+    memcpy(sso_, o.sso_, sizeof(sso_));
+    o.heap_ = nullptr;
+    o.len_ = 0;
+  }
+  ArduinoString& operator=(const ArduinoString&) = delete;
+  ~ArduinoString() { free(heap_); }
+
+  ArduinoString& operator+=(const char* s) {
+    append(s, strlen(s));
+    return *this;
+  }
+  ArduinoString& operator+=(const ArduinoString& s) {
+    append(s.c_str(), s.len_);
+    return *this;
+  }
+
+  const char* c_str() const { return heap_ ? heap_ : sso_; }
+  size_t length() const { return len_; }
+
+ private:
+  void append(const char* s, size_t n) {
+    size_t len = len_ + n;
+    if (len > STRING_SSO_CHARS) {
+      char* grown = (char*)realloc(heap_, len + 1);
+      heapAllocs.fetch_add(1, std::memory_order_relaxed);
+      if (!heap_) memcpy(grown, sso_, len_);
+      heap_ = grown;
+    }
+    char* at = heap_ ? heap_ : sso_;
+    memcpy(at + len_, s, n);
+    at[len] = '\0';
+    len_ = len;
+  }
+
+  char* heap_;
+  size_t len_;
+  char sso_[STRING_SSO_CHARS + 1];
+};
+
+// "key" + String(x) + ",": a StringSumHelper copy of the left side that
+// each further operand is appended to
+inline ArduinoString operator+(const char* a, const ArduinoString& b) {
+  ArduinoString s(a);
+  s += b;
+  return s;
+}
+
+inline ArduinoString operator+(ArduinoString&& a, const char* b) {
+  a += b;
+  return static_cast<ArduinoString&&>(a);
+}
+
+// postToFirebase()'s body before ReadingJson.h, concat for concat
+static void benchJsonFirebaseString(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    const Reading& r = readings[i % INPUTS];
+    ArduinoString mood(moodToken(moods[i % INPUTS]));
+    ArduinoString json = "{";
+    json += "\"timestamp\":" + ArduinoString(r.timestampMs) + ",";
+    json += "\"soil_raw\":" + ArduinoString(r.soil) + ",";
+    json += "\"light_raw\":" + ArduinoString(r.light) + ",";
+    json += "\"temp_c\":" + ArduinoString(r.tempC, 1) + ",";
+    json += "\"hum\":" + ArduinoString(r.hum, 0) + ",";
+    json += "\"mood\":\"" + mood + "\"";
+    json += "}";
+    keep(json.length());
+    keep(json.c_str()[0]);
+  }
+}
+
+// loop()'s wsData block before ReadingJson.h
+static void benchJsonWebSocketString(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    const Reading& r = readings[i % INPUTS];
+    ArduinoString mood(moodToken(moods[i % INPUTS]));
+    ArduinoString wsData = "{";
+    wsData += "\"soil\":" + ArduinoString(r.soil) + ",";
+    wsData += "\"light\":" + ArduinoString(r.light) + ",";
+    wsData += "\"temp\":" + ArduinoString(r.tempC, 1) + ",";
+    wsData += "\"hum\":" + ArduinoString(r.hum, 0) + ",";
+    wsData += "\"mood\":\"" + mood + "\"";
+    wsData += "}";
+    keep(wsData.length());
+    keep(wsData.c_str()[0]);
+  }
+}
+
+static void benchCsv(uint64_t n) {
+  char buf[160];
+  for (uint64_t i = 0; i < n; i++) {
+    size_t len = writeReadingCsv(buf, sizeof(buf), readings[i % INPUTS], moods[i % INPUTS]);
+    keep(len);
+    keep(buf);
+  }
+}
+
+static void benchBinaryRoundTrip(uint64_t n) {
+  uint8_t buf[READING_BIN_SIZE];
+  Reading out;
+  for (uint64_t i = 0; i < n; i++) {
+    encodeReading(buf, sizeof(buf), readings[i % INPUTS]);
+    keep(buf);
+    bool ok = decodeReading(buf, sizeof(buf), out);
+    keep(ok);
+    keep(out);
+  }
+}
+
+static void benchLiveFrame(uint64_t n) {
+  uint8_t buf[LIVE_FRAME_SIZE];
+  for (uint64_t i = 0; i < n; i++) {
+    size_t len = writeLiveFrame(buf, sizeof(buf), (uint32_t)i, readings[i % INPUTS], moods[i % INPUTS]);
+    keep(len);
+    keep(buf);
+  }
+}
+
+static uint32_t benchRandom() {
+  static uint32_t s = 1;
+  s ^= s << 13;
+  s ^= s >> 17;
+  s ^= s << 5;
+  return s;
+}
+
+// One upload body of four readings, as flushBatch() builds it with
+// BATCH_SIZE = 4; fixed so the figure doesn't move with the default
+const size_t BENCH_BATCH_SIZE = 4;
+
+static void benchBatchJson(uint64_t n) {
+  static ReadingBatch<BATCH_CAPACITY> batch;
+  static char body[ReadingBatch<BATCH_CAPACITY>::BODY_MAX];
+  PushIdGenerator ids(benchRandom);
+  while (batch.count() < BENCH_BATCH_SIZE) {
+    batch.add(readings[batch.count()], moods[batch.count()], 0, ids);
+  }
+  for (uint64_t i = 0; i < n; i++) {
+    size_t written = 0;
+    size_t len = batch.writeJson(body, sizeof(body), BENCH_BATCH_SIZE, &written);
+    keep(len);
+    keep(body);
+  }
+}
+
+//  MOOD
+
+// inferMood() as it was before MoodRules.h, for the replay check and as
+// the if-chain the tables replaced
+static Mood inferMoodBaseline(int soil, int ldr, float tempC) {
+  bool tooDry = soil < 1500;
+  bool goodSoil = (soil >= 1500 && soil <= 3100);
+  bool tooWet = soil > 3500;
+  bool tooBright = ldr > 2500;
+  bool tooHot = tempC >= 27.0;
+
+  if (tooDry) return MOOD_THIRSTY;
+  if (tooWet) return MOOD_DROWNING;
+  if (tooBright || tooHot) return MOOD_HOT;
+  if (goodSoil) return MOOD_HAPPY;
+  return MOOD_OK;
+}
+
+static void benchMoodIfChain(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    const Reading& r = readings[i % INPUTS];
+    Mood m = inferMoodBaseline(r.soil, r.light, r.tempC);
+    keep(m);
+  }
+}
+
+static void benchMoodClassify(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    Mood m = moodTable.classify(readings[i % INPUTS]);
+    keep(m);
+  }
+}
+
+// Eight rules instead of five
+static void benchMoodClassifyProfile(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    Mood m = profileTable.classify(readings[i % INPUTS]);
+    keep(m);
+  }
+}
+
+static void benchMoodTracker(uint64_t n) {
+  MoodTracker tracker;
+  for (uint64_t i = 0; i < n; i++) {
+    Mood m = tracker.update(moodTable, readings[i % INPUTS]);
+    keep(m);
+  }
+}
+
+static void benchMoodFaceText(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    const char* face = moodFace(moods[i % INPUTS]);
+    const char* text = moodText(moods[i % INPUTS]);
+    keep(face);
+    keep(text);
+  }
+}
+
+//  SAMPLING
+
+// Per ADC sample: one channel push, plus a take() per finished window
+static void benchAdcDecimate(uint64_t n) {
+  AdcDecimator<2> decimator(100);
+  for (uint64_t i = 0; i < n; i++) {
+    decimator.push(i & 1, adcRaw[i % INPUTS]);
+    if (decimator.ready()) {
+      uint16_t soil = decimator.take(ADC_SOIL);
+      uint16_t light = decimator.take(ADC_LIGHT);
+      keep(soil);
+      keep(light);
+    }
+  }
+}
+
+static void benchSoilFilter(uint64_t n) {
+  SoilFilter filter;
+  for (uint64_t i = 0; i < n; i++) {
+    fix_t v = filter.update(toFix((int)adcRaw[i % INPUTS]));
+    keep(v);
+  }
+}
+
+static void benchTempFilter(uint64_t n) {
+  TempFilter filter;
+  for (uint64_t i = 0; i < n; i++) {
+    fix_t v = filter.update(toFix(readings[i % INPUTS].tempC));
+    keep(v);
+  }
+}
+
+//  OLED
+
+static HostCanvas canvas;
+static StatusScreen<HostCanvas> screen(canvas);
+static Ssd1306Emu panel;
+
+// A refresh where only the soil value moved, composed and pushed
+static void benchOledValue(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    screen.update(2000 + (i & 1), 22.4f, 40, MOOD_OK);
+    pushDirty(panel, canvas.getBuffer(), screen.view().dirty());
+  }
+  keep(panel.bytes());
+}
+
+// A mood change redraws the face and caption
+static void benchOledMood(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    screen.update(2000, 22.4f, 40, moods[i % INPUTS]);
+    pushDirty(panel, canvas.getBuffer(), screen.view().dirty());
+  }
+  keep(panel.bytes());
+}
+
+// Title, labels and every field, as after invalidate()
+static void benchOledFull(uint64_t n) {
+  for (uint64_t i = 0; i < n; i++) {
+    screen.invalidate();
+    screen.update(2000, 22.4f, 40, MOOD_OK);
+    pushDirty(panel, canvas.getBuffer(), screen.view().dirty());
+  }
+  keep(panel.bytes());
+}
+
+//  LOG
+
+// The status line, formatted on the spot like the old per-loop printf
+static void benchLogFormat(uint64_t n) {
+  char line[160];
+  for (uint64_t i = 0; i < n; i++) {
+    const Reading& r = readings[i % INPUTS];
+    int len = snprintf(line, sizeof(line), LOG_FORMATS[LOG_STATUS], r.soil, r.light, r.tempC,
+                       r.hum, moodToken(moods[i % INPUTS]));
+    keep(len);
+    keep(line);
+  }
+}
+
+// What the task pays now: record and ring copy, drained by the consumer
+static DeferredLog<LOG_RING_BYTES> deferredLog;
+
+static void benchLogRecord(uint64_t n) {
+  uint8_t rec[LOG_RECORD_MAX];
+  for (uint64_t i = 0; i < n; i++) {
+    const Reading& r = readings[i % INPUTS];
+    deferredLog.write(LOG_STATUS, (uint32_t)i, r.soil, r.light, r.tempC, r.hum,
+                      moodToken(moods[i % INPUTS]));
+    deferredLog.pop(rec);
+    keep(rec);
+  }
+}
+
+// What loop() pays later in text mode
+static void benchLogRender(uint64_t n) {
+  uint8_t rec[LOG_RECORD_MAX];
+  char line[160];
+  const Reading& r = readings[0];
+  deferredLog.write(LOG_STATUS, 0, r.soil, r.light, r.tempC, r.hum, moodToken(moods[0]));
+  deferredLog.pop(rec);
+  for (uint64_t i = 0; i < n; i++) {
+    size_t len = formatLogRecord(rec, line, sizeof(line));
+    keep(len);
+    keep(line);
+  }
+}
+
+//  QUEUE
+
+// Reading n of a stream: uptimeMs is the sequence number, and the other
+// fields follow from it so a torn copy shows
+static Reading queueItem(uint64_t n) {
+  Reading r;
+  memset(&r, 0, sizeof(r));
+  r.uptimeMs = n;
+  r.soil = (int)(n % 4096);
+  r.light = (int)((n >> 12) % 4096);
+  r.tempC = (float)(n % 1000);
+  return r;
+}
+
+static bool queueItemOk(const Reading& r) {
+  return r.soil == (int)(r.uptimeMs % 4096) && r.light == (int)((r.uptimeMs >> 12) % 4096) &&
+         r.tempC == (float)(r.uptimeMs % 1000);
+}
+
+// Push and pop on one thread: the ring's own cost, no cache line traffic
+static void benchQueuePushPop(uint64_t n) {
+  static SpscQueue<Reading, 16> q;
+  Reading r = readings[0], out;
+  for (uint64_t i = 0; i < n; i++) {
+    r.uptimeMs = i;
+    q.push(r);
+    q.pop(out);
+    keep(out);
+  }
+}
+
+// A producer and a consumer thread on the 16-slot ring that readingQueue_
+// uses, yielding when it is full or empty; time per reading through it.
+// On one host CPU this is mostly context switches.
+static void benchQueueThreads(uint64_t n) {
+  static SpscQueue<Reading, 16> q;
+  std::thread consumer([n] {
+    Reading out;
+    for (uint64_t got = 0; got < n;) {
+      if (q.pop(out)) got++;
+      else std::this_thread::yield();
+    }
+    keep(out);
+  });
+  Reading r = readings[0];
+  for (uint64_t i = 0; i < n; i++) {
+    r.uptimeMs = i;
+    while (!q.push(r)) std::this_thread::yield();
+  }
+  consumer.join();
+}
+
+//  SCHEDULER
+
+// A clock that only moves when told, like LinuxHal's
+static unsigned long schedMs = 0;
+static unsigned long schedClockMs() { return schedMs; }
+static unsigned long schedClockUs() { return schedMs * 1000; }
+static unsigned long schedRuns = 0;
+static void schedNop() { schedRuns++; }
+
+static void fillScheduler(Scheduler& s) {
+  for (uint8_t i = 0; i < Scheduler::MAX_TASKS; i++) s.add("t", schedNop, 1000 + i, 0, 1000 + i);
+}
+
+// A full table with nothing due: what every idle loop() pass pays
+static void benchSchedIdle(uint64_t n) {
+  Scheduler s(schedClockMs, schedClockUs);
+  fillScheduler(s);
+  for (uint64_t i = 0; i < n; i++) keep(s.tick() + s.msUntilNext());
+}
+
+// A full table with a task due every tick; the task itself is empty
+static void benchSchedRun(uint64_t n) {
+  Scheduler s(schedClockMs, schedClockUs);
+  fillScheduler(s);
+  for (uint64_t i = 0; i < n; i++) {
+    schedMs += 84;   // 12 tasks at ~1 s: one comes due about every 84 ms
+    keep(s.tick());
+  }
+  keep(schedRuns);
+}
+
+// PlantCore::loopTick() between tasks, on LinuxHal with its clock stopped
+static void benchSchedLoopIdle(uint64_t n) {
+  LinuxHalConfig c = {1, 0, 0, nullptr, true, nullptr, nullptr, 0, 0};
+  WaveformSensors sensors(1);
+  LinuxHal hal(c, sensors);
+  PlantCore core(hal);
+  core.setLogLevel(LOG_LVL_OFF);
+  core.begin("spider_plant");
+  while (core.loopTick()) {}
+  for (uint64_t i = 0; i < n; i++) keep(core.loopTick());
+}
+
+//  CHECKS
+
+typedef bool (*CheckFn)();
+
+struct Check {
+  const char* name;
+  CheckFn fn;
+};
+
+// Prints the failure and passes ok through, so a check can && them
+static bool expect(bool ok, const char* fmt, ...) {
+  if (!ok) {
+    va_list args;
+    va_start(args, fmt);
+    printf("    FAIL: ");
+    vprintf(fmt, args);
+    printf("\n");
+    va_end(args);
+  }
+  return ok;
+}
+
+// A core on a quiet LinuxHal, or on a subclass that watches it
+template <class HalT>
+struct BasicSimDevice {
+  explicit BasicSimDevice(const LinuxHalConfig& c)
+    : sensors(c.seed), hal(c, sensors), core(hal) {}
+
+  // What setup() does
+  void boot(const char* plant = "spider_plant") {
+    core.setLogLevel(LOG_LVL_OFF);
+    core.begin(plant);
+    core.beginNet();
+  }
+
+  static LinuxHalConfig config(uint32_t seed) {
+    LinuxHalConfig c = {seed, 0, 0, nullptr, true, nullptr, nullptr, 0, 0};
+    return c;
+  }
+
+  // Ticks everything due, then moves the clock on a step, until ms has
+  // passed; each() runs after every step
+  template <class F>
+  void run(unsigned long ms, unsigned long stepMs, F each) {
+    core.makeCurrent();   // the trampolines reach the last core constructed
+    unsigned long end = hal.millis() + ms;
+    while (hal.millis() < end) {
+      bool ran;
+      do {
+        ran = core.sensorTick();
+        ran |= core.loopTick();
+        ran |= core.netTick();
+      } while (ran);
+      each();
+      hal.advance(stepMs);
+    }
+  }
+
+  WaveformSensors sensors;
+  HalT hal;
+  PlantCore core;
+};
+
+typedef BasicSimDevice<LinuxHal> SimDevice;
+
+//  CHECKS: BOOT
+
+// Nothing is broadcast, drawn or classified from the boot placeholder
+// (soil 0, -100 C), which used to read as thirsty for the first second:
+// the first live frame and OLED update carry the first published reading,
+// and go out in the pass that reading arrives in
+static bool checkFirstBroadcast() {
+  SimDevice d(SimDevice::config(5));
+  d.boot("nosuch");
+  d.core.liveConnected(0);
+  unsigned long frameAtMs = 0, readingAtMs = 0, drawnAtMs = 0;
+  int frameSoil = 0;
+  d.run(5000, 1, [&] {
+    if (!frameAtMs && d.hal.liveFrames() > 0) {
+      frameAtMs = d.hal.millis();
+      frameSoil = d.core.current().soil;
+      readingAtMs = d.core.current().uptimeMs;
+    }
+    if (!drawnAtMs && d.hal.statusUpdates() > 0) drawnAtMs = d.hal.millis();
+  });
+  printf("    first reading at %lu ms; first frame at %lu ms (soil %d), first OLED at %lu ms; "
+         "%u changes to thirsty\n", readingAtMs, frameAtMs, frameSoil, drawnAtMs,
+         d.core.moodTransitions(MOOD_OK, MOOD_THIRSTY));
+  bool ok = expect(frameAtMs && readingAtMs && frameSoil > 0, "first frame sent before any reading");
+  ok = expect(frameAtMs == readingAtMs && drawnAtMs == readingAtMs,
+              "frame or OLED lagged the first reading") && ok;
+  return expect(d.core.moodTransitions(MOOD_OK, MOOD_THIRSTY) == 0,
+                "mood went thirsty on a soil %d plant", frameSoil) && ok;
+}
+
+//  CHECKS: CONNECTION
+
+const uint8_t BACKOFF_FAILS = 9;   // reaches the WIFI_BACKOFF_MAX_MS cap
+
+struct BackoffTrace {
+  unsigned long delays[16];
+  uint8_t count;
+  unsigned long syncedAtMs;
+};
+
+// Backoff delays until the link is time-synced, from boot or from now
+static void traceBackoff(SimDevice& d, unsigned long ms, BackoffTrace& t) {
+  t.count = 0;
+  t.syncedAtMs = 0;
+  ConnState last = d.core.connection().state();
+  d.run(ms, 100, [&] {
+    ConnState s = d.core.connection().state();
+    if (s == last || t.syncedAtMs) return;
+    if (s == CONN_BACKOFF && t.count < 16) t.delays[t.count++] = d.core.connection().lastBackoffMs();
+    if (s == CONN_TIME_SYNCED) t.syncedAtMs = d.hal.millis();
+    last = s;
+  });
+}
+
+static bool delayInRange(unsigned long delay, uint8_t failures) {
+  unsigned long nominal = WIFI_BACKOFF_BASE_MS;
+  for (uint8_t i = 0; i < failures && nominal < WIFI_BACKOFF_MAX_MS; i++) nominal *= 2;
+  if (nominal > WIFI_BACKOFF_MAX_MS) nominal = WIFI_BACKOFF_MAX_MS;
+  return delay >= nominal - nominal / 4 && delay <= nominal + nominal / 4;
+}
+
+// Failed associations back off exponentially with +/-25% jitter up to the
+// cap, the next good one syncs, and a drop after that retries at the base
+// delay again
+static bool checkBackoff() {
+  SimDevice d(SimDevice::config(1));
+  d.hal.failAssociations(BACKOFF_FAILS);
+  d.boot();
+  BackoffTrace t;
+  traceBackoff(d, 3600000, t);
+  printf("    delays (s):");
+  for (uint8_t i = 0; i < t.count; i++) printf(" %.1f", t.delays[i] / 1000.0);
+  printf("; synced at %.1f s\n", t.syncedAtMs / 1000.0);
+  bool ok = expect(t.count == BACKOFF_FAILS, "%u backoffs, want %u", t.count, BACKOFF_FAILS);
+  bool jittered = false;
+  for (uint8_t i = 0; i < t.count; i++) {
+    ok &= expect(delayInRange(t.delays[i], i), "delay %u is %lu ms", i, t.delays[i]);
+    jittered |= !delayInRange(t.delays[i], i) || t.delays[i] % 1000 != 0;
+  }
+  ok &= expect(jittered, "no jitter in the delays");
+  ok &= expect(t.syncedAtMs > 0, "never time-synced");
+  ok &= expect(d.core.connection().attempts() == BACKOFF_FAILS + 1, "%lu attempts",
+               d.core.connection().attempts());
+
+  // Another device's jitter differs, so a fleet doesn't retry in step
+  SimDevice other(SimDevice::config(2));
+  other.hal.failAssociations(BACKOFF_FAILS);
+  other.boot();
+  BackoffTrace o;
+  traceBackoff(other, 3600000, o);
+  ok &= expect(o.count == t.count && memcmp(o.delays, t.delays, t.count * sizeof(t.delays[0])) != 0,
+               "seeds 1 and 2 backed off identically");
+
+  unsigned long droppedAtMs = d.hal.millis();
+  d.hal.dropLink();
+  traceBackoff(d, 60000, t);
+  printf("    after a drop: delay %.1f s, synced again %.1f s later\n",
+         t.count ? t.delays[0] / 1000.0 : 0, t.syncedAtMs ? (t.syncedAtMs - droppedAtMs) / 1000.0 : 0);
+  ok &= expect(t.count == 1 && delayInRange(t.delays[0], 0), "drop: %u backoffs, first %lu ms",
+               t.count, t.count ? t.delays[0] : 0);
+  ok &= expect(t.syncedAtMs > 0, "no recovery after the drop");
+  ok &= expect(d.core.connection().drops() == 1 && d.hal.linkDrops() == 1, "%lu drops",
+               d.core.connection().drops());
+  return ok;
+}
+
+// A link that fails and drops at random still comes back every time
+static bool checkFlappingLink() {
+  LinuxHalConfig c = SimDevice::config(3);
+  c.assocFailRate = 0.5f;
+  c.linkUpMeanMs = 600000;
+  SimDevice d(c);
+  d.boot();
+  unsigned long onlineMs = 0, longestOffMs = 0, offSince = 0;
+  d.run(6 * 3600000UL, 100, [&] {
+    if (d.core.connection().online()) {
+      onlineMs += 100;
+      offSince = d.hal.millis();
+    } else if (d.hal.millis() - offSince > longestOffMs) {
+      longestOffMs = d.hal.millis() - offSince;
+    }
+  });
+  const ConnectionManager& wifi = d.core.connection();
+  printf("    6 h: %lu attempts, %lu failed associations, %lu drops, online %.0f%%, "
+         "longest outage %.0f s\n", wifi.attempts(), d.hal.assocFailures(), d.hal.linkDrops(),
+         100.0 * onlineMs / (6 * 3600000.0), longestOffMs / 1000.0);
+  bool ok = expect(d.hal.linkDrops() > 10 && d.hal.assocFailures() > 10, "link never flapped");
+  ok &= expect(wifi.drops() == d.hal.linkDrops(), "%lu drops seen, %lu made", wifi.drops(),
+               d.hal.linkDrops());
+  // Up to a cap-length wait plus a timeout for every failure in a row
+  ok &= expect(longestOffMs < 30 * 60000, "offline for %lu ms", longestOffMs);
+  return ok;
+}
+
+//  CHECKS: FLASH LOG
+
+const uint32_t FLASH_CHECK_SLOTS = 8;
+const uint32_t FLASH_CHECK_SEGMENT = 4;
+
+// LogStorage that loses power after cutAfter more bytes: the write that
+// crosses the cut lands only its first bytes, and nothing after it does.
+// A remove counts as one byte. freeLimit pretends the flash is fuller.
+class PowerCutStorage : public LogStorage {
+ public:
+  PowerCutStorage(LogStorage& inner, uint64_t cutAfter)
+    : freeLimit(UINT32_MAX), inner_(inner), left_(cutAfter), cut_(false) {}
+
+  bool read(uint8_t file, uint32_t offset, void* buf, size_t len) {
+    return inner_.read(file, offset, buf, len);
+  }
+
+  bool write(uint8_t file, uint32_t offset, const void* buf, size_t len) {
+    if (!take(len)) {
+      if (left_) inner_.write(file, offset, buf, left_);
+      return cutNow();
+    }
+    return inner_.write(file, offset, buf, len);
+  }
+
+  bool append(uint8_t file, const void* buf, size_t len) {
+    if (!take(len)) {
+      if (left_) inner_.append(file, buf, left_);
+      return cutNow();
+    }
+    return inner_.append(file, buf, len);
+  }
+
+  bool remove(uint8_t file) { return take(1) ? inner_.remove(file) : cutNow(); }
+  uint32_t size(uint8_t file) { return inner_.size(file); }
+
+  uint32_t freeBytes() {
+    uint32_t n = inner_.freeBytes();
+    return n < freeLimit ? n : freeLimit;
+  }
+
+  bool cut() const { return cut_; }
+
+  uint32_t freeLimit;
+
+ private:
+  bool take(size_t len) {
+    if (cut_ || len > left_) return false;
+    left_ -= len;
+    return true;
+  }
+
+  bool cutNow() {
+    cut_ = true;
+    return false;
+  }
+
+  LogStorage& inner_;
+  uint64_t left_;
+  bool cut_;
+};
+
+// A fresh directory for a log, and its removal
+static bool flashTempDir(char* path) { return mkdtemp(path) != nullptr; }
+
+static void flashRemoveDir(const char* path) {
+  DIR* dir = opendir(path);
+  if (!dir) return;
+  char file[PATH_MAX];
+  while (dirent* e = readdir(dir)) {
+    if (e->d_name[0] == '.') continue;
+    snprintf(file, sizeof(file), "%s/%s", path, e->d_name);
+    remove(file);
+  }
+  closedir(dir);
+  rmdir(path);
+}
+
+// One boot of a device whose offline log is the directory at path, opened
+// through LinuxHal like PlantCore does
+struct FlashBoot {
+  FlashBoot(const char* path, uint64_t cutAfter = UINT64_MAX)
+    : config(flashConfig(path)), sensors(1), hal(config, sensors),
+      power(*hal.openLogStorage(), cutAfter),
+      log(power, FLASH_CHECK_SLOTS, FLASH_CHECK_SEGMENT) {}
+
+  static LinuxHalConfig flashConfig(const char* path) {
+    LinuxHalConfig c = SimDevice::config(1);
+    c.offlineLog = path;
+    return c;
+  }
+
+  LinuxHalConfig config;
+  WaveformSensors sensors;
+  LinuxHal hal;
+  PowerCutStorage power;
+  FlashLog log;
+};
+
+// Record seq's push ID and reading, so any recovered record can be checked
+static void flashRecord(uint32_t seq, char* key, Reading& r) {
+  snprintf(key, PUSH_ID_LEN + 1, "-Nflash%013u", seq);
+  memset(&r, 0, sizeof(r));
+  r.timestampMs = 1700000000000LL + seq * (long long)POST_INTERVAL_MS;
+  r.soil = (int)(1500 + seq);
+  r.light = (int)(seq * 37 % 4096);
+  r.tempC = 20 + seq % 10 * 0.5f;
+  r.hum = 40 + (float)(seq % 20);
+}
+
+static bool flashAppend(FlashLog& log, uint32_t seq) {
+  char key[PUSH_ID_LEN + 1];
+  Reading r;
+  flashRecord(seq, key, r);
+  return log.append(key, r);
+}
+
+// Every record from the tail on is there, in order, and intact, and
+// nothing else is. A slot torn by a power cut still counts in size().
+static bool flashIntact(FlashLog& log, uint32_t tail, uint32_t head) {
+  if (log.size() < head - tail) return false;
+  FlashRecord recs[FLASH_CHECK_SLOTS + 1];
+  uint32_t next;
+  size_t n = log.peek(recs, FLASH_CHECK_SLOTS + 1, &next);
+  if (n != head - tail) return false;
+  for (size_t i = 0; i < n; i++) {
+    char key[PUSH_ID_LEN + 1];
+    Reading r;
+    flashRecord(tail + (uint32_t)i, key, r);
+    const Reading& got = recs[i].reading;
+    if (recs[i].seq != tail + i || strcmp(recs[i].key, key) != 0 ||
+        got.timestampMs != r.timestampMs || got.soil != r.soil || got.light != r.light ||
+        got.tempC != r.tempC || got.hum != r.hum) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The log every scenario starts from: records 0..head-1 appended, then
+// everything before tail sent (a full ring has dropped some already)
+static void flashSetUp(const char* path, uint32_t tail, uint32_t head) {
+  flashRemoveDir(path);
+  FlashBoot b(path);
+  b.log.open();
+  for (uint32_t s = 0; s < head; s++) flashAppend(b.log, s);
+  b.log.commit(tail);
+}
+
+struct FlashState {
+  uint32_t tail;
+  uint32_t head;
+};
+
+// Power is cut at every byte of one operation on the set-up log
+// (states[0]); after a reboot the log must be in one of states, the last
+// being where the finished operation leaves it, with every record intact
+template <class Op>
+static bool flashCutEverywhere(const char* what, const char* path, Op op,
+                               std::initializer_list<FlashState> states) {
+  const FlashState* s = states.begin();
+  const size_t count = states.size();
+  unsigned seen[4] = {0, 0, 0, 0}, bad = 0, cuts = 0;
+  bool finishedOk = false;
+  for (uint64_t cut = 0;; cut++) {
+    flashSetUp(path, s[0].tail, s[0].head);
+    bool cutHit;
+    {
+      FlashBoot b(path, cut);
+      b.log.open();
+      op(b.log);
+      cutHit = b.power.cut();
+    }
+    FlashBoot reboot(path);
+    reboot.log.open();
+    size_t i = 0;
+    while (i < count && !flashIntact(reboot.log, s[i].tail, s[i].head)) i++;
+    cuts++;
+    if (i == count) bad++;
+    else seen[i]++;
+    if (!cutHit) {   // the operation finished: every byte was tried
+      finishedOk = i == count - 1;
+      break;
+    }
+  }
+  printf("    %s: %u cuts, recovered as", what, cuts);
+  for (size_t i = 0; i < count; i++) {
+    printf("%s [%u,%u) x%u", i ? "," : "", s[i].tail, s[i].head, seen[i]);
+  }
+  printf("\n");
+  return expect(bad == 0, "%s: %u cuts left some other log", what, bad) &&
+         expect(finishedOk, "%s: the finished write did not recover as [%u,%u)", what,
+                s[count - 1].tail, s[count - 1].head);
+}
+
+static bool checkFlashPowerLoss() {
+  char path[] = "/tmp/plant_bench_flash_XXXXXX";
+  if (!flashTempDir(path)) return expect(false, "no temporary directory");
+
+  bool ok;
+  {
+    FlashBoot b(path);
+    b.power.freeLimit = b.log.bytesNeeded() / 2;
+    ok = expect(!b.log.open(), "opened with room for half the ring");
+  }
+  // 2 records in segment 0 (slots 0-3) still unsent, 1 in segment 1
+  // A torn slot: the half-written record fails its CRC
+  ok = flashCutEverywhere("append", path, [](FlashLog& log) { flashAppend(log, 5); },
+                          {{2, 5}, {2, 6}}) && ok;
+  // The first record of a segment, into a file just cleared
+  ok = flashCutEverywhere("new segment", path, [](FlashLog& log) { flashAppend(log, 8); },
+                          {{2, 8}, {2, 9}}) && ok;
+  // A torn cursor: the other copy still holds the old tail. Segment 0 is
+  // then removed, or by the next open() if the cut comes first.
+  ok = flashCutEverywhere("commit", path, [](FlashLog& log) { log.commit(4); },
+                          {{2, 5}, {4, 5}}) && ok;
+  // A full ring drops its oldest segment for a new record
+  const uint32_t full = FLASH_CHECK_SLOTS + FLASH_CHECK_SEGMENT;
+  ok = flashCutEverywhere("overwrite", path, [=](FlashLog& log) { flashAppend(log, full); },
+                          {{4, full}, {8, full}, {8, full + 1}}) && ok;
+  // Two commits, so the cut also lands in the second cursor copy
+  ok = flashCutEverywhere("two commits", path,
+                          [](FlashLog& log) { log.commit(3) && log.commit(4); },
+                          {{2, 5}, {3, 5}, {4, 5}}) && ok;
+  flashRemoveDir(path);
+  return ok;
+}
+
+// A full OFFLINE_LOG_SLOTS ring drained the way backfill does, a
+// BACKFILL_BATCH peek and a commit at a time, through LinuxHal's directory
+static bool checkFlashDrain() {
+  char path[] = "/tmp/plant_bench_flash_XXXXXX";
+  if (!flashTempDir(path)) return expect(false, "no temporary directory");
+  LinuxHalConfig c = FlashBoot::flashConfig(path);
+  WaveformSensors sensors(1);
+  LinuxHal hal(c, sensors);
+  FlashLog log(*hal.openLogStorage(), OFFLINE_LOG_SLOTS, OFFLINE_LOG_SEGMENT);
+  bool ok = log.open();
+  double start = nowNs(CLOCK_MONOTONIC);
+  for (uint32_t s = 0; s < OFFLINE_LOG_SLOTS && ok; s++) ok = flashAppend(log, s);
+  double appendNs = nowNs(CLOCK_MONOTONIC) - start;
+
+  // Recovery scans one slot per segment file
+  FlashLog reopened(*hal.openLogStorage(), OFFLINE_LOG_SLOTS, OFFLINE_LOG_SEGMENT);
+  start = nowNs(CLOCK_MONOTONIC);
+  ok = ok && reopened.open() && reopened.size() == OFFLINE_LOG_SLOTS;
+  double openNs = nowNs(CLOCK_MONOTONIC) - start;
+
+  FlashRecord recs[BACKFILL_BATCH];
+  uint32_t expectSeq = 0, batches = 0, next;
+  start = nowNs(CLOCK_MONOTONIC);
+  while (ok && reopened.size() > 0) {
+    size_t n = reopened.peek(recs, BACKFILL_BATCH, &next);
+    for (size_t i = 0; i < n; i++) ok = ok && recs[i].seq == expectSeq++;
+    ok = ok && reopened.commit(next);
+    batches++;
+  }
+  double drainNs = nowNs(CLOCK_MONOTONIC) - start;
+  printf("    %u slots in segments of %u (%u bytes at most): filled at %.0f records/s, "
+         "reopened full in %.1f ms, drained at %.0f records/s in %u batches\n",
+         OFFLINE_LOG_SLOTS, OFFLINE_LOG_SEGMENT, reopened.bytesNeeded(),
+         OFFLINE_LOG_SLOTS / (appendNs / 1e9), openNs / 1e6, expectSeq / (drainNs / 1e9),
+         batches);
+  flashRemoveDir(path);
+  return expect(ok && expectSeq == OFFLINE_LOG_SLOTS, "drained %u of %u records in order",
+                expectSeq, OFFLINE_LOG_SLOTS);
+}
+
+// Tallies the log records that reach the server and their timestamps
+class DatedHal : public LinuxHal {
+ public:
+  DatedHal(const LinuxHalConfig& config, SimSensors& sensors)
+    : LinuxHal(config, sensors), records(0), undated(0), epochKeys(0), oldestMs(0) {}
+
+  int httpSend(const char* method, const char* path, const char* body, size_t len,
+               PostTiming& t) override {
+    int code = LinuxHal::httpSend(method, path, body, len, t);
+    if (code <= 0 || code >= 400 || strcmp(path, FIREBASE_LOGS_PATH) != 0) return code;
+    for (const char* p = strstr(body, "\"timestamp\":"); p; p = strstr(p + 1, "\"timestamp\":")) {
+      long long ms = atoll(p + 12);
+      records++;
+      if (ms < SIM_EPOCH_MS) undated++;
+      if (!oldestMs || ms < oldestMs) oldestMs = ms;
+    }
+    for (const char* p = strstr(body, "\"--------"); p; p = strstr(p + 1, "\"--------")) {
+      epochKeys++;   // a push ID made from timestamp 0
+    }
+    return code;
+  }
+
+  unsigned long records;
+  unsigned long undated;     // timestamp 0, or anything before the clock was set
+  unsigned long epochKeys;
+  long long oldestMs;
+};
+
+// A device that boots offline takes its first readings before NTP has
+// answered. They go out once the clock is set, back-dated from their
+// uptime: none as 1970 (timestamp 0, "--------" push ID), from RAM or
+// through the offline log.
+static bool checkOfflineStartup() {
+  char path[] = "/tmp/plant_bench_flash_XXXXXX";
+  if (!flashTempDir(path)) return expect(false, "no temporary directory");
+  BasicSimDevice<DatedHal> d(FlashBoot::flashConfig(path));
+  d.hal.failAssociations(BACKOFF_FAILS + 5);   // offline through the first two readings
+  d.boot();
+  const unsigned long runMs = 2 * 3600000UL;
+  unsigned long syncedAtMs = 0;
+  d.run(runMs, 100, [&] {
+    if (!syncedAtMs && d.hal.timeValid()) syncedAtMs = d.hal.millis();
+  });
+  flashRemoveDir(path);
+  printf("    clock set at %.1f s; %lu records uploaded, oldest %.1f s after boot, "
+         "%lu undated, %lu epoch push IDs\n", syncedAtMs / 1000.0, d.hal.records,
+         (d.hal.oldestMs - SIM_EPOCH_MS) / 1000.0, d.hal.undated, d.hal.epochKeys);
+  bool ok = expect(syncedAtMs > 2 * POST_INTERVAL_MS, "clock set at %lu ms, before two "
+                   "readings were due", syncedAtMs);
+  ok = expect(d.hal.undated == 0 && d.hal.epochKeys == 0, "%lu records dated before boot, "
+              "%lu epoch push IDs", d.hal.undated, d.hal.epochKeys) && ok;
+  ok = expect(d.hal.records >= runMs / POST_INTERVAL_MS - 1, "%lu records uploaded in %lu min",
+              d.hal.records, runMs / 60000) && ok;
+  return expect(d.hal.oldestMs && d.hal.oldestMs < SIM_EPOCH_MS + (long long)syncedAtMs,
+                "no reading from before the clock was set went out") && ok;
+}
+
+// LogStorage that counts what goes to flash
+class CountingStorage : public LogStorage {
+ public:
+  explicit CountingStorage(LogStorage& inner)
+    : bytes(0), cursorWrites(0), inPlaceWrites(0), removes(0), largest(0), inner_(inner) {}
+
+  bool read(uint8_t file, uint32_t offset, void* buf, size_t len) {
+    return inner_.read(file, offset, buf, len);
+  }
+
+  bool write(uint8_t file, uint32_t offset, const void* buf, size_t len) {
+    count(len);
+    if (file == FlashLog::CURSOR_FILE) cursorWrites++;
+    else inPlaceWrites++;
+    return inner_.write(file, offset, buf, len);
+  }
+
+  bool append(uint8_t file, const void* buf, size_t len) {
+    count(len);
+    return inner_.append(file, buf, len);
+  }
+
+  bool remove(uint8_t file) {
+    removes++;
+    return inner_.remove(file);
+  }
+
+  uint32_t size(uint8_t file) { return inner_.size(file); }
+  uint32_t freeBytes() { return inner_.freeBytes(); }
+
+  uint64_t bytes;
+  unsigned long cursorWrites;
+  unsigned long inPlaceWrites;   // into a segment file rather than at its end
+  unsigned long removes;
+  size_t largest;
+
+ private:
+  void count(size_t len) {
+    bytes += len;
+    if (len > largest) largest = len;
+  }
+
+  LogStorage& inner_;
+};
+
+// Bytes to flash per append, offline long enough to wrap the ring twice and
+// then backfilling a BACKFILL_BATCH every fourth reading. Every segment
+// write must be an append, and no append may write more than its slot and
+// one cursor (when it drops a segment).
+static bool checkFlashWrites() {
+  char path[] = "/tmp/plant_bench_flash_XXXXXX";
+  if (!flashTempDir(path)) return expect(false, "no temporary directory");
+  LinuxHalConfig c = FlashBoot::flashConfig(path);
+  WaveformSensors sensors(1);
+  LinuxHal hal(c, sensors);
+  CountingStorage counted(*hal.openLogStorage());
+  FlashLog log(counted, OFFLINE_LOG_SLOTS, OFFLINE_LOG_SEGMENT);
+  bool ok = log.open();
+  uint64_t before = counted.bytes, maxAppend = 0;
+  uint32_t seq = 0, appends = 0;
+  FlashRecord recs[BACKFILL_BATCH];
+  for (uint32_t i = 0; i < 3 * OFFLINE_LOG_SLOTS && ok; i++) {
+    uint64_t at = counted.bytes;
+    ok = flashAppend(log, seq++);
+    appends++;
+    if (counted.bytes - at > maxAppend) maxAppend = counted.bytes - at;
+    if (i >= 2 * OFFLINE_LOG_SLOTS && i % 4 == 0) {
+      uint32_t next;
+      log.peek(recs, BACKFILL_BATCH, &next);
+      ok = ok && log.commit(next);
+    }
+  }
+  double perAppend = (double)(counted.bytes - before) / appends;
+  printf("    %u appends, %lu records dropped: %.1f bytes to flash per append (slot %zu), at "
+         "most %llu in one; largest write %zu; %lu cursor writes, %lu in-place segment "
+         "writes, %lu removes\n", appends, log.dropped(), perAppend, FlashLog::SLOT_SIZE,
+         (unsigned long long)maxAppend, counted.largest, counted.cursorWrites,
+         counted.inPlaceWrites, counted.removes);
+  flashRemoveDir(path);
+  ok = expect(ok, "an append or commit failed") && ok;
+  ok = expect(counted.inPlaceWrites == 0, "%lu writes into a segment file",
+              counted.inPlaceWrites) && ok;
+  ok = expect(maxAppend <= FlashLog::SLOT_SIZE + FlashLog::CURSOR_SIZE,
+              "one append wrote %llu bytes", (unsigned long long)maxAppend) && ok;
+  return expect(perAppend < FlashLog::SLOT_SIZE + 2, "%.1f bytes per append", perAppend) && ok;
+}
+
+//  CHECKS: QUEUE
+
+const uint64_t QUEUE_STRESS_ITEMS = 2000000;
+
+// One std::thread producer, one consumer, on the ring sizes PlantCore
+// uses. The producer retries when full, so every reading must arrive once,
+// in order and intact.
+template <size_t N>
+static bool queueStressLossless() {
+  SpscQueue<Reading, N> q;
+  std::thread producer([&q] {
+    for (uint64_t i = 0; i < QUEUE_STRESS_ITEMS; i++) {
+      Reading r = queueItem(i);
+      while (!q.push(r)) std::this_thread::yield();
+    }
+  });
+  uint64_t next = 0, bad = 0;
+  Reading r;
+  while (next < QUEUE_STRESS_ITEMS) {
+    if (!q.pop(r)) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (r.uptimeMs != next || !queueItemOk(r)) bad++;
+    next = r.uptimeMs + 1;
+  }
+  producer.join();
+  bool ok = expect(bad == 0, "%llu readings out of order or torn", (unsigned long long)bad);
+  ok = expect(q.empty() && !q.pop(r), "ring not empty at the end") && ok;
+  printf("    %zu slots: %llu readings, %lu full pushes retried\n", N,
+         (unsigned long long)QUEUE_STRESS_ITEMS, q.dropped());
+  return ok;
+}
+
+static bool checkQueueLossless() {
+  bool ok = queueStressLossless<16>();
+  return queueStressLossless<8>() && ok;
+}
+
+// The sensor task never waits: a push into a full ring is dropped. What
+// arrives must still be in order with no duplicates, and arrived +
+// dropped must be everything pushed.
+static bool checkQueueDropping() {
+  SpscQueue<Reading, 16> q;
+  std::atomic<bool> done(false);
+  std::thread producer([&] {
+    // A drop is not retried, but like the sensor task between ticks the
+    // producer then lets the consumer run
+    for (uint64_t i = 0; i < QUEUE_STRESS_ITEMS; i++) {
+      if (!q.push(queueItem(i))) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+  });
+  uint64_t arrived = 0, bad = 0, last = 0;
+  Reading r;
+  for (;;) {
+    bool finished = done.load(std::memory_order_acquire);
+    if (!q.pop(r)) {
+      if (finished) break;
+      std::this_thread::yield();
+      continue;
+    }
+    if ((arrived > 0 && r.uptimeMs <= last) || !queueItemOk(r)) bad++;
+    last = r.uptimeMs;
+    arrived++;
+  }
+  producer.join();
+  printf("    %llu pushed: %llu arrived, %lu dropped\n", (unsigned long long)QUEUE_STRESS_ITEMS,
+         (unsigned long long)arrived, q.dropped());
+  bool ok = expect(bad == 0, "%llu readings out of order, repeated or torn",
+                   (unsigned long long)bad);
+  return expect(arrived + q.dropped() == QUEUE_STRESS_ITEMS, "%llu readings lost",
+                (unsigned long long)(QUEUE_STRESS_ITEMS - arrived - q.dropped())) && ok;
+}
+
+//  CHECKS: SCHEDULER
+
+// Device costs for the loop() core's fake clock
+const unsigned ESP_SLOWDOWN = 20;                // host CPU time x this, the slow end
+const float OLED_I2C_US_PER_BYTE = 9 * 1e6f / 400000;   // 9 bit times at OLED_I2C_HZ
+const unsigned long WS_SERVICE_US = 50;          // webSocket.loop() with nothing to read
+const unsigned long WS_SEND_US = 200;            // one frame into lwIP
+const unsigned long WS_LATENCY_MAX_US = 5000;
+const unsigned WS_LATENCY_RUNS = 3;
+
+// LinuxHal that does the loop core's I/O the way EspHal does and charges
+// its device time: the OLED through StatusScreen and pushDirty() into an
+// emulated panel at the I2C rate, live frames at WS_SEND_US each
+class TimedHal : public LinuxHal {
+ public:
+  TimedHal(const LinuxHalConfig& config, SimSensors& sensors)
+    : LinuxHal(config, sensors), screen_(canvas_), chargedUs_(0) {}
+
+  bool showStatus(const Reading& r, Mood mood) override {
+    screen_.update(r.soil, r.tempC, r.hum, mood);
+    OledDirty& dirty = screen_.view().dirty();
+    if (!dirty.any()) return true;
+    unsigned long before = panel_.bytes();
+    bool done = pushDirty(panel_, canvas_.getBuffer(), dirty, OLED_PUSH_BYTES_MAX);
+    chargedUs_ += (unsigned long)((panel_.bytes() - before) * OLED_I2C_US_PER_BYTE);
+    return done;
+  }
+
+  void liveSend(uint8_t, const uint8_t*, size_t, bool) override { chargedUs_ += WS_SEND_US; }
+
+  unsigned long takeChargedUs() {
+    unsigned long us = chargedUs_;
+    chargedUs_ = 0;
+    return us;
+  }
+
+ private:
+  HostCanvas canvas_;
+  StatusScreen<HostCanvas> screen_;
+  Ssd1306Emu panel_;
+  unsigned long chargedUs_;
+};
+
+// loop() services the WebSocket between loopTick()s. The sensor and
+// network tasks tick in between too, but on the device they run on the
+// other core, so the DHT conversions and uploads in flight cost the loop
+// core nothing. Each gap is WS_SERVICE_US, the task's host CPU time times
+// ESP_SLOWDOWN and the I/O it did; a WebSocket client connected in binary
+// and one in text, 6 h of LinuxHal's virtual time. The boot redraw is the
+// worst case: a whole frame is ~23 ms of I2C, hence OLED_PUSH_BYTES_MAX.
+static unsigned long wsLatencyRun() {
+  LinuxHalConfig c = SimDevice::config(4);
+  WaveformSensors sensors(4);
+  TimedHal hal(c, sensors);
+  PlantCore core(hal);
+  core.setLogLevel(LOG_LVL_OFF);
+  core.begin("spider_plant");
+  core.beginNet();
+  core.liveConnected(0);
+  core.liveConnected(1);
+  core.liveText(1, (const uint8_t*)"mode:bin", 8);
+
+  unsigned long maxGapUs = 0, maxAtMs = 0, maxIoUs = 0, loops = 0, tasks = 0;
+  unsigned long uploadsBefore = hal.http().requests();
+  while (hal.millis() < 6 * 3600000UL) {
+    double start = nowNs(CLOCK_THREAD_CPUTIME_ID);
+    bool ran = core.loopTick();
+    unsigned long cpuUs = (unsigned long)((nowNs(CLOCK_THREAD_CPUTIME_ID) - start) / 1000 * ESP_SLOWDOWN);
+    unsigned long ioUs = hal.takeChargedUs();
+    unsigned long gap = WS_SERVICE_US + cpuUs + ioUs;
+    loops++;
+    tasks += ran;
+    if (gap > maxGapUs) {
+      maxGapUs = gap;
+      maxAtMs = hal.millis();
+      maxIoUs = ioUs;
+    }
+    // The other cores
+    while (core.sensorTick() || core.netTick()) {}
+    if (!ran) hal.advance(1);   // delay(1)
+  }
+  printf("    %lu loop() passes, %lu tasks, %lu uploads; longest WebSocket gap %.2f ms "
+         "(%.2f ms I/O) at %.1f s\n", loops, tasks, hal.http().requests() - uploadsBefore,
+         maxGapUs / 1000.0, maxIoUs / 1000.0, maxAtMs / 1000.0);
+  if (hal.http().requests() == uploadsBefore) return ULONG_MAX;
+  return maxGapUs;
+}
+
+// The schedule and I/O are the same every run, the CPU time isn't: a host
+// interrupt or page fault in one tick counts ESP_SLOWDOWN times over. So a
+// run over the limit is repeated, and a real regression fails all of them.
+static bool checkWsLatency() {
+  unsigned long maxGapUs = ULONG_MAX;
+  for (unsigned run = 0; run < WS_LATENCY_RUNS && maxGapUs >= WS_LATENCY_MAX_US; run++) {
+    unsigned long gap = wsLatencyRun();
+    if (gap < maxGapUs) maxGapUs = gap;
+  }
+  if (!expect(maxGapUs != ULONG_MAX, "no uploads went out")) return false;
+  return expect(maxGapUs < WS_LATENCY_MAX_US, "WebSocket waited %lu us", maxGapUs);
+}
+
+//  CHECKS: LATENCY
+
+const uint32_t LATENCY_RESET_ITEMS = 2000000;
+const uint32_t LATENCY_RESET_SAMPLE = 1000;
+
+// "latency:reset" arrives on loop() while the sensor and network tasks
+// record. One thread records, another asks for resets throughout; the
+// recorder must end with a consistent histogram, and a pending reset must
+// read as empty until the recorder catches up.
+static bool checkLatencyReset() {
+  static LatencyHistogram h;
+  std::atomic<bool> done(false);
+  std::thread recorder([&] {
+    for (uint32_t i = 0; i < LATENCY_RESET_ITEMS; i++) {
+      h.record(LATENCY_RESET_SAMPLE);
+      if ((i & 1023) == 0) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+  });
+  uint32_t resets = 0;
+  while (!done.load(std::memory_order_acquire)) {
+    h.requestReset();
+    resets++;
+    std::this_thread::yield();
+  }
+  recorder.join();
+  uint32_t n = h.count();
+  printf("    %u samples, %u resets asked; %u samples since the last one\n", LATENCY_RESET_ITEMS,
+         resets, n);
+  bool ok = expect(n <= LATENCY_RESET_ITEMS, "%u samples counted", n);
+  ok = expect(n == 0 || (h.max() == LATENCY_RESET_SAMPLE &&
+                         h.percentile(500) == LATENCY_RESET_SAMPLE),
+              "%u samples but max %u, p50 %u", n, h.max(), h.percentile(500)) && ok;
+  h.record(LATENCY_RESET_SAMPLE);
+  h.requestReset();
+  ok = expect(h.count() == 0 && h.max() == 0 && h.percentile(500) == 0,
+              "pending reset reads %u samples", h.count()) && ok;
+  h.record(7);
+  return expect(h.count() == 1 && h.max() == 7, "after the reset: %u samples, max %u",
+                h.count(), h.max()) && ok;
+}
+
+//  CHECKS: HEAP
+
+const uint32_t HEAP_COUNT_ITEMS = 1000000;
+
+// plant_fleet runs many devices per thread, each phase under a HeapScope.
+// Two threads count allocations as the hooks do, each in a scope; each
+// scope must be charged exactly its own thread's.
+static bool checkHeapPerThread() {
+  PhaseAllocs phases[2];
+  memset(phases, 0, sizeof(phases));
+  auto worker = [&phases](uint8_t t) {
+    HeapScope scope(phases[t]);
+    for (uint32_t i = 0; i < HEAP_COUNT_ITEMS; i++) {
+      countAlloc(t + 1);
+      countFree();
+      if ((i & 1023) == 0) std::this_thread::yield();
+    }
+  };
+  std::thread other(worker, 1);
+  worker(0);
+  other.join();
+  bool ok = true;
+  for (uint8_t t = 0; t < 2; t++) {
+    printf("    thread %u: %lu allocs, %lu bytes\n", t, (unsigned long)phases[t].allocs,
+           (unsigned long)phases[t].bytes);
+    ok = expect(phases[t].allocs == HEAP_COUNT_ITEMS &&
+                phases[t].bytes == HEAP_COUNT_ITEMS * (t + 1u),
+                "thread %u charged %lu allocs", t, (unsigned long)phases[t].allocs) && ok;
+  }
+  return ok;
+}
+
+//  CHECKS: MOOD
+
+static const char* exportPath = "../smartplantsensor-default-rtdb-export (2).json";
+
+// Every plants/<id>/logs reading in the RTDB export, in key order
+static bool loadExport(std::vector<Reading>& out) {
+  FILE* f = fopen(exportPath, "rb");
+  if (!f) return false;
+  std::string text;
+  char buf[65536];
+  size_t got;
+  while ((got = fread(buf, 1, sizeof(buf), f)) > 0) text.append(buf, got);
+  fclose(f);
+  RtdbNode root;
+  if (!RtdbParser(text.data(), text.size()).parse(root)) return false;
+  const RtdbNode* plants = rtdbChild(root, {"plants"});
+  if (!plants) return false;
+  for (const auto& plant : plants->children) {
+    const RtdbNode* logs = rtdbChild(plant.second, {"logs"});
+    if (!logs) continue;
+    for (const auto& log : logs->children) {
+      const RtdbNode* soil = rtdbChild(log.second, {"soil_raw"});
+      const RtdbNode* light = rtdbChild(log.second, {"light_raw"});
+      const RtdbNode* temp = rtdbChild(log.second, {"temp_c"});
+      const RtdbNode* hum = rtdbChild(log.second, {"hum"});
+      if (!soil || !light || !temp || !hum) continue;
+      Reading r;
+      memset(&r, 0, sizeof(r));
+      r.soil = atoi(soil->leaf.c_str());
+      r.light = atoi(light->leaf.c_str());
+      r.tempC = (float)atof(temp->leaf.c_str());
+      r.hum = (float)atof(hum->leaf.c_str());
+      out.push_back(r);
+    }
+  }
+  return !out.empty();
+}
+
+// The recorded readings, then a sweep across every default threshold
+static void moodReplayInputs(std::vector<Reading>& out, size_t& recorded) {
+  if (!loadExport(out)) printf("    no export at %s, sweep only\n", exportPath);
+  recorded = out.size();
+  Reading r;
+  memset(&r, 0, sizeof(r));
+  r.hum = 40;
+  for (int soil = 1300; soil <= 3700; soil++) {
+    r.soil = soil;
+    for (int light : {0, 2400, 2500, 2501, 4095}) {
+      r.light = light;
+      for (float temp : {-100.0f, 20.0f, 26.9f, 26.99f, 26.999f, 27.0f, 27.001f, 27.1f, 40.0f}) {
+        r.tempC = temp;
+        out.push_back(r);
+      }
+    }
+  }
+}
+
+// Unknown ids classify exactly as inferMood() did
+static bool checkDefaultMoods() {
+  std::vector<Reading> inputs;
+  size_t recorded;
+  moodReplayInputs(inputs, recorded);
+  size_t mismatches = 0;
+  for (const Reading& r : inputs) {
+    Mood old = inferMoodBaseline(r.soil, r.light, r.tempC);
+    Mood now = moodTable.classify(r);
+    if (old != now && mismatches++ < 5) {
+      expect(false, "soil %d light %d temp %.3f: was %s, now %s", r.soil, r.light, r.tempC,
+             moodToken(old), moodToken(now));
+    }
+  }
+  printf("    %zu recorded + %zu swept readings, %zu differ\n", recorded, inputs.size() - recorded,
+         mismatches);
+  return mismatches == 0;
+}
+
+// With hysteresis, moods only differ from inferMood()'s near a threshold,
+// and change less often
+static bool checkMoodHysteresis() {
+  std::vector<Reading> inputs;
+  if (!loadExport(inputs)) printf("    no export at %s, synthetic trace only\n", exportPath);
+  // Plus a slow soil drift with sensor noise across each soil threshold
+  WaveformSource soil(2500, 1200, 5000, 60, 7);
+  WaveformSource temp(260, 20, 3000, 4, 8);
+  for (int i = 0; i < 20000; i++) {
+    Reading r;
+    memset(&r, 0, sizeof(r));
+    r.soil = soil.next();
+    r.light = 1200;
+    r.tempC = temp.next() / 10.0f;
+    r.hum = 40;
+    inputs.push_back(r);
+  }
+  const MoodBands& b = DEFAULT_MOOD_BANDS;
+  MoodTracker tracker;
+  Mood lastOld = MOOD_COUNT, lastNew = MOOD_COUNT;
+  unsigned oldChanges = 0, newChanges = 0, differ = 0;
+  bool ok = true;
+  for (const Reading& r : inputs) {
+    Mood old = inferMoodBaseline(r.soil, r.light, r.tempC);
+    Mood now = tracker.update(moodTable, r);
+    oldChanges += old != lastOld;
+    newChanges += now != lastNew;
+    lastOld = old;
+    lastNew = now;
+    if (old == now) continue;
+    differ++;
+    bool near = fabsf(r.soil - DEFAULT_SOIL_DRY) <= b.soil ||
+                fabsf(r.soil - DEFAULT_SOIL_HAPPY_MAX) <= b.soil ||
+                fabsf(r.soil - DEFAULT_SOIL_WET) <= b.soil ||
+                fabsf(r.light - DEFAULT_LIGHT_BRIGHT) <= b.light ||
+                fabsf(r.tempC - DEFAULT_TEMP_HOT) <= b.temp;
+    ok &= expect(near, "soil %d light %d temp %.2f: %s vs %s away from any threshold", r.soil,
+                 r.light, r.tempC, moodToken(old), moodToken(now));
+  }
+  printf("    %zu readings: %u mood changes before, %u with hysteresis; %u differ, all near a "
+         "threshold\n", inputs.size(), oldChanges, newChanges, differ);
+  ok &= expect(newChanges < oldChanges, "hysteresis didn't cut the changes");
+  return ok;
+}
+
+// The fitted plant through the whole firmware, as plant_sim runs it: the
+// pot dries between waterings, so the mood just before each one must be
+// thirsty, and it must never read as drowning.
+const unsigned long DRYING_HOURS = 120;
+
+static bool checkDryingMood() {
+  LinuxHalConfig c = SimDevice::config(7);
+  PlantPhysics physics(FITTED_PHYSICS, c.seed, SIM_EPOCH_MS);
+  LinuxHal hal(c, physics);
+  PlantCore core(hal);
+  core.setLogLevel(LOG_LVL_OFF);
+  core.begin("spider_plant");
+  core.beginNet();
+
+  unsigned long waterings = 0, notThirsty = 0, drowningMs = 0, thirstyMs = 0, lastMs = 0;
+  while (hal.millis() < DRYING_HOURS * PHYSICS_HOUR_MS) {
+    bool ran = core.sensorTick();
+    ran |= core.loopTick();
+    ran |= core.netTick();
+    Mood mood = core.mood();
+    if (physics.waterings() != waterings) {
+      waterings = physics.waterings();
+      if (mood != MOOD_THIRSTY) {
+        notThirsty++;
+        printf("    watered at %.1f h while %s\n", hal.millis() / 3600000.0, moodToken(mood));
+      }
+    }
+    if (ran) continue;
+    unsigned long wait = core.msUntilNext();
+    if (wait == 0) wait = 1;
+    hal.advance(wait);
+    if (mood == MOOD_DROWNING) drowningMs += hal.millis() - lastMs;
+    if (mood == MOOD_THIRSTY) thirstyMs += hal.millis() - lastMs;
+    lastMs = hal.millis();
+  }
+  printf("    %lu h: watered %lu times; thirsty %.1f h, drowning %.1f h\n", DRYING_HOURS,
+         waterings, thirstyMs / 3600000.0, drowningMs / 3600000.0);
+  bool ok = expect(waterings >= 2, "watered only %lu times", waterings);
+  ok = expect(notThirsty == 0, "%lu waterings while not thirsty", notThirsty) && ok;
+  return expect(drowningMs == 0, "drowning for %.1f h", drowningMs / 3600000.0) && ok;
+}
+
+//  CHECKS: OLED
+
+static const char* goldenDir = "host/golden";
+static bool updateGolden = false;
+
+struct StatusState {
+  const char* name;
+  int soil;
+  float temp;
+  float hum;
+  Mood mood;
+};
+
+// A reading per mood, and the screen with the DHT down
+static const StatusState STATUS_STATES[] = {
+  {"ok", 2350, 23.4f, 48, MOOD_OK},
+  {"happy", 3300, 24.0f, 55, MOOD_HAPPY},
+  {"thirsty", 1200, 22.6f, 41, MOOD_THIRSTY},
+  {"drowning", 3900, 21.0f, 63, MOOD_DROWNING},
+  {"hot", 2800, 31.5f, 35, MOOD_HOT},
+  {"no_dht", 2350, -100, -1, MOOD_OK},
+};
+
+// Each state composed by StatusScreen on HostCanvas and pushed into
+// Ssd1306Emu, whose PBM must match host/golden/status_<state>.pbm byte for
+// byte. --update-golden rewrites the files instead (look at them first:
+// pnmtopng status_ok.pbm > status_ok.png).
+static bool checkStatusGolden() {
+  bool ok = true;
+  for (const StatusState& s : STATUS_STATES) {
+    HostCanvas canvas;
+    StatusScreen<HostCanvas> screen(canvas);
+    Ssd1306Emu panel;
+    const uint8_t begin[] = {0x20, 0x00, 0xAF};   // Adafruit_SSD1306::begin(): horizontal, on
+    panel.command(begin, sizeof(begin));
+    screen.update(s.soil, s.temp, s.hum, s.mood);
+    pushDirty(panel, canvas.getBuffer(), screen.view().dirty());
+    ok = expect(panel.matches(canvas.getBuffer()), "%s: panel differs from the framebuffer",
+                s.name) && ok;
+
+    char* image = nullptr;
+    size_t imageLen = 0;
+    FILE* mem = open_memstream(&image, &imageLen);
+    panel.writePbm(mem);
+    fclose(mem);
+    char path[256];
+    snprintf(path, sizeof(path), "%s/status_%s.pbm", goldenDir, s.name);
+    if (updateGolden) {
+      FILE* f = fopen(path, "wb");
+      ok = expect(f && fwrite(image, 1, imageLen, f) == imageLen, "cannot write %s", path) && ok;
+      if (f) fclose(f);
+      printf("    wrote %s\n", path);
+    } else {
+      std::string golden;
+      FILE* f = fopen(path, "rb");
+      char buf[4096];
+      size_t got;
+      while (f && (got = fread(buf, 1, sizeof(buf), f)) > 0) golden.append(buf, got);
+      if (f) fclose(f);
+      ok = expect(f != nullptr, "no golden image %s", path) &&
+           expect(!f || (golden.size() == imageLen && memcmp(golden.data(), image, imageLen) == 0),
+                  "%s: screen differs from %s", s.name, path) && ok;
+    }
+    free(image);
+  }
+  printf("    %zu states against %s\n", sizeof(STATUS_STATES) / sizeof(STATUS_STATES[0]),
+         goldenDir);
+  return ok;
+}
+
+//  CHECKS: DHT
+
+struct DhtCase {
+  DhtType type;
+  float tempMin, tempMax;   // swept in tenths
+  float humMax;
+  float humStep;            // resolution on the wire
+};
+
+// Frames from either sensor decode to what was sent over its whole range,
+// a flipped bit fails the checksum, and each type gets a start pulse in
+// its datasheet window (the driver holds it a tick and a poll longer)
+static bool checkDhtDecode() {
+  static const DhtCase cases[] = {
+    {DHT_TYPE_11, 0, 50, 90, 1},
+    {DHT_TYPE_22, -40, 80, 99.9f, 0.1f},
+  };
+  bool ok = true;
+  for (const DhtCase& c : cases) {
+    unsigned frames = 0, bad = 0, unflagged = 0;
+    float worstT = 0, worstH = 0;
+    for (int i = 0; c.tempMin + i * 0.1f <= c.tempMax + 0.01f; i++) {
+      float t = c.tempMin + i * 0.1f;
+      float h = roundf(fmodf(i * 7.3f, c.humMax) / c.humStep) * c.humStep;
+      uint32_t times[DHT_MAX_EDGES];
+      uint8_t levels[DHT_MAX_EDGES];
+      uint8_t n = encodeDhtEdges(c.type, t, h, times, levels);
+      float dt, dh;
+      frames++;
+      if (!decodeDhtEdges(times, levels, n, c.type, dt, dh)) {
+        bad++;
+        continue;
+      }
+      worstT = fmaxf(worstT, fabsf(dt - t));
+      worstH = fmaxf(worstH, fabsf(dh - h));
+      uint8_t k = 4 + 2 * (i % 40);   // stretch or shorten one bit's high
+      if (times[k] - times[k - 1] > 48) times[k] -= 43;
+      else times[k] += 43;
+      if (decodeDhtEdges(times, levels, n, c.type, dt, dh)) unflagged++;
+    }
+    unsigned long startMs = dhtStartMs(c.type);
+    printf("    DHT%u: %u frames, %u failed, off by at most %.2f C / %.2f%%, %u flipped bits "
+           "passed; start pulse %lu-%lu ms\n", (unsigned)c.type, frames, bad, worstT, worstH,
+           unflagged, startMs, startMs + 1 + DHT_POLL_MS);
+    ok = expect(bad == 0 && worstT < 0.051f && worstH < 0.051f, "DHT%u: %u of %u frames "
+                "failed, off by %.2f C / %.2f%%", (unsigned)c.type, bad, frames, worstT,
+                worstH) && ok;
+    ok = expect(unflagged == 0, "DHT%u: %u flipped bits passed the checksum",
+                (unsigned)c.type, unflagged) && ok;
+  }
+  ok = expect(dhtStartMs(DHT_TYPE_11) >= 18, "DHT11 start %lu ms, needs 18",
+              dhtStartMs(DHT_TYPE_11)) && ok;
+  return expect(dhtStartMs(DHT_TYPE_22) >= 1 && dhtStartMs(DHT_TYPE_22) + 1 + DHT_POLL_MS <= 10,
+                "DHT22 start %lu ms, needs 1-10", dhtStartMs(DHT_TYPE_22)) && ok;
+}
+
+//  CHECKS: FILTERS
+
+// The filter stages in double, for the Q24.8 ones to be held against.
+// RefChain<SoilFilter> mirrors whatever chain PlantConfig.h picks.
+template <class Stage>
+struct RefStage;
+
+template <uint8_t N>
+struct RefStage<MedianFilter<N> > {
+  RefStage() : count(0), next(0) {}
+  double update(double x) {
+    ring[next] = x;
+    next = (next + 1) % N;
+    if (count < N) count++;
+    double sorted[N];
+    for (uint8_t i = 0; i < count; i++) {
+      uint8_t j = i;
+      for (; j > 0 && sorted[j - 1] > ring[i]; j--) sorted[j] = sorted[j - 1];
+      sorted[j] = ring[i];
+    }
+    return count & 1 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+  }
+  double ring[N];
+  uint8_t count, next;
+};
+
+template <uint8_t SHIFT>
+struct RefStage<EmaFilter<SHIFT> > {
+  RefStage() : y(0), primed(false) {}
+  double update(double x) {
+    y = primed ? y + (x - y) / (1 << SHIFT) : x;
+    primed = true;
+    return y;
+  }
+  double y;
+  bool primed;
+};
+
+template <fix_t Q, fix_t R>
+struct RefStage<KalmanFilter<Q, R> > {
+  RefStage() : x(0), p((double)R / FIX_ONE), primed(false) {}
+  double update(double z) {
+    if (!primed) {
+      primed = true;
+      return x = z;
+    }
+    p += (double)Q / FIX_ONE;
+    double k = p / (p + (double)R / FIX_ONE);
+    x += k * (z - x);
+    p *= 1 - k;
+    return x;
+  }
+  double x, p;
+  bool primed;
+};
+
+template <>
+struct RefStage<NoFilter> {
+  double update(double x) { return x; }
+};
+
+template <class Chain>
+struct RefChain;
+
+template <class... Stages>
+struct RefChain<FilterChain<Stages...> > {
+  double update(double x) {
+    return apply(x, std::index_sequence_for<Stages...>());
+  }
+  template <size_t... I>
+  double apply(double x, std::index_sequence<I...>) {
+    ((x = std::get<I>(stages).update(x)), ...);
+    return x;
+  }
+  std::tuple<RefStage<Stages>...> stages;
+};
+
+// CPU cycles from perf when the kernel allows it, else TSC ticks
+struct CycleCounter {
+  CycleCounter() : fd(-1) {
+    perf_event_attr a;
+    memset(&a, 0, sizeof(a));
+    a.type = PERF_TYPE_HARDWARE;
+    a.size = sizeof(a);
+    a.config = PERF_COUNT_HW_CPU_CYCLES;
+    a.exclude_kernel = 1;
+    a.exclude_hv = 1;
+    fd = (int)syscall(SYS_perf_event_open, &a, 0, -1, -1, 0);
+  }
+  ~CycleCounter() {
+    if (fd >= 0) close(fd);
+  }
+  const char* unit() const { return fd >= 0 ? "cycles" : "TSC ticks"; }
+  uint64_t now() const {
+    uint64_t v = 0;
+    if (fd >= 0 && read(fd, &v, sizeof(v)) == sizeof(v)) return v;
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+  }
+  int fd;
+};
+
+// One channel of the trace through its fixed-point chain and the double
+// reference. maxErr is in the channel's units; the chain must stay under
+// half of what the channel is shown to (a count, or 0.1 C).
+template <class Chain>
+static bool filterTrace(const char* name, const std::vector<double>& trace, double maxErr,
+                        const CycleCounter& cycles) {
+  Chain fixed;
+  RefChain<Chain> ref;
+  double worst = 0, sumSq = 0;
+  for (double x : trace) {
+    double err = fabs(fixToFloat(fixed.update(toFix((float)x))) - ref.update(x));
+    if (err > worst) worst = err;
+    sumSq += err * err;
+  }
+
+  // Cost per sample, the trace replayed until it has run 1M samples
+  const size_t rounds = 1000000 / trace.size() + 1;
+  std::vector<fix_t> in;
+  for (double x : trace) in.push_back(toFix((float)x));
+  Chain timed;
+  uint64_t c0 = cycles.now();
+  double t0 = nowNs(CLOCK_THREAD_CPUTIME_ID);
+  for (size_t r = 0; r < rounds; r++) {
+    for (fix_t x : in) keep(timed.update(x));
+  }
+  double samples = (double)rounds * in.size();
+  double ns = (nowNs(CLOCK_THREAD_CPUTIME_ID) - t0) / samples;
+  double perSample = (cycles.now() - c0) / samples;
+  printf("    %-5s %.1f %s/sample (%.1f ns); error vs double: max %.4f, rms %.4f\n", name,
+         perSample, cycles.unit(), ns, worst, sqrt(sumSq / trace.size()));
+  return expect(worst < maxErr, "%s: Q24.8 off by %.4f (limit %.4f)", name, worst, maxErr);
+}
+
+// The four channels' chains on the readings in the RTDB export
+static bool checkFilterTrace() {
+  std::vector<Reading> recorded;
+  if (!loadExport(recorded)) return expect(false, "no export at %s", exportPath);
+  std::vector<double> soil, light, temp, hum;
+  for (const Reading& r : recorded) {
+    soil.push_back(r.soil);
+    light.push_back(r.light);
+    if (r.tempC > -100) temp.push_back(r.tempC);
+    if (r.hum >= 0) hum.push_back(r.hum);
+  }
+  printf("    %zu recorded readings\n", recorded.size());
+  CycleCounter cycles;
+  bool ok = filterTrace<SoilFilter>("soil", soil, 0.5, cycles);
+  ok = filterTrace<LightFilter>("light", light, 0.5, cycles) && ok;
+  ok = filterTrace<TempFilter>("temp", temp, 0.05, cycles) && ok;
+  return filterTrace<HumFilter>("hum", hum, 0.5, cycles) && ok;
+}
+
+static const Check CHECKS[] = {
+  {"boot/first_broadcast", checkFirstBroadcast},
+  {"conn/backoff", checkBackoff},
+  {"conn/flapping_link", checkFlappingLink},
+  {"flashlog/power_loss", checkFlashPowerLoss},
+  {"flashlog/drain", checkFlashDrain},
+  {"flashlog/bytes_per_append", checkFlashWrites},
+  {"flashlog/offline_startup", checkOfflineStartup},
+  {"queue/lossless", checkQueueLossless},
+  {"queue/dropping", checkQueueDropping},
+  {"sched/ws_latency", checkWsLatency},
+  {"latency/reset", checkLatencyReset},
+  {"heap/per_thread_counts", checkHeapPerThread},
+  {"mood/default_matches_infer_mood", checkDefaultMoods},
+  {"mood/hysteresis", checkMoodHysteresis},
+  {"mood/drying_pot", checkDryingMood},
+  {"dht/decode", checkDhtDecode},
+  {"filters/q24_8_trace", checkFilterTrace},
+  {"oled/golden_status", checkStatusGolden},
+};
+
+static const Bench BENCHES[] = {
+  {"serialize/json_firebase", benchJsonFirebase},
+  {"serialize/json_websocket", benchJsonWebSocket},
+  {"serialize/json_firebase_string", benchJsonFirebaseString},
+  {"serialize/json_websocket_string", benchJsonWebSocketString},
+  {"serialize/csv", benchCsv},
+  {"serialize/binary_roundtrip", benchBinaryRoundTrip},
+  {"serialize/live_frame", benchLiveFrame},
+  {"serialize/batch_json", benchBatchJson},
+  {"mood/infer_mood_if_chain", benchMoodIfChain},
+  {"mood/classify", benchMoodClassify},
+  {"mood/classify_profile", benchMoodClassifyProfile},
+  {"mood/tracker", benchMoodTracker},
+  {"mood/face_text", benchMoodFaceText},
+  {"sampling/adc_decimate", benchAdcDecimate},
+  {"sampling/soil_filter", benchSoilFilter},
+  {"sampling/temp_filter", benchTempFilter},
+  {"oled/value_change", benchOledValue},
+  {"oled/mood_change", benchOledMood},
+  {"oled/full_frame", benchOledFull},
+  {"log/status_printf", benchLogFormat},
+  {"log/status_record", benchLogRecord},
+  {"log/status_render", benchLogRender},
+  {"queue/push_pop", benchQueuePushPop},
+  {"queue/two_threads", benchQueueThreads},
+  {"sched/tick_idle", benchSchedIdle},
+  {"sched/tick_run", benchSchedRun},
+  {"sched/loop_idle", benchSchedLoopIdle},
+};
+
+static void writeJson(FILE* f, const char* argv0, const Bench* const* run,
+                      const BenchResult* results, size_t count, int repetitions) {
+  char date[32];
+  time_t t = time(nullptr);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&t));
+  char host[64] = "";
+  gethostname(host, sizeof(host) - 1);
+  fprintf(f, "{\n  \"context\": {\n");
+  fprintf(f, "    \"date\": \"%s\",\n    \"host_name\": \"%s\",\n    \"executable\": \"%s\",\n",
+          date, host, argv0);
+  fprintf(f, "    \"num_cpus\": %ld,\n", sysconf(_SC_NPROCESSORS_ONLN));
+#ifdef NDEBUG
+  fprintf(f, "    \"library_build_type\": \"release\"\n  },\n");
+#else
+  fprintf(f, "    \"library_build_type\": \"debug\"\n  },\n");
+#endif
+  fprintf(f, "  \"benchmarks\": [\n");
+  for (size_t i = 0; i < count; i++) {
+    fprintf(f, "    {\n      \"name\": \"%s\",\n      \"run_name\": \"%s\",\n"
+               "      \"run_type\": \"iteration\",\n      \"repetitions\": %d,\n"
+               "      \"iterations\": %llu,\n      \"real_time\": %.4f,\n"
+               "      \"cpu_time\": %.4f,\n      \"time_unit\": \"ns\",\n"
+               "      \"allocs_per_iter\": %.4f\n    }%s\n",
+            run[i]->name, run[i]->name, repetitions, (unsigned long long)results[i].iterations,
+            results[i].realNs, results[i].cpuNs, results[i].allocs, i + 1 < count ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+}
+
+int main(int argc, char** argv) {
+  const char* filter = nullptr;
+  const char* jsonPath = nullptr;
+  double minTime = 0.2;
+  int repetitions = 5;
+  bool check = false;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--filter") && more) filter = argv[++i];
+    else if (!strcmp(a, "--json") && more) jsonPath = argv[++i];
+    else if (!strcmp(a, "--min-time") && more) minTime = atof(argv[++i]);
+    else if (!strcmp(a, "--repetitions") && more) repetitions = atoi(argv[++i]);
+    else if (!strcmp(a, "--check")) check = true;
+    else if (!strcmp(a, "--export") && more) exportPath = argv[++i];
+    else if (!strcmp(a, "--golden") && more) goldenDir = argv[++i];
+    else if (!strcmp(a, "--update-golden")) updateGolden = true;
+    else {
+      fprintf(stderr, "usage: %s [--filter SUBSTR] [--json FILE] [--min-time S] [--repetitions N]\n"
+                      "       %s --check [--filter SUBSTR] [--export RTDB_JSON]\n"
+                      "                      [--golden DIR] [--update-golden]\n",
+              argv[0], argv[0]);
+      return 2;
+    }
+  }
+  if (repetitions < 1) repetitions = 1;
+
+  makeInputs();
+  if (check) {
+    int failed = 0;
+    for (const Check& c : CHECKS) {
+      if (filter && !strstr(c.name, filter)) continue;
+      printf("%s\n", c.name);
+      bool ok = c.fn();
+      printf("  %s\n", ok ? "ok" : "FAIL");
+      failed += !ok;
+    }
+    printf("%d check(s) failed\n", failed);
+    return failed ? 1 : 0;
+  }
+  const size_t total = sizeof(BENCHES) / sizeof(BENCHES[0]);
+  const Bench* run[total];
+  BenchResult results[total];
+  size_t count = 0;
+
+  printf("%-32s %12s %12s %14s %8s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations",
+         "Allocs");
+  for (size_t i = 0; i < total; i++) {
+    if (filter && !strstr(BENCHES[i].name, filter)) continue;
+    run[count] = &BENCHES[i];
+    results[count] = measure(BENCHES[i].fn, minTime, repetitions);
+    printf("%-32s %12.2f %12.2f %14llu %8.2f\n", BENCHES[i].name, results[count].realNs,
+           results[count].cpuNs, (unsigned long long)results[count].iterations,
+           results[count].allocs);
+    count++;
+  }
+
+  if (jsonPath) {
+    FILE* f = fopen(jsonPath, "w");
+    if (!f) {
+      perror(jsonPath);
+      return 1;
+    }
+    writeJson(f, argv[0], run, results, count, repetitions);
+    fclose(f);
+  }
+  return 0;
+}
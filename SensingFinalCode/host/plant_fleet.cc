@@ -0,0 +1,247 @@
+// Smart Plant Buddy - a fleet of simulated devices against one backend
+//
+// Runs --devices firmware cores, each on its own LinuxHal with its own
+// WaveformSensors, spread over --threads FleetWorkers (FleetWorker.h),
+// all uploading to an rtdb_server (or anything speaking its REST subset)
+// at /plants/fleet000000/ and on. Devices boot at random points of the
+// --ramp and their clocks run --speed times the wall clock, so each device
+// logs a reading every POST_INTERVAL_MS / speed, uploads them --batch at a
+// time (BATCH_SIZE by default), and sends a health record every
+// 3600 / speed seconds. --listeners holds that
+// many event streams on device logs, the dashboard's view, and times each
+// batch from its PATCH to its event.
+//
+// A device costs ~13 us of CPU per virtual second here, nearly all of it
+// the 100 Hz ADC path, so a core keeps up with devices * speed of about
+// 75000; past that, add threads or lower --speed.
+//
+//   g++ -std=gnu++17 -O2 -Wall -pthread host/plant_fleet.cc -o plant_fleet
+//   ./rtdb_server --port 9000 &
+//   ./plant_fleet --server 127.0.0.1:9000 --devices 1000 --speed 60 --duration 150
+//   ./plant_fleet --server 127.0.0.1:9000 --devices 9000 --speed 6 --ramp 60 --duration 900
+//   ./plant_fleet --server 127.0.0.1:9000 --devices 200 --speed 300 --batch 4
+//
+// Reports, per device count, how much of the asked virtual time the
+// devices got through (below 100% the generator is the bottleneck), the
+// upload and reading throughput, body bytes and requests per reading,
+// ingest and end-to-end latency after the ramp, and the CPU used by this
+// process and by the server (from its /.stats.json, when it has one).
+// Every device holds a socket, so the open file limit is raised to its
+// hard limit first.
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <thread>
+#include <vector>
+#include "FleetWorker.h"
+
+const uint8_t FLEET_MAX_SWEEP = 8;
+const uint16_t FLEET_SOCKETS_PER_PROCESS = 64;   // stdio, epoll, server stats, ...
+
+static volatile bool stopRequested = false;
+
+static void onSignal(int) { stopRequested = true; }
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s --server HOST:PORT [--devices N[,N...]] [--threads N]\n"
+          "          [--speed X] [--step-ms N] [--duration S] [--ramp S]\n"
+          "          [--listeners N] [--plant ID] [--seed N] [--batch N]\n",
+          argv0);
+}
+
+static bool resolve(const char* hostPort, sockaddr_in& out, char* host, size_t hostSize) {
+  const char* colon = strrchr(hostPort, ':');
+  size_t n = colon ? (size_t)(colon - hostPort) : strlen(hostPort);
+  if (n == 0 || n >= hostSize) return false;
+  memcpy(host, hostPort, n);
+  host[n] = '\0';
+  addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* res = nullptr;
+  if (getaddrinfo(host, colon ? colon + 1 : "80", &hints, &res) != 0 || !res) return false;
+  memcpy(&out, res->ai_addr, sizeof(out));
+  freeaddrinfo(res);
+  return true;
+}
+
+// Server CPU so far from rtdb_server's /.stats.json; -1 if it has none
+static long long serverCpuUs(const sockaddr_in& server, const char* host) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  timeval tv = {2, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  long long cpu = -1;
+  if (connect(fd, (const sockaddr*)&server, sizeof(server)) == 0) {
+    char buf[2048];
+    int n = snprintf(buf, sizeof(buf), "GET /.stats.json HTTP/1.1\r\nHost: %s\r\n"
+                     "Connection: close\r\n\r\n", host);
+    send(fd, buf, n, MSG_NOSIGNAL);
+    size_t have = 0;
+    ssize_t got;
+    while (have < sizeof(buf) - 1 && (got = recv(fd, buf + have, sizeof(buf) - 1 - have, 0)) > 0) {
+      have += got;
+    }
+    buf[have] = '\0';
+    const char* at = strstr(buf, "\"cpuUs\":");
+    if (strncmp(buf, "HTTP/1.1 200", 12) == 0 && at) cpu = atoll(at + 8);
+  }
+  close(fd);
+  return cpu;
+}
+
+static long long processCpuUs() {
+  rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000LL + ru.ru_utime.tv_usec +
+         ru.ru_stime.tv_usec;
+}
+
+static void printLatency(const char* label, const LatencyHistogram& h) {
+  printf("  %s: %u samples, p50 %.1f ms, p99 %.1f ms, p99.9 %.1f ms, max %.1f ms\n", label,
+         h.count(), h.percentile(500) / 1000.0, h.percentile(990) / 1000.0,
+         h.percentile(999) / 1000.0, h.max() / 1000.0);
+}
+
+static void runFleet(const FleetConfig& config, uint32_t devices, uint32_t threads,
+                     uint32_t listeners, double rampS, double durationS) {
+  printf("%u devices on %u thread(s) at %.0fx, %.0f s after a %.0f s ramp\n", devices, threads,
+         config.speed, durationS, rampS);
+  fflush(stdout);
+  std::vector<FleetWorker*> workers;
+  for (uint32_t t = 0; t < threads; t++) {
+    workers.push_back(new FleetWorker(config, t, threads, devices, listeners,
+                                      (uint64_t)(rampS * 1e6)));
+  }
+
+  uint64_t startUs = fleetNowUs();
+  uint64_t measureUs = startUs + (uint64_t)(rampS * 1e6);
+  uint64_t endUs = measureUs + (uint64_t)(durationS * 1e6);
+  std::vector<std::thread> running;
+  for (FleetWorker* w : workers) {
+    running.emplace_back([=] { w->run(startUs, measureUs, endUs, stopRequested); });
+  }
+  // Wait out the ramp here so CPU is only counted while measuring
+  while (fleetNowUs() < measureUs && !stopRequested) usleep(100000);
+  long long serverBefore = serverCpuUs(config.server, config.host);
+  long long cpuBefore = processCpuUs();
+  uint64_t measuredFrom = fleetNowUs();
+  for (std::thread& t : running) t.join();
+  uint64_t now = fleetNowUs();
+  long long cpu = processCpuUs() - cpuBefore;
+  long long serverAfter = serverCpuUs(config.server, config.host);
+
+  FleetStats stats;
+  double ranMs = 0, targetMs = 0;
+  size_t connections = 0;
+  for (FleetWorker* w : workers) {
+    stats.merge(w->stats());
+    w->virtualTime(now, ranMs, targetMs);
+    connections += w->connections();
+  }
+  double wallS = (now - measuredFrom) / 1e6;
+  if (wallS <= 0) wallS = 1e-9;
+  const unsigned long long* c = stats.counts;
+
+  printf("  virtual time: %.1f%% of target (%.1fx); %zu connections open\n",
+         targetMs > 0 ? 100 * ranMs / targetMs : 0, targetMs > 0 ? config.speed * ranMs / targetMs : 0,
+         connections);
+  printf("  uploads: %llu requests (%.1f/s), %llu failed, %llu timed out; %llu connects, "
+         "%llu retried; %llu bytes\n",
+         c[FleetStats::REQUESTS], c[FleetStats::REQUESTS] / wallS, c[FleetStats::FAILURES],
+         c[FleetStats::TIMEOUTS], c[FleetStats::CONNECTS], c[FleetStats::RETRIES],
+         c[FleetStats::BYTES]);
+  printf("  stored: %llu readings (%.1f/s), %llu health records\n", c[FleetStats::RECORDS],
+         c[FleetStats::RECORDS] / wallS, c[FleetStats::HEALTH]);
+  if (c[FleetStats::RECORDS]) {
+    printf("  per reading: %.1f body bytes, %.2f requests (health included)\n",
+           (double)c[FleetStats::BYTES] / c[FleetStats::RECORDS],
+           (double)c[FleetStats::REQUESTS] / c[FleetStats::RECORDS]);
+  }
+  printLatency("ingest", stats.ingestUs);
+  if (listeners) printLatency("end to end", stats.endToEndUs);
+  printf("  CPU: plant_fleet %.0f%% of a core", 100.0 * cpu / (wallS * 1e6));
+  if (serverBefore >= 0 && serverAfter >= 0) {
+    printf(", server %.1f%%", 100.0 * (serverAfter - serverBefore) / (wallS * 1e6));
+  } else {
+    printf(", server n/a");
+  }
+  printf("\n\n");
+  fflush(stdout);
+  for (FleetWorker* w : workers) delete w;
+}
+
+int main(int argc, char** argv) {
+  const char* server = nullptr;
+  uint32_t sweep[FLEET_MAX_SWEEP] = {1000};
+  uint8_t sweeps = 1;
+  uint32_t threads = 1;
+  uint32_t listeners = 0;
+  double rampS = 20, durationS = 60;
+  FleetConfig config;
+  memset(&config, 0, sizeof(config));
+  config.speed = 20;
+  config.stepMs = 250;
+  config.plant = "spider_plant";
+  config.seed = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--server") && more) server = argv[++i];
+    else if (!strcmp(a, "--devices") && more) {
+      sweeps = 0;
+      for (char* p = argv[++i]; *p && sweeps < FLEET_MAX_SWEEP; p += *p == ',') {
+        sweep[sweeps++] = strtoul(p, &p, 10);
+      }
+    }
+    else if (!strcmp(a, "--threads") && more) threads = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--speed") && more) config.speed = atof(argv[++i]);
+    else if (!strcmp(a, "--step-ms") && more) config.stepMs = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--duration") && more) durationS = atof(argv[++i]);
+    else if (!strcmp(a, "--ramp") && more) rampS = atof(argv[++i]);
+    else if (!strcmp(a, "--listeners") && more) listeners = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--plant") && more) config.plant = argv[++i];
+    else if (!strcmp(a, "--seed") && more) config.seed = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--batch") && more) config.batch = strtoul(argv[++i], nullptr, 0);
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  static char host[128];
+  if (!server || !resolve(server, config.server, host, sizeof(host)) || threads == 0 ||
+      config.speed <= 0 || config.stepMs == 0) {
+    usage(argv[0]);
+    return 2;
+  }
+  config.host = host;
+  config.loopback = (ntohl(config.server.sin_addr.s_addr) >> 24) == 127;
+
+  rlimit files;
+  getrlimit(RLIMIT_NOFILE, &files);
+  files.rlim_cur = files.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &files);
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+
+  for (uint8_t i = 0; i < sweeps && !stopRequested; i++) {
+    uint32_t devices = sweep[i];
+    uint32_t sockets = devices + (listeners < devices ? listeners : devices);
+    if (sockets + FLEET_SOCKETS_PER_PROCESS > files.rlim_cur) {
+      fprintf(stderr, "%u devices need %u sockets, the open file limit is %llu; skipped\n",
+              devices, sockets, (unsigned long long)files.rlim_cur);
+      continue;
+    }
+    runFleet(config, devices, threads, listeners < devices ? listeners : devices, rampS, durationS);
+  }
+  return 0;
+}
@@ -0,0 +1,253 @@
+// Smart Plant Buddy - the firmware core on Linux
+//
+// Runs PlantCore against LinuxHal: the same tasks, queues, mood rules and
+// upload batching as the ESP32, with simulated sensors and network. The
+// sensors see PlantPhysics (a plant fitted to the RTDB export) or, with
+// --model wave, plain sines. By default the clock jumps straight to the
+// next due task, so days of firmware time pass in seconds; --realtime
+// paces it against the wall clock instead (useful with --ws and the
+// dashboard). --csv writes a reading every --csv-ms for offline tuning.
+// --binlog sends the log as binary frames to a file for decode_log.py.
+// --rtdb uploads to an rtdb_server instead of the in-process stand-in.
+// --assoc-fail-rate and --link-up-min make the WiFi link flaky, to watch
+// the reconnect backoff.
+//
+//   g++ -std=gnu++17 -O2 -Wall host/plant_sim.cc -o plant_sim
+//   ./plant_sim --hours 24 --fail-rate 0.2 --offline /tmp/offline -q
+//   ./plant_sim --hours 2160 --csv quarter.csv --seed 7 -q
+//   ./plant_sim --realtime --ws 8081
+//   ./plant_sim --hours 24 --binlog sim.bin && python3 host/decode_log.py sim.bin
+//   ./plant_sim --hours 24 --rtdb localhost:9000 -q
+//   ./plant_sim --hours 24 --assoc-fail-rate 0.5 --link-up-min 90 -q
+//
+// Prints each scheduler's task stats (run times are real, on this machine)
+// and the upload totals at the end, plus the phase histograms when built
+// with -DLATENCY_PROFILE and the heap (per-phase allocations with
+// -DHEAP_PROFILE). The same seed gives the same run.
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../PlantCore.h"
+#include "LinuxHal.h"
+#include "PlantPhysicsFit.h"
+#include "../ReadingCodec.h"
+#include "WsServer.h"
+
+const size_t CSV_ROW_MAX = 160;
+
+#ifdef HEAP_PROFILE
+// Count every allocation for the phase scopes, as the ESP32's heap hooks do
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t n, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+  countAlloc(size);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t n, size_t size) {
+  countAlloc(n * size);
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+  countAlloc(size);
+  return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+  if (ptr) countFree();
+  __libc_free(ptr);
+}
+}
+#endif
+
+static volatile bool stopRequested = false;
+
+static void onSignal(int) { stopRequested = true; }
+
+static PlantCore* liveCore = nullptr;
+
+// Same role as webSocketEvent() in the sketch
+static void webSocketEvent(uint8_t client, WsEvent type, const uint8_t* payload, size_t len) {
+  switch (type) {
+    case WS_CONNECTED: liveCore->liveConnected(client); break;
+    case WS_DISCONNECTED: liveCore->liveDisconnected(client); break;
+    case WS_TEXT: liveCore->liveText(client, payload, len); break;
+    default: break;
+  }
+}
+
+static double wallSeconds() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void printTasks(const char* label, const Scheduler& s) {
+  for (uint8_t i = 0; i < s.count(); i++) {
+    const Task& t = s.task(i);
+    printf("  %-7s %-10s runs=%-9lu overruns=%-5lu max=%luus\n",
+           label, t.name, t.runs, t.overruns, t.maxUs);
+  }
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s [--hours H] [--realtime] [--ws PORT] [--fail-rate P]\n"
+          "          [--dht-fail-rate P] [--offline DIR] [--plant ID] [--seed N]\n"
+          "          [--model plant|wave] [--csv FILE] [--csv-ms N] [--binlog FILE]\n"
+          "          [--rtdb HOST:PORT] [--assoc-fail-rate P] [--link-up-min M] [-q]\n",
+          argv0);
+}
+
+int main(int argc, char** argv) {
+  double hours = 24;
+  bool realtime = false;
+  int wsPort = 0;
+  const char* plant = "spider_plant";
+  const char* model = "plant";
+  const char* csvPath = nullptr;
+  unsigned long csvMs = 60000;
+  LinuxHalConfig config = {1, 0, 0.02f, nullptr, false, nullptr, nullptr, 0, 0};
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--hours") && more) hours = atof(argv[++i]);
+    else if (!strcmp(a, "--realtime")) realtime = true;
+    else if (!strcmp(a, "--ws") && more) wsPort = atoi(argv[++i]);
+    else if (!strcmp(a, "--fail-rate") && more) config.httpFailRate = atof(argv[++i]);
+    else if (!strcmp(a, "--dht-fail-rate") && more) config.dhtFailRate = atof(argv[++i]);
+    else if (!strcmp(a, "--offline") && more) config.offlineLog = argv[++i];
+    else if (!strcmp(a, "--plant") && more) plant = argv[++i];
+    else if (!strcmp(a, "--seed") && more) config.seed = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--model") && more) model = argv[++i];
+    else if (!strcmp(a, "--csv") && more) csvPath = argv[++i];
+    else if (!strcmp(a, "--csv-ms") && more) csvMs = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--binlog") && more) config.binaryLog = argv[++i];
+    else if (!strcmp(a, "--rtdb") && more) config.rtdb = argv[++i];
+    else if (!strcmp(a, "--assoc-fail-rate") && more) config.assocFailRate = atof(argv[++i]);
+    else if (!strcmp(a, "--link-up-min") && more) config.linkUpMeanMs = (unsigned long)(atof(argv[++i]) * 60000);
+    else if (!strcmp(a, "-q")) config.quiet = true;
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  WaveformSensors wave(config.seed);
+  PlantPhysics physics(FITTED_PHYSICS, config.seed, SIM_EPOCH_MS);
+  bool usePhysics = strcmp(model, "wave") != 0;
+  LinuxHal hal(config, usePhysics ? (SimSensors&)physics : (SimSensors&)wave);
+  PlantCore core(hal);
+  liveCore = &core;
+
+  WsServer ws(webSocketEvent);
+  if (wsPort > 0) {
+    if (!ws.begin(wsPort)) {
+      perror("WebSocket listen");
+      return 1;
+    }
+    hal.setWebSocket(&ws);
+    printf("Live feed on ws://localhost:%d/\n", wsPort);
+  }
+  FILE* csv = nullptr;
+  if (csvPath) {
+    csv = fopen(csvPath, "w");
+    if (!csv) {
+      perror(csvPath);
+      return 1;
+    }
+    char header[CSV_ROW_MAX];
+    fwrite(header, 1, writeReadingCsvHeader(header, sizeof(header)), csv);
+  }
+  signal(SIGINT, onSignal);
+  // Quiet runs skip recording the log at all, unless it goes to a file
+  if (config.binaryLog) core.setLogBinary(true);
+  else if (config.quiet) core.setLogLevel(LOG_LVL_OFF);
+
+  // setup()
+  core.begin(plant);
+  core.beginNet();
+
+  // loop(), the sensor task and the network task, interleaved
+  unsigned long endMs = (unsigned long)(hours * 3600000.0);
+  unsigned long csvNextMs = READING_WINDOW_MS;
+  double wallStart = wallSeconds();
+  while (hal.millis() < endMs && !stopRequested) {
+    bool ran = core.sensorTick();
+    ran |= core.loopTick();
+    ran |= core.netTick();
+    if (csv && core.current().uptimeMs >= csvNextMs) {
+      char row[CSV_ROW_MAX];
+      fwrite(row, 1, writeReadingCsv(row, sizeof(row), core.current(), core.mood()), csv);
+      csvNextMs = core.current().uptimeMs + csvMs;
+    }
+    if (ran) {
+      if (wsPort > 0) ws.poll(0);
+      continue;
+    }
+    unsigned long wait = core.msUntilNext();
+    if (wait == 0) wait = 1;
+    if (realtime) {
+      double target = wallStart + (hal.millis() + wait) / 1000.0;
+      double now = wallSeconds();
+      if (target > now) {
+        if (wsPort > 0) {
+          ws.poll((int)((target - now) * 1000));
+        } else {
+          usleep((useconds_t)((target - now) * 1e6));
+        }
+      }
+      double elapsedMs = (wallSeconds() - wallStart) * 1000;
+      if (elapsedMs > hal.millis()) hal.advance((unsigned long)elapsedMs - hal.millis());
+    } else {
+      if (wsPort > 0) ws.poll(0);
+      hal.advance(wait);
+    }
+  }
+  double wall = wallSeconds() - wallStart;
+  if (csv) fclose(csv);
+  double simHours = hal.millis() / 3600000.0;
+
+  printf("\nSimulated %.2f h in %.2f s (%.0fx, %.0f sim-h/s)\n",
+         simHours, wall, simHours * 3600 / (wall > 0 ? wall : 1e-9), simHours / (wall > 0 ? wall : 1e-9));
+  printTasks("sensor", core.sensorScheduler());
+  printTasks("loop", core.loopScheduler());
+  printTasks("net", core.netScheduler());
+  const HttpStandIn& http = hal.http();
+  printf("  uploads: %lu requests, %lu failed, %lu readings, %lu health records, %llu bytes; "
+         "%u pending offline\n",
+         http.requests(), http.failures(), http.records(), http.healthRecords(), http.bytes(),
+         (unsigned)core.offlinePending());
+  printf("  DHT: %lu reads, %lu failed; ADC overruns: %lu; OLED updates: %lu; live frames: %lu\n",
+         hal.climateReads(), hal.climateFailures(), hal.adcOverruns(),
+         hal.statusUpdates(), hal.liveFrames());
+  const ConnectionManager& wifi = core.connection();
+  printf("  WiFi: %lu attempts, %lu failed associations, %lu drops; %s\n", wifi.attempts(),
+         hal.assocFailures(), hal.linkDrops(), ConnectionManager::stateName(wifi.state()));
+  if (usePhysics) printf("  plant watered %lu times\n", physics.waterings());
+  printf("  mood now %s; transitions:", moodToken(core.mood()));
+  for (uint8_t from = 0; from < MOOD_COUNT; from++) {
+    for (uint8_t to = 0; to < MOOD_COUNT; to++) {
+      uint16_t n = core.moodTransitions((Mood)from, (Mood)to);
+      if (n) printf(" %s->%s:%u", moodToken((Mood)from), moodToken((Mood)to), n);
+    }
+  }
+  printf("\n");
+  hal.setQuiet(false);
+#ifdef LATENCY_PROFILE
+  printf("  latency per phase:\n");
+  core.logLatency();
+#endif
+  core.logHeap();
+  return 0;
+}
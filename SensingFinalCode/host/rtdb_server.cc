@@ -0,0 +1,78 @@
+// Smart Plant Buddy - local Realtime Database stand-in
+//
+// Serves the RTDB REST subset in RtdbServer.h on a local port, so the
+// firmware, plant_sim and the dashboard's queries can run without a
+// Firebase project. Point the sketch's FIREBASE_DB_URL at
+// "http://<this machine>:9000" (FirebaseClient speaks plain HTTP too), or
+// run plant_sim with --rtdb. --log keeps the data across restarts.
+//
+//   g++ -std=gnu++17 -O2 -Wall host/rtdb_server.cc -o rtdb_server
+//   ./rtdb_server --port 9000 --log /tmp/rtdb.log
+//   curl 'localhost:9000/plants/plant1/logs.json?orderBy="$key"&limitToLast=700'
+//   curl -N -H 'Accept: text/event-stream' localhost:9000/plants/plant1/logs.json
+//
+// Prints request and tree totals on SIGINT / SIGTERM.
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include "RtdbServer.h"
+
+static volatile bool stopRequested = false;
+
+static void onSignal(int) { stopRequested = true; }
+
+static void usage(const char* argv0) {
+  fprintf(stderr, "usage: %s [--port N] [--log FILE]\n", argv0);
+}
+
+int main(int argc, char** argv) {
+  int port = 9000;
+  const char* logPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--port") && more) port = atoi(argv[++i]);
+    else if (!strcmp(a, "--log") && more) logPath = argv[++i];
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  // One socket per client; plant_fleet can bring tens of thousands
+  rlimit files;
+  getrlimit(RLIMIT_NOFILE, &files);
+  files.rlim_cur = files.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &files);
+
+  RtdbServer server;
+  if (!server.begin(port, logPath)) {
+    perror(logPath ? logPath : "listen");
+    return 1;
+  }
+  if (logPath) {
+    printf("Replayed %lu writes from %s", server.replayed(), logPath);
+    if (server.skipped()) printf(" (%lu unreadable lines skipped)", server.skipped());
+    printf("\n");
+  }
+  printf("RTDB stand-in on http://localhost:%d/\n", port);
+  fflush(stdout);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+  while (!stopRequested) server.poll(1000);
+
+  const RtdbStats& s = server.stats();
+  size_t nodes, leaves;
+  server.tree().count(nodes, leaves);
+  printf("\n%llu connections, %llu requests (%llu reads, %llu writes, %llu errors), "
+         "%llu events; %llu bytes in, %llu out\n",
+         s.accepted, s.requests, s.reads, s.writes, s.errors, s.events, s.bytesIn, s.bytesOut);
+  printf("tree: %zu nodes, %zu leaves\n", nodes, leaves);
+  return 0;
+}